@@ -0,0 +1,90 @@
+#!/bin/sh -e
+# Regression of the rendering against reference hashes: each journal of the
+# directory is replayed with each player and block size, and the hash of the
+# audio is compared with the reference line
+#     journal player emulator block-size hash
+# With -u, the reference file is rewritten with the hashes obtained.
+#
+# The emulator is fixed by EMULATOR, 0 by default, the reference being valid
+# only for the emulator which produced it. A replay which fails is a failure,
+# and with -u, nothing is written.
+
+usage() {
+    echo "Usage:" >&2
+    echo "    golden-render.sh [-u] adlreplay journal-dir reference-file" >&2
+    exit 1
+}
+
+update=0
+if test "$1" = "-u"; then
+    update=1
+    shift
+fi
+test "$#" -eq 3 || usage
+
+adlreplay="$1"
+journals="$2"
+reference="$3"
+emulator="${EMULATOR:-0}"
+players="ADLMIDI OPNMIDI"
+blocks="64 256 1024 4096"
+
+results=`mktemp`
+errors=`mktemp`
+trap 'rm -f "$results" "$errors"' EXIT
+
+failures=0
+count=0
+for journal in "$journals"/*.adlj; do
+    test -f "$journal" || continue
+    name=`basename "$journal"`
+    for player in $players; do
+        for block in $blocks; do
+            count=`expr $count + 1`
+            if hash=`"$adlreplay" -q -p "$player" -e "$emulator" -B "$block" "$journal" 2>"$errors"`; then
+                echo "$name $player $emulator $block $hash" >> "$results"
+            else
+                echo "ERROR   $name $player emulator $emulator block $block:"
+                sed 's/^/        /' "$errors"
+                failures=`expr $failures + 1`
+            fi
+        done
+    done
+done
+
+if test "$count" -eq 0; then
+    echo "No journals in $journals."
+    exit 1
+fi
+
+if test "$update" = 1; then
+    if test "$failures" -gt 0; then
+        echo "$failures replays failed, the reference is not updated."
+        exit 1
+    fi
+    {
+        grep '^#' "$reference" 2>/dev/null || true
+        sort "$results"
+    } > "$reference".new
+    mv "$reference".new "$reference"
+    echo "Updated $reference with $count hashes."
+    exit 0
+fi
+
+while read name player emu block hash; do
+    expected=`awk -v n="$name" -v p="$player" -v e="$emu" -v b="$block" \
+        '$1 == n && $2 == p && $3 == e && $4 == b { print $5 }' "$reference"`
+    if test -z "$expected"; then
+        echo "MISSING $name $player emulator $emu block $block: no reference, record it with -u"
+        failures=`expr $failures + 1`
+    elif test "$expected" != "$hash"; then
+        echo "FAILED  $name $player emulator $emu block $block: $hash, expected $expected"
+        failures=`expr $failures + 1`
+    fi
+done < "$results"
+
+if test "$failures" -gt 0; then
+    echo "$failures of $count renders failed or differ from the reference."
+    exit 1
+fi
+echo "All $count renders match the reference."
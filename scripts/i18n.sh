@@ -12,9 +12,9 @@ po_update() {
 for locale in "fr"; do
     mkdir -p po/"$locale"
     xgettext -k_ -L C++ -c -s -o po/"$locale"/adljack.pot sources/*.{h,cc}
-    xgettext -k_INST -L C++ -c -o po/"$locale"/adljack_inst.pot sources/insnames.cc
-    xgettext -k_PERC -L C++ -c -o po/"$locale"/adljack_perc.pot sources/insnames.cc
-    xgettext -k_EX -L C++ -c -o po/"$locale"/adljack_ex.pot sources/insnames.cc
+    xgettext -kN_INST -L C++ -c -o po/"$locale"/adljack_inst.pot sources/insnames.cc
+    xgettext -kN_PERC -L C++ -c -o po/"$locale"/adljack_perc.pot sources/insnames.cc
+    xgettext -kN_EX -L C++ -c -o po/"$locale"/adljack_ex.pot sources/insnames.cc
     po_update po/"$locale"/adljack.po
     po_update po/"$locale"/adljack_inst.po
     po_update po/"$locale"/adljack_perc.po
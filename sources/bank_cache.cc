@@ -0,0 +1,248 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bank_cache.h"
+#include "bank_image.h"
+#include <unordered_map>
+#include <list>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+Bank_Cache bank_cache;
+
+struct Bank_Cache::Impl
+{
+    mutable std::mutex mutex_;
+    size_t capacity_ = bank_cache_default_capacity;
+    size_t used_ = 0;
+    // most recently used at the front
+    std::list<Bank_Image_Ptr> lru_;
+    std::unordered_map<std::string, std::list<Bank_Image_Ptr>::iterator> index_;
+    //
+    std::thread prefetch_thread_;
+    std::condition_variable prefetch_cond_;
+    std::deque<std::string> prefetch_queue_;
+    bool prefetch_quit_ = false;
+    void (*thread_setup_)() = nullptr;
+    //
+    Bank_Image_Ptr lookup(const std::string &path, const struct stat &st);
+    void insert(const Bank_Image_Ptr &image);
+    void evict(size_t capacity);
+    void prefetch_run();
+};
+
+Bank_Image::Bank_Image()
+{
+}
+
+Bank_Image::~Bank_Image()
+{
+}
+
+const uint8_t *Bank_Image::bank_data() const
+{
+    return mapping ? mapping->data() : data.data();
+}
+
+size_t Bank_Image::bank_size() const
+{
+    return mapping ? mapping->size() : data.size();
+}
+
+static Bank_Image_Ptr read_bank_image(const std::string &path, const struct stat &st)
+{
+    if (!S_ISREG(st.st_mode))
+        return nullptr;
+
+    std::shared_ptr<Bank_Image> image(new Bank_Image);
+    image->path = path;
+    image->size = st.st_size;
+    image->mtime = st.st_mtime;
+
+    if (is_bank_image_file(path.c_str())) {
+        // compiled images are mapped, not read
+        image->mapping.reset(new Bank_Mapping);
+        if (!image->mapping->open(path.c_str()))
+            return nullptr;
+        return image;
+    }
+
+    FILE *stream = fopen(path.c_str(), "rb");
+    if (!stream)
+        return nullptr;
+
+    image->data.resize(st.st_size);
+    bool ok = fread(image->data.data(), 1, image->size, stream) == image->size;
+    fclose(stream);
+
+    return ok ? image : nullptr;
+}
+
+Bank_Cache::Bank_Cache()
+    : P(new Impl)
+{
+}
+
+Bank_Cache::~Bank_Cache()
+{
+    std::unique_lock<std::mutex> lock(P->mutex_);
+    P->prefetch_quit_ = true;
+    lock.unlock();
+    P->prefetch_cond_.notify_one();
+    if (P->prefetch_thread_.joinable())
+        P->prefetch_thread_.join();
+}
+
+void Bank_Cache::set_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->capacity_ = capacity;
+    P->evict(capacity);
+}
+
+size_t Bank_Cache::capacity() const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    return P->capacity_;
+}
+
+size_t Bank_Cache::size_used() const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    return P->used_;
+}
+
+Bank_Image_Ptr Bank_Cache::load(const char *path)
+{
+    std::string key = path;
+
+    struct stat st;
+    if (stat(path, &st) == -1)
+        return nullptr;
+
+    std::unique_lock<std::mutex> lock(P->mutex_);
+    if (Bank_Image_Ptr image = P->lookup(key, st))
+        return image;
+    lock.unlock();
+
+    // read without holding the lock, prefetch may run concurrently
+    Bank_Image_Ptr image = read_bank_image(key, st);
+    if (!image)
+        return nullptr;
+
+    lock.lock();
+    P->insert(image);
+    return image;
+}
+
+void Bank_Cache::prefetch(const std::vector<std::string> &paths)
+{
+    std::unique_lock<std::mutex> lock(P->mutex_);
+    P->prefetch_queue_.assign(paths.begin(), paths.end());
+    if (!P->prefetch_thread_.joinable())
+        P->prefetch_thread_ = std::thread([this]() { P->prefetch_run(); });
+    lock.unlock();
+    P->prefetch_cond_.notify_one();
+}
+
+void Bank_Cache::set_thread_setup(void (*setup)())
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->thread_setup_ = setup;
+}
+
+void Bank_Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->prefetch_queue_.clear();
+    P->evict(0);
+}
+
+Bank_Image_Ptr Bank_Cache::Impl::lookup(const std::string &path, const struct stat &st)
+{
+    auto it = index_.find(path);
+    if (it == index_.end())
+        return nullptr;
+
+    Bank_Image_Ptr image = *it->second;
+    if (image->size != (uint64_t)st.st_size || image->mtime != (int64_t)st.st_mtime) {
+        // changed on disk, drop the stale copy
+        used_ -= image->size;
+        lru_.erase(it->second);
+        index_.erase(it);
+        return nullptr;
+    }
+
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return image;
+}
+
+// tells if a bank file is small enough to keep a copy; the larger ones are
+// read at each load, as before the cache
+static bool is_cacheable_size(const std::string &path, uint64_t size)
+{
+    return size <= bank_file_max_size || is_bank_image_file(path.c_str());
+}
+
+void Bank_Cache::Impl::insert(const Bank_Image_Ptr &image)
+{
+    if (image->size > capacity_ || !is_cacheable_size(image->path, image->size))
+        return;
+
+    auto it = index_.find(image->path);
+    if (it != index_.end()) {
+        used_ -= (*it->second)->size;
+        lru_.erase(it->second);
+        index_.erase(it);
+    }
+
+    evict(capacity_ - image->size);
+    lru_.push_front(image);
+    index_[image->path] = lru_.begin();
+    used_ += image->size;
+}
+
+void Bank_Cache::Impl::evict(size_t capacity)
+{
+    while (used_ > capacity && !lru_.empty()) {
+        const Bank_Image_Ptr &image = lru_.back();
+        used_ -= image->size;
+        index_.erase(image->path);
+        lru_.pop_back();
+    }
+}
+
+void Bank_Cache::Impl::prefetch_run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (thread_setup_)
+        thread_setup_();
+    for (;;) {
+        prefetch_cond_.wait(lock, [this]() { return prefetch_quit_ || !prefetch_queue_.empty(); });
+        if (prefetch_quit_)
+            break;
+
+        std::string path = std::move(prefetch_queue_.front());
+        prefetch_queue_.pop_front();
+
+        lock.unlock();
+        struct stat st;
+        bool ok = stat(path.c_str(), &st) == 0;
+        lock.lock();
+        if (!ok || !is_cacheable_size(path, st.st_size) || lookup(path, st))
+            continue;
+
+        lock.unlock();
+        Bank_Image_Ptr image = read_bank_image(path, st);
+        lock.lock();
+        if (image)
+            insert(image);
+    }
+}
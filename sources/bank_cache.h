@@ -0,0 +1,57 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdint.h>
+
+class Bank_Mapping;
+
+struct Bank_Image {
+    Bank_Image();
+    ~Bank_Image();
+    std::string path;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    // the contents of a WOPL/WOPN file, or the mapping of a compiled image
+    std::vector<uint8_t> data;
+    std::unique_ptr<Bank_Mapping> mapping;
+    const uint8_t *bank_data() const;
+    size_t bank_size() const;
+};
+
+typedef std::shared_ptr<const Bank_Image> Bank_Image_Ptr;
+
+class Bank_Cache {
+public:
+    Bank_Cache();
+    ~Bank_Cache();
+
+    // memory cap for the cached images, in bytes
+    void set_capacity(size_t capacity);
+    size_t capacity() const;
+    size_t size_used() const;
+
+    // gets the image of the bank, reading the file if the cached copy is
+    // missing or outdated (size or mtime differs)
+    Bank_Image_Ptr load(const char *path);
+    // replaces the pending prefetch requests with these paths
+    void prefetch(const std::vector<std::string> &paths);
+    // a function which the prefetch thread calls when it starts
+    void set_thread_setup(void (*setup)());
+    void clear();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+extern Bank_Cache bank_cache;
+
+static constexpr size_t bank_cache_default_capacity = 16 * 1024 * 1024;
+// the largest WOPL/WOPN file which is cached, the larger ones load uncached
+static constexpr size_t bank_file_max_size = 4 * 1024 * 1024;
@@ -0,0 +1,272 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bank_format.h"
+#include <algorithm>
+#include <string.h>
+
+static const char wopl_magic[11] = "WOPL3-BANK";
+static const char wopn_magic1[11] = "WOPN2-BANK";
+static const char wopn_magic2[11] = "WOPN2-B2NK";
+
+struct Bank_Layout {
+    size_t header_size;
+    size_t bank_meta_size;
+    size_t instrument_size;
+    unsigned version;
+    unsigned melodic_banks;
+    unsigned percussive_banks;
+};
+
+static unsigned read_u16le(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned read_u16be(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static std::string read_name(const uint8_t *p)
+{
+    const char *name = (const char *)p;
+    return std::string(name, strnlen(name, 32));
+}
+
+Player_Type identify_bank_data(const uint8_t *data, size_t size)
+{
+    if (size < 11)
+        return Player_Type::INVALID;
+    if (!memcmp(data, wopl_magic, 11))
+        return Player_Type::OPL3;
+    if (!memcmp(data, wopn_magic1, 11) || !memcmp(data, wopn_magic2, 11))
+        return Player_Type::OPN2;
+    return Player_Type::INVALID;
+}
+
+static bool get_bank_layout(Player_Type pt, const uint8_t *data, size_t size, Bank_Layout &layout)
+{
+    switch (pt) {
+    default:
+        return false;
+    case Player_Type::OPL3:
+        layout.header_size = 19;
+        break;
+    case Player_Type::OPN2:
+        // the version 1 has its own magic, and no version field
+        layout.header_size = memcmp(data, wopn_magic1, 11) ? 18 : 16;
+        break;
+    }
+
+    if (size < layout.header_size)
+        return false;
+
+    if (pt == Player_Type::OPN2 && layout.header_size == 16) {
+        layout.version = 1;
+        layout.melodic_banks = read_u16be(data + 11);
+        layout.percussive_banks = read_u16be(data + 13);
+    }
+    else {
+        layout.version = read_u16le(data + 11);
+        layout.melodic_banks = read_u16be(data + 13);
+        layout.percussive_banks = read_u16be(data + 15);
+    }
+    layout.bank_meta_size = (layout.version >= 2) ? 34 : 0;
+
+    if (pt == Player_Type::OPL3)
+        layout.instrument_size = (layout.version >= 3) ? 66 : 62;
+    else
+        layout.instrument_size = (layout.version >= 2) ? 69 : 65;
+
+    size_t total_banks = layout.melodic_banks + layout.percussive_banks;
+    size_t total_size = layout.header_size +
+        total_banks * (layout.bank_meta_size + 128 * layout.instrument_size);
+    return size >= total_size;
+}
+
+static bool is_blank_instrument(Player_Type pt, const uint8_t *ins)
+{
+    if (pt == Player_Type::OPL3)
+        return ins[39] & 0x04;
+
+    // WOPN has no blank flag, consider unnamed and silent ones as blank
+    if (ins[0] != '\0')
+        return false;
+    for (unsigned i = 37; i < 65; ++i)
+        if (ins[i] != 0)
+            return false;
+    return true;
+}
+
+bool read_bank_index(const uint8_t *data, size_t size, Bank_Index &index)
+{
+    Player_Type pt = identify_bank_data(data, size);
+
+    Bank_Layout layout;
+    if (!get_bank_layout(pt, data, size, layout))
+        return false;
+
+    index.type = pt;
+    index.version = layout.version;
+    index.banks.clear();
+    index.instruments.clear();
+
+    unsigned total_banks = layout.melodic_banks + layout.percussive_banks;
+    index.banks.resize(total_banks);
+    index.instruments.reserve(128 * total_banks);
+
+    const uint8_t *meta = data + layout.header_size;
+    for (unsigned b = 0; b < total_banks; ++b) {
+        Bank_Index_Bank &bank = index.banks[b];
+        bank.percussive = b >= layout.melodic_banks;
+        if (layout.bank_meta_size > 0) {
+            const uint8_t *p = meta + b * layout.bank_meta_size;
+            bank.name = read_name(p);
+            bank.lsb = p[32] & 0x7f;
+            bank.msb = p[33] & 0x7f;
+        }
+    }
+
+    size_t offset = layout.header_size + total_banks * layout.bank_meta_size;
+    for (unsigned b = 0; b < total_banks; ++b) {
+        const Bank_Index_Bank &bank = index.banks[b];
+        for (unsigned p = 0; p < 128; ++p, offset += layout.instrument_size) {
+            const uint8_t *ins = data + offset;
+            if (is_blank_instrument(pt, ins))
+                continue;
+            Bank_Index_Instrument entry;
+            entry.percussive = bank.percussive;
+            entry.msb = bank.msb;
+            entry.lsb = bank.lsb;
+            entry.program = p;
+            entry.name = read_name(ins);
+            entry.offset = offset;
+            entry.size = layout.instrument_size;
+            index.instruments.push_back(std::move(entry));
+        }
+    }
+
+    return true;
+}
+
+bool diff_bank_data(const uint8_t *old_data, size_t old_size,
+                    const uint8_t *new_data, size_t new_size,
+                    std::vector<Bank_Instrument_Id> &changed)
+{
+    changed.clear();
+
+    Player_Type pt = identify_bank_data(old_data, old_size);
+    if (pt == Player_Type::INVALID || identify_bank_data(new_data, new_size) != pt)
+        return false;
+
+    Bank_Layout old_layout, new_layout;
+    if (!get_bank_layout(pt, old_data, old_size, old_layout) ||
+        !get_bank_layout(pt, new_data, new_size, new_layout))
+        return false;
+
+    // same version, bank counts and global settings
+    size_t header_size = old_layout.header_size;
+    if (memcmp(old_data, new_data, header_size) != 0)
+        return false;
+
+    unsigned total_banks = old_layout.melodic_banks + old_layout.percussive_banks;
+    size_t meta_size = old_layout.bank_meta_size;
+
+    // same bank numbers, the names do not matter
+    for (unsigned b = 0; b < total_banks; ++b) {
+        const uint8_t *old_meta = old_data + header_size + b * meta_size;
+        const uint8_t *new_meta = new_data + header_size + b * meta_size;
+        if (meta_size > 0 && memcmp(old_meta + 32, new_meta + 32, 2) != 0)
+            return false;
+    }
+
+    size_t ins_size = old_layout.instrument_size;
+    size_t offset = header_size + total_banks * meta_size;
+    for (unsigned b = 0; b < total_banks; ++b) {
+        const uint8_t *meta = old_data + header_size + b * meta_size;
+        for (unsigned p = 0; p < 128; ++p, offset += ins_size) {
+            if (!memcmp(old_data + offset, new_data + offset, ins_size))
+                continue;
+            Bank_Instrument_Id id;
+            id.percussive = b >= old_layout.melodic_banks;
+            id.lsb = (meta_size > 0) ? (meta[32] & 0x7f) : 0;
+            id.msb = (meta_size > 0) ? (meta[33] & 0x7f) : 0;
+            id.program = p;
+            changed.push_back(id);
+        }
+    }
+
+    return true;
+}
+
+size_t bank_instrument_size(Player_Type pt)
+{
+    switch (pt) {
+    case Player_Type::OPL3:
+        return 66;
+    case Player_Type::OPN2:
+        return 69;
+    default:
+        return 0;
+    }
+}
+
+bool make_instrument_bank(Player_Type pt, const Bank_Instrument_Id &id,
+                          const uint8_t *record, size_t size,
+                          std::vector<uint8_t> &data)
+{
+    size_t ins_size = bank_instrument_size(pt);
+    if (ins_size == 0 || size != ins_size || id.program > 127)
+        return false;
+
+    size_t header_size;
+    unsigned version;
+    const char *magic;
+    switch (pt) {
+    default:
+        return false;
+    case Player_Type::OPL3:
+        header_size = 19;
+        version = 3;
+        magic = wopl_magic;
+        break;
+    case Player_Type::OPN2:
+        header_size = 18;
+        version = 2;
+        magic = wopn_magic2;
+        break;
+    }
+
+    // one melodic and one percussive bank, the other instruments blank
+    const size_t meta_size = 34;
+    const unsigned total_banks = 2;
+    data.assign(header_size + total_banks * (meta_size + 128 * ins_size), 0);
+
+    uint8_t *p = data.data();
+    memcpy(p, magic, 11);
+    p[11] = version & 0xff;
+    p[12] = version >> 8;
+    p[13] = 0;
+    p[14] = 1;  // melodic banks
+    p[15] = 0;
+    p[16] = 1;  // percussive banks
+
+    for (unsigned b = 0; b < total_banks; ++b) {
+        uint8_t *meta = p + header_size + b * meta_size;
+        meta[32] = id.lsb & 0x7f;
+        meta[33] = id.msb & 0x7f;
+    }
+
+    uint8_t *instruments = p + header_size + total_banks * meta_size;
+    if (pt == Player_Type::OPL3) {
+        for (unsigned i = 0; i < total_banks * 128; ++i)
+            instruments[i * ins_size + 39] = 0x04;  // blank
+    }
+
+    unsigned index = (id.percussive ? 128 : 0) + id.program;
+    std::copy(record, record + size, instruments + index * ins_size);
+    return true;
+}
@@ -0,0 +1,55 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include "player.h"
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+struct Bank_Index_Bank {
+    bool percussive = false;
+    unsigned msb = 0;
+    unsigned lsb = 0;
+    std::string name;
+};
+
+struct Bank_Index_Instrument {
+    bool percussive = false;
+    unsigned msb = 0;
+    unsigned lsb = 0;
+    unsigned program = 0;
+    std::string name;
+    // location of the raw record in the bank data
+    size_t offset = 0;
+    size_t size = 0;
+};
+
+struct Bank_Index {
+    Player_Type type = Player_Type::INVALID;
+    unsigned version = 0;
+    std::vector<Bank_Index_Bank> banks;
+    // non-blank instruments only
+    std::vector<Bank_Index_Instrument> instruments;
+};
+
+// identifies the WOPL or WOPN data by its magic
+Player_Type identify_bank_data(const uint8_t *data, size_t size);
+// reads the bank and instrument names and locations, without decoding
+bool read_bank_index(const uint8_t *data, size_t size, Bank_Index &index);
+
+// finds the instruments which differ between two versions of a bank; false if
+// the banks also differ otherwise, so the whole bank has to be reloaded
+bool diff_bank_data(const uint8_t *old_data, size_t old_size,
+                    const uint8_t *new_data, size_t new_size,
+                    std::vector<Bank_Instrument_Id> &changed);
+
+// size of an instrument record in the latest version of the format
+size_t bank_instrument_size(Player_Type pt);
+// makes a bank holding a single instrument record, in the latest version
+bool make_instrument_bank(Player_Type pt, const Bank_Instrument_Id &id,
+                          const uint8_t *record, size_t size,
+                          std::vector<uint8_t> &data);
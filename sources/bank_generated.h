@@ -0,0 +1,401 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BANK_FB_BANK_H_
+#define FLATBUFFERS_GENERATED_BANK_FB_BANK_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 23 &&
+              FLATBUFFERS_VERSION_MINOR == 5 &&
+              FLATBUFFERS_VERSION_REVISION == 26,
+             "Non-compatible flatbuffers version included");
+
+namespace fb {
+namespace bank {
+
+struct Bank;
+struct BankBuilder;
+
+struct Bank_Info;
+struct Bank_InfoBuilder;
+
+struct Instrument_Info;
+struct Instrument_InfoBuilder;
+
+struct Bank FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BankBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PLAYER = 4,
+    VT_VERSION = 6,
+    VT_SOURCE_SIZE = 8,
+    VT_SOURCE_MTIME = 10,
+    VT_BANK = 12,
+    VT_INSTRUMENT = 14,
+    VT_DATA = 16
+  };
+  const ::flatbuffers::String *player() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_PLAYER);
+  }
+  uint16_t version() const {
+    return GetField<uint16_t>(VT_VERSION, 0);
+  }
+  uint64_t source_size() const {
+    return GetField<uint64_t>(VT_SOURCE_SIZE, 0);
+  }
+  int64_t source_mtime() const {
+    return GetField<int64_t>(VT_SOURCE_MTIME, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Bank_Info>> *bank() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Bank_Info>> *>(VT_BANK);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Instrument_Info>> *instrument() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Instrument_Info>> *>(VT_INSTRUMENT);
+  }
+  const ::flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_PLAYER) &&
+           verifier.VerifyString(player()) &&
+           VerifyField<uint16_t>(verifier, VT_VERSION, 2) &&
+           VerifyField<uint64_t>(verifier, VT_SOURCE_SIZE, 8) &&
+           VerifyField<int64_t>(verifier, VT_SOURCE_MTIME, 8) &&
+           VerifyOffsetRequired(verifier, VT_BANK) &&
+           verifier.VerifyVector(bank()) &&
+           verifier.VerifyVectorOfTables(bank()) &&
+           VerifyOffsetRequired(verifier, VT_INSTRUMENT) &&
+           verifier.VerifyVector(instrument()) &&
+           verifier.VerifyVectorOfTables(instrument()) &&
+           VerifyOffsetRequired(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BankBuilder {
+  typedef Bank Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_player(::flatbuffers::Offset<::flatbuffers::String> player) {
+    fbb_.AddOffset(Bank::VT_PLAYER, player);
+  }
+  void add_version(uint16_t version) {
+    fbb_.AddElement<uint16_t>(Bank::VT_VERSION, version, 0);
+  }
+  void add_source_size(uint64_t source_size) {
+    fbb_.AddElement<uint64_t>(Bank::VT_SOURCE_SIZE, source_size, 0);
+  }
+  void add_source_mtime(int64_t source_mtime) {
+    fbb_.AddElement<int64_t>(Bank::VT_SOURCE_MTIME, source_mtime, 0);
+  }
+  void add_bank(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Bank_Info>>> bank) {
+    fbb_.AddOffset(Bank::VT_BANK, bank);
+  }
+  void add_instrument(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Instrument_Info>>> instrument) {
+    fbb_.AddOffset(Bank::VT_INSTRUMENT, instrument);
+  }
+  void add_data(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(Bank::VT_DATA, data);
+  }
+  explicit BankBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Bank> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Bank>(end);
+    fbb_.Required(o, Bank::VT_PLAYER);
+    fbb_.Required(o, Bank::VT_BANK);
+    fbb_.Required(o, Bank::VT_INSTRUMENT);
+    fbb_.Required(o, Bank::VT_DATA);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Bank> CreateBank(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> player = 0,
+    uint16_t version = 0,
+    uint64_t source_size = 0,
+    int64_t source_mtime = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Bank_Info>>> bank = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<fb::bank::Instrument_Info>>> instrument = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0) {
+  BankBuilder builder_(_fbb);
+  builder_.add_source_mtime(source_mtime);
+  builder_.add_source_size(source_size);
+  builder_.add_data(data);
+  builder_.add_instrument(instrument);
+  builder_.add_bank(bank);
+  builder_.add_player(player);
+  builder_.add_version(version);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<Bank> CreateBankDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *player = nullptr,
+    uint16_t version = 0,
+    uint64_t source_size = 0,
+    int64_t source_mtime = 0,
+    const std::vector<::flatbuffers::Offset<fb::bank::Bank_Info>> *bank = nullptr,
+    const std::vector<::flatbuffers::Offset<fb::bank::Instrument_Info>> *instrument = nullptr,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto player__ = player ? _fbb.CreateString(player) : 0;
+  auto bank__ = bank ? _fbb.CreateVector<::flatbuffers::Offset<fb::bank::Bank_Info>>(*bank) : 0;
+  auto instrument__ = instrument ? _fbb.CreateVector<::flatbuffers::Offset<fb::bank::Instrument_Info>>(*instrument) : 0;
+  if (data) { _fbb.ForceVectorAlignment(data->size(), sizeof(uint8_t), 16); }
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return fb::bank::CreateBank(
+      _fbb,
+      player__,
+      version,
+      source_size,
+      source_mtime,
+      bank__,
+      instrument__,
+      data__);
+}
+
+struct Bank_Info FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef Bank_InfoBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_BANK = 6,
+    VT_PERCUSSIVE = 8
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  uint16_t bank() const {
+    return GetField<uint16_t>(VT_BANK, 0);
+  }
+  bool percussive() const {
+    return GetField<uint8_t>(VT_PERCUSSIVE, 0) != 0;
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint16_t>(verifier, VT_BANK, 2) &&
+           VerifyField<uint8_t>(verifier, VT_PERCUSSIVE, 1) &&
+           verifier.EndTable();
+  }
+};
+
+struct Bank_InfoBuilder {
+  typedef Bank_Info Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(Bank_Info::VT_NAME, name);
+  }
+  void add_bank(uint16_t bank) {
+    fbb_.AddElement<uint16_t>(Bank_Info::VT_BANK, bank, 0);
+  }
+  void add_percussive(bool percussive) {
+    fbb_.AddElement<uint8_t>(Bank_Info::VT_PERCUSSIVE, static_cast<uint8_t>(percussive), 0);
+  }
+  explicit Bank_InfoBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Bank_Info> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Bank_Info>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Bank_Info> CreateBank_Info(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    uint16_t bank = 0,
+    bool percussive = false) {
+  Bank_InfoBuilder builder_(_fbb);
+  builder_.add_name(name);
+  builder_.add_bank(bank);
+  builder_.add_percussive(percussive);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<Bank_Info> CreateBank_InfoDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    uint16_t bank = 0,
+    bool percussive = false) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return fb::bank::CreateBank_Info(
+      _fbb,
+      name__,
+      bank,
+      percussive);
+}
+
+struct Instrument_Info FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef Instrument_InfoBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_BANK = 6,
+    VT_PROGRAM = 8,
+    VT_PERCUSSIVE = 10,
+    VT_OFFSET = 12,
+    VT_SIZE = 14
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  uint16_t bank() const {
+    return GetField<uint16_t>(VT_BANK, 0);
+  }
+  uint8_t program() const {
+    return GetField<uint8_t>(VT_PROGRAM, 0);
+  }
+  bool percussive() const {
+    return GetField<uint8_t>(VT_PERCUSSIVE, 0) != 0;
+  }
+  uint32_t offset() const {
+    return GetField<uint32_t>(VT_OFFSET, 0);
+  }
+  uint16_t size() const {
+    return GetField<uint16_t>(VT_SIZE, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint16_t>(verifier, VT_BANK, 2) &&
+           VerifyField<uint8_t>(verifier, VT_PROGRAM, 1) &&
+           VerifyField<uint8_t>(verifier, VT_PERCUSSIVE, 1) &&
+           VerifyField<uint32_t>(verifier, VT_OFFSET, 4) &&
+           VerifyField<uint16_t>(verifier, VT_SIZE, 2) &&
+           verifier.EndTable();
+  }
+};
+
+struct Instrument_InfoBuilder {
+  typedef Instrument_Info Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(Instrument_Info::VT_NAME, name);
+  }
+  void add_bank(uint16_t bank) {
+    fbb_.AddElement<uint16_t>(Instrument_Info::VT_BANK, bank, 0);
+  }
+  void add_program(uint8_t program) {
+    fbb_.AddElement<uint8_t>(Instrument_Info::VT_PROGRAM, program, 0);
+  }
+  void add_percussive(bool percussive) {
+    fbb_.AddElement<uint8_t>(Instrument_Info::VT_PERCUSSIVE, static_cast<uint8_t>(percussive), 0);
+  }
+  void add_offset(uint32_t offset) {
+    fbb_.AddElement<uint32_t>(Instrument_Info::VT_OFFSET, offset, 0);
+  }
+  void add_size(uint16_t size) {
+    fbb_.AddElement<uint16_t>(Instrument_Info::VT_SIZE, size, 0);
+  }
+  explicit Instrument_InfoBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Instrument_Info> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Instrument_Info>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Instrument_Info> CreateInstrument_Info(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    uint16_t bank = 0,
+    uint8_t program = 0,
+    bool percussive = false,
+    uint32_t offset = 0,
+    uint16_t size = 0) {
+  Instrument_InfoBuilder builder_(_fbb);
+  builder_.add_offset(offset);
+  builder_.add_name(name);
+  builder_.add_size(size);
+  builder_.add_bank(bank);
+  builder_.add_percussive(percussive);
+  builder_.add_program(program);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<Instrument_Info> CreateInstrument_InfoDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    uint16_t bank = 0,
+    uint8_t program = 0,
+    bool percussive = false,
+    uint32_t offset = 0,
+    uint16_t size = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return fb::bank::CreateInstrument_Info(
+      _fbb,
+      name__,
+      bank,
+      program,
+      percussive,
+      offset,
+      size);
+}
+
+inline const fb::bank::Bank *GetBank(const void *buf) {
+  return ::flatbuffers::GetRoot<fb::bank::Bank>(buf);
+}
+
+inline const fb::bank::Bank *GetSizePrefixedBank(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<fb::bank::Bank>(buf);
+}
+
+inline const char *BankIdentifier() {
+  return "ADLB";
+}
+
+inline bool BankBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, BankIdentifier());
+}
+
+inline bool SizePrefixedBankBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, BankIdentifier(), true);
+}
+
+inline bool VerifyBankBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<fb::bank::Bank>(BankIdentifier());
+}
+
+inline bool VerifySizePrefixedBankBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<fb::bank::Bank>(BankIdentifier());
+}
+
+inline const char *BankExtension() {
+  return "adlb";
+}
+
+inline void FinishBankBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<fb::bank::Bank> root) {
+  fbb.Finish(root, BankIdentifier());
+}
+
+inline void FinishSizePrefixedBankBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<fb::bank::Bank> root) {
+  fbb.FinishSizePrefixed(root, BankIdentifier());
+}
+
+}  // namespace bank
+}  // namespace fb
+
+#endif  // FLATBUFFERS_GENERATED_BANK_FB_BANK_H_
@@ -0,0 +1,228 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bank_image.h"
+#include "bank_generated.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(_WIN32)
+#    include <sys/mman.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+struct Bank_Mapping::Impl
+{
+#if !defined(_WIN32)
+    void *addr_ = MAP_FAILED;
+    size_t length_ = 0;
+#else
+    std::vector<uint8_t> contents_;
+#endif
+    const fb::bank::Bank *bank_ = nullptr;
+};
+
+Bank_Mapping::Bank_Mapping()
+    : P(new Impl)
+{
+}
+
+Bank_Mapping::~Bank_Mapping()
+{
+    close();
+}
+
+bool Bank_Mapping::open(const char *path)
+{
+    close();
+
+    const uint8_t *base;
+    size_t length;
+
+#if !defined(_WIN32)
+    int fd = ::open(path, O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    length = st.st_size;
+    void *addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED)
+        return false;
+
+    P->addr_ = addr;
+    P->length_ = length;
+    base = (const uint8_t *)addr;
+#else
+    FILE *stream = fopen(path, "rb");
+    if (!stream)
+        return false;
+    struct stat st;
+    bool ok = fstat(fileno(stream), &st) == 0 && st.st_size > 0;
+    if (ok) {
+        length = st.st_size;
+        P->contents_.resize(length);
+        ok = fread(P->contents_.data(), 1, length, stream) == length;
+    }
+    fclose(stream);
+    if (!ok) {
+        P->contents_.clear();
+        return false;
+    }
+    base = P->contents_.data();
+#endif
+
+    flatbuffers::Verifier verifier(base, length);
+    if (!fb::bank::VerifyBankBuffer(verifier)) {
+        close();
+        return false;
+    }
+
+    P->bank_ = fb::bank::GetBank(base);
+    return true;
+}
+
+void Bank_Mapping::close()
+{
+    P->bank_ = nullptr;
+#if !defined(_WIN32)
+    if (P->addr_ != MAP_FAILED) {
+        munmap(P->addr_, P->length_);
+        P->addr_ = MAP_FAILED;
+        P->length_ = 0;
+    }
+#else
+    P->contents_.clear();
+#endif
+}
+
+const fb::bank::Bank *Bank_Mapping::bank() const
+{
+    return P->bank_;
+}
+
+const uint8_t *Bank_Mapping::data() const
+{
+    return P->bank_ ? P->bank_->data()->data() : nullptr;
+}
+
+size_t Bank_Mapping::size() const
+{
+    return P->bank_ ? P->bank_->data()->size() : 0;
+}
+
+bool Bank_Mapping::get_index(Bank_Index &index) const
+{
+    const fb::bank::Bank *bank = P->bank_;
+    if (!bank)
+        return false;
+
+    index.type = Player::type_by_name(bank->player()->c_str());
+    index.version = bank->version();
+    index.banks.clear();
+    index.instruments.clear();
+
+    index.banks.reserve(bank->bank()->size());
+    for (const fb::bank::Bank_Info *info : *bank->bank()) {
+        Bank_Index_Bank entry;
+        entry.percussive = info->percussive();
+        entry.msb = (info->bank() >> 7) & 0x7f;
+        entry.lsb = info->bank() & 0x7f;
+        if (info->name())
+            entry.name = info->name()->str();
+        index.banks.push_back(std::move(entry));
+    }
+
+    size_t data_size = bank->data()->size();
+    index.instruments.reserve(bank->instrument()->size());
+    for (const fb::bank::Instrument_Info *info : *bank->instrument()) {
+        Bank_Index_Instrument entry;
+        entry.percussive = info->percussive();
+        entry.msb = (info->bank() >> 7) & 0x7f;
+        entry.lsb = info->bank() & 0x7f;
+        entry.program = info->program() & 0x7f;
+        if (info->name())
+            entry.name = info->name()->str();
+        entry.offset = info->offset();
+        entry.size = info->size();
+        if (entry.offset + entry.size > data_size)
+            return false;
+        index.instruments.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+bool is_bank_image_file(const char *path)
+{
+    size_t length = strlen(path);
+    const char *ext = ".adlb";
+    size_t extlength = strlen(ext);
+    if (length < extlength)
+        return false;
+    path += length - extlength;
+    for (size_t i = 0; i < extlength; ++i) {
+        char c = path[i];
+        c = (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : c;
+        if (c != ext[i])
+            return false;
+    }
+    return true;
+}
+
+bool compile_bank_image(
+    const uint8_t *data, size_t size, uint64_t source_size, int64_t source_mtime,
+    std::vector<uint8_t> &image)
+{
+    Bank_Index index;
+    if (!read_bank_index(data, size, index))
+        return false;
+
+    using namespace fb::bank;
+    flatbuffers::FlatBufferBuilder builder(size + 64 * 1024);
+
+    std::vector<flatbuffers::Offset<Bank_Info>> bank_vector;
+    bank_vector.reserve(index.banks.size());
+    for (const Bank_Index_Bank &entry : index.banks) {
+        auto info = CreateBank_Info(
+            builder, builder.CreateString(entry.name),
+            (entry.msb << 7) | entry.lsb, entry.percussive);
+        bank_vector.push_back(info);
+    }
+
+    std::vector<flatbuffers::Offset<Instrument_Info>> instrument_vector;
+    instrument_vector.reserve(index.instruments.size());
+    for (const Bank_Index_Instrument &entry : index.instruments) {
+        auto info = CreateInstrument_Info(
+            builder, builder.CreateString(entry.name),
+            (entry.msb << 7) | entry.lsb, entry.program, entry.percussive,
+            entry.offset, entry.size);
+        instrument_vector.push_back(info);
+    }
+
+    builder.ForceVectorAlignment(size, sizeof(uint8_t), 16);
+    auto data_vector = builder.CreateVector(data, size);
+
+    auto bank = CreateBank(
+        builder,
+        builder.CreateString(Player::name(index.type)),
+        index.version, source_size, source_mtime,
+        builder.CreateVector(bank_vector),
+        builder.CreateVector(instrument_vector),
+        data_vector);
+    FinishBankBuffer(builder, bank);
+
+    const uint8_t *buffer = builder.GetBufferPointer();
+    image.assign(buffer, buffer + builder.GetSize());
+    return true;
+}
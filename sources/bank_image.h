@@ -0,0 +1,35 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include "bank_format.h"
+#include <vector>
+#include <memory>
+#include <stdint.h>
+
+namespace fb { namespace bank { struct Bank; } }
+
+// a compiled bank image, mapped read-only in memory
+class Bank_Mapping {
+public:
+    Bank_Mapping();
+    ~Bank_Mapping();
+    bool open(const char *path);
+    void close();
+    const fb::bank::Bank *bank() const;
+    // the embedded WOPL/WOPN data, ready for Player::load_bank_data
+    const uint8_t *data() const;
+    size_t size() const;
+    // the instrument index, as stored in the image
+    bool get_index(Bank_Index &index) const;
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+bool is_bank_image_file(const char *path);
+bool compile_bank_image(
+    const uint8_t *data, size_t size, uint64_t source_size, int64_t source_mtime,
+    std::vector<uint8_t> &image);
@@ -0,0 +1,545 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bank_library.h"
+#include "bank_format.h"
+#include "bank_image.h"
+#include "bank_cache.h"
+#include "cache_file.h"
+#include "rt_setup.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+
+Bank_Library bank_library;
+
+struct DIR_deleter { void operator()(DIR *x) { closedir(x); } };
+typedef std::unique_ptr<DIR, DIR_deleter> DIR_u;
+
+struct Library_Entry {
+    std::string path;
+    std::string name;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    Player_Type type = Player_Type::INVALID;
+    std::vector<Bank_Index_Bank> banks;
+    std::vector<Bank_Index_Instrument> instruments;
+};
+
+typedef std::vector<Library_Entry> Library_Entries;
+typedef std::shared_ptr<const Library_Entries> Library_Entries_Ptr;
+
+// how deep the scan descends under each recursive library directory
+static constexpr unsigned library_scan_max_depth = 8;
+
+static const char index_file_magic[] = "adljack-bank-library 2";
+
+struct Bank_Library::Impl
+{
+    mutable std::mutex mutex_;
+    std::vector<Bank_Library_Directory> directories_;
+    std::string index_file_;
+    // the current index, replaced as a whole when the scan updates it
+    Library_Entries_Ptr entries_;
+    std::atomic<unsigned> serial_{0};
+    std::atomic<bool> scanning_{false};
+    std::atomic<bool> quit_{false};
+    std::thread scan_thread_;
+    //
+    void publish(Library_Entries_Ptr entries);
+    Library_Entries_Ptr snapshot() const;
+    void scan_run();
+    void scan_directory(
+        const std::string &directory, unsigned depth, unsigned max_depth,
+        const std::unordered_map<std::string, const Library_Entry *> &old,
+        std::unordered_set<std::string> &seen, Library_Entries &entries, bool &changed);
+};
+
+///
+static char ascii_to_lower(char x)
+{
+    return (x >= 'A' && x <= 'Z') ? (x - 'A' + 'a') : x;
+}
+
+static bool ascii_case_contains(const std::string &text, const std::string &lower_query)
+{
+    size_t n = text.size();
+    size_t m = lower_query.size();
+    if (m > n)
+        return false;
+    for (size_t i = 0; i <= n - m; ++i) {
+        size_t j = 0;
+        while (j < m && ascii_to_lower(text[i + j]) == lower_query[j])
+            ++j;
+        if (j == m)
+            return true;
+    }
+    return false;
+}
+
+static bool is_library_file_name(const std::string &name)
+{
+    size_t pos = name.rfind('.');
+    if (pos == name.npos)
+        return false;
+    std::string ext = name.substr(pos + 1);
+    for (char &c : ext)
+        c = ascii_to_lower(c);
+    return ext == "wopl" || ext == "wopn" || ext == "adlb";
+}
+
+static std::string base_name(const std::string &path)
+{
+#if !defined(_WIN32)
+    size_t pos = path.rfind('/');
+#else
+    size_t pos = path.find_last_of("/\\");
+#endif
+    return (pos != path.npos) ? path.substr(pos + 1) : path;
+}
+
+// the paths and the names may hold any byte, so the separators of the index
+// and the backslash are written as escapes
+static std::string escape_field(const std::string &text)
+{
+    std::string result;
+    result.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+        case '\\': result += "\\\\"; break;
+        case '\t': result += "\\t"; break;
+        case '\n': result += "\\n"; break;
+        case '\r': result += "\\r"; break;
+        default: result += c; break;
+        }
+    }
+    return result;
+}
+
+static bool unescape_field(const std::string &text, std::string &result)
+{
+    result.clear();
+    result.reserve(text.size());
+    for (size_t i = 0, n = text.size(); i < n; ++i) {
+        char c = text[i];
+        if (c != '\\') {
+            result += c;
+            continue;
+        }
+        if (++i == n)
+            return false;
+        switch (text[i]) {
+        case '\\': result += '\\'; break;
+        case 't': result += '\t'; break;
+        case 'n': result += '\n'; break;
+        case 'r': result += '\r'; break;
+        default: return false;
+        }
+    }
+    return true;
+}
+
+///
+static bool read_library_entry(const std::string &path, const struct stat &st, Library_Entry &entry)
+{
+    Bank_Index index;
+
+    if (is_bank_image_file(path.c_str())) {
+        Bank_Mapping mapping;
+        if (!mapping.open(path.c_str()) || !mapping.get_index(index))
+            return false;
+    }
+    else {
+        if ((uint64_t)st.st_size > bank_file_max_size)
+            return false;
+        FILE *stream = fopen(path.c_str(), "rb");
+        if (!stream)
+            return false;
+        std::vector<uint8_t> data(st.st_size);
+        bool ok = fread(data.data(), 1, data.size(), stream) == data.size();
+        fclose(stream);
+        if (!ok || !read_bank_index(data.data(), data.size(), index))
+            return false;
+    }
+
+    entry.path = path;
+    entry.name = base_name(path);
+    entry.size = st.st_size;
+    entry.mtime = st.st_mtime;
+    entry.type = index.type;
+    entry.banks = std::move(index.banks);
+    entry.instruments = std::move(index.instruments);
+    for (Bank_Index_Instrument &ins : entry.instruments) {
+        // locations are not needed for searching
+        ins.offset = 0;
+        ins.size = 0;
+    }
+    return true;
+}
+
+static bool load_index_file(const std::string &path, Library_Entries &entries)
+{
+    Library_Entry *entry = nullptr;
+
+    auto parse_line = [&](const std::vector<std::string> &fields) -> bool {
+        const std::string &tag = fields[0];
+        if (tag == "F" && fields.size() == 5) {
+            entries.emplace_back();
+            entry = &entries.back();
+            entry->size = std::stoull(fields[1]);
+            entry->mtime = std::stoll(fields[2]);
+            entry->type = (Player_Type)std::stoi(fields[3]);
+            if ((unsigned)entry->type >= player_type_count)
+                return false;
+            if (!unescape_field(fields[4], entry->path))
+                return false;
+            entry->name = base_name(entry->path);
+        }
+        else if (tag == "B" && fields.size() == 5 && entry) {
+            Bank_Index_Bank bank;
+            bank.percussive = fields[1] == "1";
+            bank.msb = std::stoi(fields[2]);
+            bank.lsb = std::stoi(fields[3]);
+            if (!unescape_field(fields[4], bank.name))
+                return false;
+            entry->banks.push_back(std::move(bank));
+        }
+        else if (tag == "I" && fields.size() == 6 && entry) {
+            Bank_Index_Instrument ins;
+            ins.percussive = fields[1] == "1";
+            ins.msb = std::stoi(fields[2]);
+            ins.lsb = std::stoi(fields[3]);
+            ins.program = std::stoi(fields[4]);
+            if (!unescape_field(fields[5], ins.name))
+                return false;
+            entry->instruments.push_back(std::move(ins));
+        }
+        else if (fields.size() > 1 || !tag.empty())
+            return false;
+        return true;
+    };
+
+    try {
+        if (read_cache_file(path, index_file_magic, parse_line))
+            return true;
+    }
+    catch (std::exception &) {
+        // malformed numbers
+    }
+    entries.clear();
+    return false;
+}
+
+static bool save_index_file(const std::string &path, const Library_Entries &entries)
+{
+    std::string temp = path + ".tmp";
+    FILE *stream = fopen(temp.c_str(), "wb");
+    if (!stream)
+        return false;
+
+    fprintf(stream, "%s\n", index_file_magic);
+    for (const Library_Entry &entry : entries) {
+        fprintf(stream, "F\t%llu\t%lld\t%d\t%s\n",
+                (unsigned long long)entry.size, (long long)entry.mtime,
+                (int)entry.type, escape_field(entry.path).c_str());
+        for (const Bank_Index_Bank &bank : entry.banks)
+            fprintf(stream, "B\t%d\t%u\t%u\t%s\n", bank.percussive,
+                    bank.msb, bank.lsb, escape_field(bank.name).c_str());
+        for (const Bank_Index_Instrument &ins : entry.instruments)
+            fprintf(stream, "I\t%d\t%u\t%u\t%u\t%s\n", ins.percussive,
+                    ins.msb, ins.lsb, ins.program, escape_field(ins.name).c_str());
+    }
+
+    bool ok = !ferror(stream);
+    ok = fclose(stream) == 0 && ok;
+#if defined(_WIN32)
+    remove(path.c_str());
+#endif
+    ok = ok && rename(temp.c_str(), path.c_str()) == 0;
+    if (!ok)
+        remove(temp.c_str());
+    return ok;
+}
+
+///
+Bank_Library::Bank_Library()
+    : P(new Impl)
+{
+}
+
+Bank_Library::~Bank_Library()
+{
+    stop();
+}
+
+void Bank_Library::set_directories(const std::vector<Bank_Library_Directory> &dirs)
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->directories_ = dirs;
+}
+
+void Bank_Library::set_index_file(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->index_file_ = path;
+}
+
+void Bank_Library::start()
+{
+    stop();
+    P->quit_ = false;
+    P->scanning_ = true;
+    P->scan_thread_ = std::thread([this]() { P->scan_run(); });
+}
+
+void Bank_Library::stop()
+{
+    P->quit_ = true;
+    if (P->scan_thread_.joinable())
+        P->scan_thread_.join();
+    P->scanning_ = false;
+}
+
+bool Bank_Library::scanning() const
+{
+    return P->scanning_;
+}
+
+size_t Bank_Library::file_count() const
+{
+    Library_Entries_Ptr entries = P->snapshot();
+    return entries ? entries->size() : 0;
+}
+
+unsigned Bank_Library::serial() const
+{
+    return P->serial_;
+}
+
+void Bank_Library::search(
+    const std::string &query, Player_Type type,
+    std::vector<Bank_Library_Match> &results, size_t max) const
+{
+    results.clear();
+
+    Library_Entries_Ptr entries = P->snapshot();
+    if (!entries)
+        return;
+
+    std::string lower_query = query;
+    for (char &c : lower_query)
+        c = ascii_to_lower(c);
+
+    auto accept = [type](const Library_Entry &entry) -> bool {
+        return type == Player_Type::INVALID || entry.type == type;
+    };
+    auto bank_name_of = [](const Library_Entry &entry, bool percussive, unsigned msb, unsigned lsb) -> std::string {
+        for (const Bank_Index_Bank &bank : entry.banks)
+            if (bank.percussive == percussive && bank.msb == msb && bank.lsb == lsb)
+                return bank.name;
+        return std::string();
+    };
+
+    // files first, then banks, then instruments
+    for (const Library_Entry &entry : *entries) {
+        if (results.size() >= max)
+            return;
+        if (!accept(entry) || !ascii_case_contains(entry.name, lower_query))
+            continue;
+        Bank_Library_Match match;
+        match.path = entry.path;
+        match.type = entry.type;
+        if (!entry.banks.empty())
+            match.bank_name = entry.banks.front().name;
+        results.push_back(std::move(match));
+    }
+
+    for (const Library_Entry &entry : *entries) {
+        if (!accept(entry))
+            continue;
+        for (const Bank_Index_Bank &bank : entry.banks) {
+            if (results.size() >= max)
+                return;
+            if (bank.name.empty() || !ascii_case_contains(bank.name, lower_query))
+                continue;
+            Bank_Library_Match match;
+            match.path = entry.path;
+            match.type = entry.type;
+            match.bank_name = bank.name;
+            match.percussive = bank.percussive;
+            match.msb = bank.msb;
+            match.lsb = bank.lsb;
+            results.push_back(std::move(match));
+        }
+    }
+
+    if (lower_query.empty())
+        return;
+
+    for (const Library_Entry &entry : *entries) {
+        if (!accept(entry))
+            continue;
+        for (const Bank_Index_Instrument &ins : entry.instruments) {
+            if (results.size() >= max)
+                return;
+            if (!ascii_case_contains(ins.name, lower_query))
+                continue;
+            Bank_Library_Match match;
+            match.path = entry.path;
+            match.type = entry.type;
+            match.bank_name = bank_name_of(entry, ins.percussive, ins.msb, ins.lsb);
+            match.instrument_name = ins.name;
+            match.is_instrument = true;
+            match.percussive = ins.percussive;
+            match.msb = ins.msb;
+            match.lsb = ins.lsb;
+            match.program = ins.program;
+            results.push_back(std::move(match));
+        }
+    }
+}
+
+///
+void Bank_Library::Impl::publish(Library_Entries_Ptr entries)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_ = std::move(entries);
+    ++serial_;
+}
+
+Library_Entries_Ptr Bank_Library::Impl::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_;
+}
+
+void Bank_Library::Impl::scan_run()
+{
+    rt_setup_worker_thread();
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::vector<Bank_Library_Directory> directories = directories_;
+    std::string index_file = index_file_;
+    Library_Entries_Ptr current = entries_;
+    lock.unlock();
+
+    if (!current && !index_file.empty()) {
+        std::shared_ptr<Library_Entries> loaded(new Library_Entries);
+        if (load_index_file(index_file, *loaded)) {
+            current = loaded;
+            publish(current);
+        }
+    }
+
+    std::unordered_map<std::string, const Library_Entry *> old;
+    if (current) {
+        for (const Library_Entry &entry : *current)
+            old[entry.path] = &entry;
+    }
+
+    std::shared_ptr<Library_Entries> entries(new Library_Entries);
+    entries->reserve(old.size());
+    std::unordered_set<std::string> seen;
+    bool changed = false;
+
+    for (const Bank_Library_Directory &directory : directories) {
+        if (quit_)
+            break;
+        unsigned max_depth = directory.recursive ? library_scan_max_depth : 1;
+        scan_directory(directory.path, 0, max_depth, old, seen, *entries, changed);
+    }
+
+    if (!quit_) {
+        // files which disappeared since the last scan
+        changed = changed || entries->size() != old.size();
+        if (changed) {
+            publish(entries);
+            if (!index_file.empty())
+                save_index_file(index_file, *entries);
+        }
+    }
+
+    scanning_ = false;
+}
+
+void Bank_Library::Impl::scan_directory(
+    const std::string &directory, unsigned depth, unsigned max_depth,
+    const std::unordered_map<std::string, const Library_Entry *> &old,
+    std::unordered_set<std::string> &seen, Library_Entries &entries, bool &changed)
+{
+    DIR_u dir(opendir(directory.c_str()));
+    if (!dir)
+        return;
+
+    std::vector<std::string> subdirs;
+
+    while (dirent *ent = readdir(dir.get())) {
+        if (quit_)
+            return;
+
+        const char *name = ent->d_name;
+        if (name[0] == '.')
+            continue;
+
+        std::string path = directory;
+        if (path.empty() || path.back() != '/')
+            path.push_back('/');
+        path.append(name);
+
+        struct stat st;
+        if (stat(path.c_str(), &st) == -1)
+            continue;
+
+        if (S_ISDIR(st.st_mode)) {
+            if (depth + 1 < max_depth)
+                subdirs.push_back(path);
+            continue;
+        }
+
+        if (!S_ISREG(st.st_mode) || !is_library_file_name(name))
+            continue;
+        if (!seen.insert(path).second)
+            continue;
+
+        auto it = old.find(path);
+        if (it != old.end()) {
+            const Library_Entry &entry = *it->second;
+            if (entry.size == (uint64_t)st.st_size && entry.mtime == (int64_t)st.st_mtime) {
+                entries.push_back(entry);
+                continue;
+            }
+        }
+
+        Library_Entry entry;
+        if (read_library_entry(path, st, entry)) {
+            entries.push_back(std::move(entry));
+            changed = true;
+        }
+    }
+
+    dir.reset();
+
+    for (const std::string &subdir : subdirs)
+        scan_directory(subdir, depth + 1, max_depth, old, seen, entries, changed);
+}
+
+///
+std::vector<std::string> default_bank_library_directories()
+{
+    std::vector<std::string> dirs;
+#if defined(ADLJACK_PREFIX)
+    dirs.push_back(ADLJACK_PREFIX "/share/adljack/wopl_files");
+    dirs.push_back(ADLJACK_PREFIX "/share/adljack/wopn_files");
+#endif
+    return dirs;
+}
@@ -0,0 +1,63 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include "player.h"
+#include <string>
+#include <vector>
+#include <memory>
+
+struct Bank_Library_Match {
+    std::string path;
+    Player_Type type = Player_Type::INVALID;
+    std::string bank_name;
+    // for matches on an instrument, otherwise empty
+    std::string instrument_name;
+    bool is_instrument = false;
+    bool percussive = false;
+    unsigned msb = 0;
+    unsigned lsb = 0;
+    unsigned program = 0;
+};
+
+struct Bank_Library_Directory {
+    std::string path;
+    // whether the scan descends into the subdirectories
+    bool recursive;
+};
+
+// index of the banks and instruments found in the library directories,
+// kept up to date by a background scan
+class Bank_Library {
+public:
+    Bank_Library();
+    ~Bank_Library();
+
+    void set_directories(const std::vector<Bank_Library_Directory> &dirs);
+    // file where the index persists across runs, empty for none
+    void set_index_file(const std::string &path);
+
+    // loads the saved index, then refreshes it in the background
+    void start();
+    void stop();
+
+    bool scanning() const;
+    size_t file_count() const;
+    // changes every time the index is updated
+    unsigned serial() const;
+
+    // case-insensitive search over file, bank and instrument names,
+    // restricted to banks of the given type unless INVALID
+    void search(const std::string &query, Player_Type type,
+                std::vector<Bank_Library_Match> &results, size_t max) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+extern Bank_Library bank_library;
+
+std::vector<std::string> default_bank_library_directories();
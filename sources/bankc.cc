@@ -0,0 +1,196 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Bank compiler: converts WOPL/WOPN banks into memory-mappable images
+
+#include "bank_image.h"
+#include "bank_format.h"
+#include "player.h"
+#include <memory>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <getopt.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+namespace stc = std::chrono;
+
+static bool read_file(const char *path, std::vector<uint8_t> &data, struct stat &st)
+{
+    FILE *stream = fopen(path, "rb");
+    if (!stream)
+        return false;
+    bool ok = fstat(fileno(stream), &st) == 0;
+    if (ok) {
+        data.resize(st.st_size);
+        ok = fread(data.data(), 1, data.size(), stream) == data.size();
+    }
+    fclose(stream);
+    return ok;
+}
+
+// writes aside, then replaces the target: a running instance may have the
+// image mapped, and must see either the old file or the new one, complete
+static bool write_file(const char *path, const std::vector<uint8_t> &data)
+{
+    std::string temp = std::string(path) + ".tmp";
+    FILE *stream = fopen(temp.c_str(), "wb");
+    if (!stream)
+        return false;
+    bool ok = fwrite(data.data(), 1, data.size(), stream) == data.size();
+    ok = ok && fflush(stream) == 0;
+#if defined(_WIN32)
+    ok = ok && _commit(fileno(stream)) == 0;
+#else
+    ok = ok && fsync(fileno(stream)) == 0;
+#endif
+    ok = fclose(stream) == 0 && ok;
+#if defined(_WIN32)
+    ok = ok && (remove(path) == 0 || errno == ENOENT);
+#endif
+    ok = ok && rename(temp.c_str(), path) == 0;
+    if (!ok)
+        remove(temp.c_str());
+    return ok;
+}
+
+static bool compare_instruments(
+    const uint8_t *src, const Bank_Index &src_index,
+    const uint8_t *img, const Bank_Index &img_index)
+{
+    if (src_index.type != img_index.type || src_index.version != img_index.version)
+        return false;
+    if (src_index.banks.size() != img_index.banks.size() ||
+        src_index.instruments.size() != img_index.instruments.size())
+        return false;
+    for (size_t i = 0, n = src_index.instruments.size(); i < n; ++i) {
+        const Bank_Index_Instrument &a = src_index.instruments[i];
+        const Bank_Index_Instrument &b = img_index.instruments[i];
+        if (a.percussive != b.percussive || a.msb != b.msb || a.lsb != b.lsb ||
+            a.program != b.program || a.name != b.name || a.size != b.size ||
+            memcmp(src + a.offset, img + b.offset, a.size) != 0) {
+            fprintf(stderr, "Instrument mismatch: %s bank %u:%u program %u\n",
+                    a.percussive ? "percussion" : "melodic", a.msb, a.lsb, a.program);
+            return false;
+        }
+    }
+    return true;
+}
+
+static double benchmark_load(Player &player, unsigned count, const char *source, const char *image)
+{
+    stc::steady_clock::time_point t1 = stc::steady_clock::now();
+    for (unsigned i = 0; i < count; ++i) {
+        if (!player.load_bank_file(source))
+            return -1;
+    }
+    stc::steady_clock::time_point t2 = stc::steady_clock::now();
+    for (unsigned i = 0; i < count; ++i) {
+        Bank_Mapping mapping;
+        if (!mapping.open(image) || !player.load_bank_data(mapping.data(), mapping.size()))
+            return -1;
+    }
+    stc::steady_clock::time_point t3 = stc::steady_clock::now();
+
+    double d_source = stc::duration<double>(t2 - t1).count() / count;
+    double d_image = stc::duration<double>(t3 - t2).count() / count;
+    fprintf(stderr, "Load time: source %f ms, image %f ms\n", d_source * 1e3, d_image * 1e3);
+    return d_image;
+}
+
+static void usage()
+{
+    fprintf(stderr, "Usage:\n    adlbankc [-b count] bank.wopl|bank.wopn [output.adlb]\n");
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned bench_count = 0;
+
+    for (int c; (c = getopt(argc, argv, "hb:")) != -1;) {
+        switch (c) {
+        case 'b':
+            bench_count = std::stoi(optarg);
+            break;
+        case 'h':
+            usage();
+            return 0;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    if (argc - optind < 1 || argc - optind > 2) {
+        usage();
+        return 1;
+    }
+
+    const char *source_path = argv[optind];
+    std::string image_path;
+    if (argc - optind == 2)
+        image_path = argv[optind + 1];
+    else {
+        image_path = source_path;
+        size_t pos = image_path.rfind('.');
+        if (pos != image_path.npos && image_path.find_first_of("/\\", pos) == image_path.npos)
+            image_path.resize(pos);
+        image_path += ".adlb";
+    }
+
+    std::vector<uint8_t> source;
+    struct stat st;
+    if (!read_file(source_path, source, st)) {
+        fprintf(stderr, "Cannot read the bank file '%s'.\n", source_path);
+        return 1;
+    }
+
+    std::vector<uint8_t> image;
+    if (!compile_bank_image(source.data(), source.size(), st.st_size, st.st_mtime, image)) {
+        fprintf(stderr, "Invalid bank file '%s'.\n", source_path);
+        return 1;
+    }
+
+    if (!write_file(image_path.c_str(), image)) {
+        fprintf(stderr, "Cannot write the image file '%s'.\n", image_path.c_str());
+        return 1;
+    }
+
+    // check the image against the original instruments
+    Bank_Mapping mapping;
+    Bank_Index source_index;
+    Bank_Index image_index;
+    if (!mapping.open(image_path.c_str()) || !mapping.get_index(image_index) ||
+        !read_bank_index(source.data(), source.size(), source_index) ||
+        mapping.size() != source.size() ||
+        memcmp(mapping.data(), source.data(), source.size()) != 0 ||
+        !compare_instruments(source.data(), source_index, mapping.data(), image_index)) {
+        fprintf(stderr, "Verification of the image file '%s' failed.\n", image_path.c_str());
+        return 1;
+    }
+    mapping.close();
+
+    fprintf(stderr, "%s: %zu banks, %zu instruments, %zu bytes\n", image_path.c_str(),
+            image_index.banks.size(), image_index.instruments.size(), image.size());
+
+    if (bench_count > 0) {
+        std::unique_ptr<Player> player(Player::create(source_index.type, 44100));
+        if (!player || benchmark_load(*player, bench_count, source_path, image_path.c_str()) < 0) {
+            fprintf(stderr, "Benchmark failed.\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "cache_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+std::string cache_file_path(const char *name)
+{
+    std::string dir;
+    if (const char *cache_dir = getenv("XDG_CACHE_HOME"))
+        dir = cache_dir;
+    if (dir.empty()) {
+        const char *home_dir = getenv("HOME");
+        if (!home_dir || !home_dir[0])
+            return std::string();
+        dir = std::string(home_dir) + "/.cache";
+    }
+    dir += "/adljack";
+
+    for (size_t pos = 1; pos <= dir.size(); ++pos) {
+        if (pos < dir.size() && dir[pos] != '/')
+            continue;
+        std::string sub = dir.substr(0, pos);
+        struct stat st;
+        if (stat(sub.c_str(), &st) == 0)
+            continue;
+#if !defined(_WIN32)
+        if (mkdir(sub.c_str(), 0755) == -1)
+#else
+        if (mkdir(sub.c_str()) == -1)
+#endif
+            return std::string();
+    }
+
+    return dir + '/' + name;
+}
+
+bool read_cache_file(const std::string &path, const char *magic,
+                     const std::function<bool(const std::vector<std::string> &)> &callback)
+{
+    FILE *stream = fopen(path.c_str(), "rb");
+    if (!stream)
+        return false;
+
+    std::string text;
+    char buf[8192];
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), stream)) > 0;)
+        text.append(buf, n);
+    fclose(stream);
+
+    std::vector<std::string> fields;
+    bool first = true;
+
+    for (size_t start = 0, end; start < text.size(); start = end + 1) {
+        end = text.find('\n', start);
+        if (end == text.npos)
+            end = text.size();
+        std::string line = text.substr(start, end - start);
+
+        if (first) {
+            if (line != magic)
+                return false;
+            first = false;
+            continue;
+        }
+
+        fields.clear();
+        for (size_t pos = 0, next; ; pos = next + 1) {
+            next = line.find('\t', pos);
+            fields.push_back(line.substr(pos, next - pos));
+            if (next == line.npos)
+                break;
+        }
+
+        if (!callback(fields))
+            return false;
+    }
+
+    return !first;
+}
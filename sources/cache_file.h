@@ -0,0 +1,18 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+
+// path of a file in the user cache directory, which is created if needed
+std::string cache_file_path(const char *name);
+
+// reads a file made of a magic line, then of lines of fields separated by
+// tabs, and passes the fields of each line in turn; fails if the file cannot
+// be read, if the magic differs, or if the callback returns false
+bool read_cache_file(const std::string &path, const char *magic,
+                     const std::function<bool(const std::vector<std::string> &)> &callback);
@@ -0,0 +1,195 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "calibration.h"
+#include "cache_file.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+namespace stc = std::chrono;
+
+static const char emulator_costs_magic[] = "adljack-costs 1";
+
+struct Emulator_Cost {
+    Player_Type player;
+    unsigned emulator;
+    // seconds per frame
+    double base;
+    double per_chip;
+};
+
+// set up at startup, before the interface reads them
+static std::vector<Emulator_Cost> emulator_costs;
+
+// the chip counts of the measure, and the frames timed at each
+static constexpr unsigned calibration_chips_low = 1;
+static constexpr unsigned calibration_chips_high = 4;
+static constexpr unsigned calibration_frames = 1024;
+static constexpr unsigned calibration_rate = 48000;
+
+static std::string cpu_model()
+{
+    std::string model;
+#if defined(__linux__)
+    FILE *stream = fopen("/proc/cpuinfo", "r");
+    if (stream) {
+        char line[256];
+        while (model.empty() && fgets(line, sizeof(line), stream)) {
+            if (strncmp(line, "model name", 10))
+                continue;
+            const char *value = strchr(line, ':');
+            if (!value)
+                continue;
+            model = value + 1 + (value[1] == ' ');
+            while (!model.empty() && (model.back() == '\n' || model.back() == ' '))
+                model.pop_back();
+        }
+        fclose(stream);
+    }
+#endif
+    if (model.empty())
+        model = "unknown";
+    return model;
+}
+
+static Emulator_Cost *find_cost(Player_Type pt, unsigned emulator)
+{
+    for (Emulator_Cost &cost : emulator_costs) {
+        if (cost.player == pt && cost.emulator == emulator)
+            return &cost;
+    }
+    return nullptr;
+}
+
+static bool load_costs(const std::string &path, const std::string &model)
+{
+    Player_Type current = Player_Type::INVALID;
+
+    return read_cache_file(path, emulator_costs_magic, [&](const std::vector<std::string> &fields) -> bool {
+        if (fields[0] == "K" && fields.size() == 2) {
+            // the measures are valid only on the same CPU model
+            if (fields[1] != model)
+                return false;
+        }
+        else if (fields[0] == "T" && fields.size() == 3) {
+            current = Player::type_by_name(fields[1].c_str());
+            if (current != Player_Type::INVALID && fields[2] != Player::version(current))
+                current = Player_Type::INVALID;
+        }
+        else if (fields[0] == "E" && fields.size() == 4) {
+            if (current == Player_Type::INVALID)
+                return true;
+            Emulator_Cost cost;
+            cost.player = current;
+            cost.emulator = strtoul(fields[1].c_str(), nullptr, 10);
+            cost.base = strtod(fields[2].c_str(), nullptr);
+            cost.per_chip = strtod(fields[3].c_str(), nullptr);
+            if (!find_cost(cost.player, cost.emulator))
+                emulator_costs.push_back(cost);
+        }
+        return true;
+    });
+}
+
+static bool save_costs(const std::string &path, const std::string &model)
+{
+    FILE *stream = fopen(path.c_str(), "wb");
+    if (!stream)
+        return false;
+
+    fprintf(stream, "%s\n", emulator_costs_magic);
+    fprintf(stream, "K\t%s\n", model.c_str());
+    for (Player_Type pt : all_player_types) {
+        fprintf(stream, "T\t%s\t%s\n", Player::name(pt), Player::version(pt));
+        for (const Emulator_Cost &cost : emulator_costs) {
+            if (cost.player == pt)
+                fprintf(stream, "E\t%u\t%.6g\t%.6g\n", cost.emulator, cost.base, cost.per_chip);
+        }
+    }
+
+    bool ok = !ferror(stream);
+    return fclose(stream) == 0 && ok;
+}
+
+// the time to render a frame, the best of a few renders with notes held
+static double time_render(Player_Type pt, unsigned emulator, unsigned chips)
+{
+    std::unique_ptr<Player> player(Player::create(pt, calibration_rate));
+    if (!player || !player->set_emulator(emulator) || !player->set_chip_count(chips))
+        return -1;
+
+    for (unsigned i = 0, n = 9 * chips; i < n; ++i)
+        player->rt_note_on(i % 16, 48 + i % 36, 100);
+
+    Player::Audio_Format format;
+    format.type = ADLMIDI_SampleType_F32;
+    format.containerSize = sizeof(float);
+    format.sampleOffset = 2 * sizeof(float);
+    float buffer[2 * 256];
+
+    double best = -1;
+    for (unsigned run = 0; run < 3; ++run) {
+        stc::steady_clock::time_point t1 = stc::steady_clock::now();
+        for (unsigned i = 0; i < calibration_frames; i += 256)
+            player->generate(256, &buffer[0], &buffer[1], format);
+        stc::steady_clock::time_point t2 = stc::steady_clock::now();
+        double d = stc::duration<double>(t2 - t1).count() / calibration_frames;
+        best = (best < 0) ? d : std::min(best, d);
+    }
+    return best;
+}
+
+bool calibrate_emulator_costs(const std::string &cache_path, double max_seconds)
+{
+    std::string model = cpu_model();
+    emulator_costs.clear();
+    if (!cache_path.empty() && !load_costs(cache_path, model))
+        emulator_costs.clear();
+
+    stc::steady_clock::time_point start = stc::steady_clock::now();
+    bool complete = true;
+    bool measured = false;
+
+    for (Player_Type pt : all_player_types) {
+        for (const Player::Emulator &emu : Player::enumerate_emulators(pt)) {
+            if (find_cost(pt, emu.id))
+                continue;
+            if (stc::duration<double>(stc::steady_clock::now() - start).count() > max_seconds) {
+                complete = false;
+                continue;
+            }
+
+            double low = time_render(pt, emu.id, calibration_chips_low);
+            double high = time_render(pt, emu.id, calibration_chips_high);
+            if (low < 0 || high < 0)
+                continue;
+
+            Emulator_Cost cost;
+            cost.player = pt;
+            cost.emulator = emu.id;
+            cost.per_chip = std::max(0.0, (high - low) / (calibration_chips_high - calibration_chips_low));
+            cost.base = std::max(0.0, low - cost.per_chip * calibration_chips_low);
+            emulator_costs.push_back(cost);
+            measured = true;
+        }
+    }
+
+    if (measured && !cache_path.empty())
+        save_costs(cache_path, model);
+
+    return complete;
+}
+
+double predicted_emulator_load(Player_Type pt, unsigned emulator, unsigned chips, unsigned sample_rate)
+{
+    const Emulator_Cost *cost = find_cost(pt, emulator);
+    if (!cost)
+        return -1;
+    return (cost->base + cost->per_chip * chips) * sample_rate;
+}
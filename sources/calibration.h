@@ -0,0 +1,22 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include "player.h"
+#include <string>
+
+// A model of the cost of the emulators, as the time to render a frame: a
+// fixed part and a part per chip, each measured by a short render at one
+// and at several chips. The measures are kept in the cache file, for the
+// same CPU model and library versions, and only the emulators missing from
+// it are measured again, within the allowed time.
+
+// loads the cache and measures what it lacks; returns false if some
+// emulators are left without a measure, for lack of time
+bool calibrate_emulator_costs(const std::string &cache_path, double max_seconds);
+
+// the predicted fraction of the real time to render with the emulator, or
+// a negative value if it was not measured
+double predicted_emulator_load(Player_Type pt, unsigned emulator, unsigned chips, unsigned sample_rate);
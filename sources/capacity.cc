@@ -0,0 +1,76 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "capacity.h"
+#include "cache_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char capacity_profile_magic[] = "adljack-capacity 1";
+
+bool Capacity_Profile::load(const std::string &path)
+{
+    entries.clear();
+
+    return read_cache_file(path, capacity_profile_magic, [this](const std::vector<std::string> &fields) -> bool {
+        if (fields[0] == "R" && fields.size() == 4) {
+            sample_rate = strtoul(fields[1].c_str(), nullptr, 10);
+            period = strtoul(fields[2].c_str(), nullptr, 10);
+            margin = strtod(fields[3].c_str(), nullptr);
+        }
+        else if (fields[0] == "C" && fields.size() == 7) {
+            Capacity_Entry entry;
+            entry.player = Player::type_by_name(fields[1].c_str());
+            if (entry.player == Player_Type::INVALID || fields[2] != Player::version(entry.player))
+                return true;
+            entry.emulator = fields[3];
+            entry.chips = strtoul(fields[4].c_str(), nullptr, 10);
+            entry.voices = strtoul(fields[5].c_str(), nullptr, 10);
+            entry.load = strtod(fields[6].c_str(), nullptr);
+            if (entry.chips > 0)
+                entries.push_back(entry);
+        }
+        return true;
+    });
+}
+
+bool Capacity_Profile::save(const std::string &path) const
+{
+    FILE *stream = fopen(path.c_str(), "wb");
+    if (!stream)
+        return false;
+
+    fprintf(stream, "%s\n", capacity_profile_magic);
+    fprintf(stream, "R\t%u\t%u\t%.3f\n", sample_rate, period, margin);
+    for (const Capacity_Entry &entry : entries) {
+        fprintf(stream, "C\t%s\t%s\t%s\t%u\t%u\t%.3f\n",
+                Player::name(entry.player), Player::version(entry.player),
+                entry.emulator.c_str(), entry.chips, entry.voices, entry.load);
+    }
+
+    bool ok = !ferror(stream);
+    return fclose(stream) == 0 && ok;
+}
+
+const Capacity_Entry *Capacity_Profile::find(Player_Type pt, const char *emulator) const
+{
+    for (const Capacity_Entry &entry : entries) {
+        if (entry.player == pt && entry.emulator == emulator)
+            return &entry;
+    }
+    return nullptr;
+}
+
+void Capacity_Profile::set(const Capacity_Entry &entry)
+{
+    for (Capacity_Entry &other : entries) {
+        if (other.player == entry.player && other.emulator == entry.emulator) {
+            other = entry;
+            return;
+        }
+    }
+    entries.push_back(entry);
+}
@@ -0,0 +1,36 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include "player.h"
+#include <string>
+#include <vector>
+
+// The capacity of this host for each emulator, as measured by adlstress:
+// the chips and the voices which render within the period, with margin.
+// The chip count of the profile is the default when none is configured.
+
+struct Capacity_Entry {
+    Player_Type player = Player_Type::INVALID;
+    std::string emulator;
+    unsigned chips = 0;
+    unsigned voices = 0;
+    // the load of the period at this capacity, 99th percentile
+    double load = 0;
+};
+
+struct Capacity_Profile {
+    // the conditions of the measure
+    unsigned sample_rate = 0;
+    unsigned period = 0;
+    double margin = 0;
+    std::vector<Capacity_Entry> entries;
+
+    // the entries measured with another library version are ignored
+    bool load(const std::string &path);
+    bool save(const std::string &path) const;
+    const Capacity_Entry *find(Player_Type pt, const char *emulator) const;
+    void set(const Capacity_Entry &entry);
+};
@@ -4,9 +4,20 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include "common.h"
+#include "resampler.h"
+#include "rt_setup.h"
+#include "log_queue.h"
+#include "recorder.h"
+#include "journal.h"
+#include "midi_file.h"
+#include "capacity.h"
+#include "calibration.h"
+#include "bank_cache.h"
 #include "tui.h"
 #include "i18n.h"
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include <thread>
 #include <chrono>
 #include <stdexcept>
@@ -14,11 +25,13 @@
 #include <cmath>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
 #include <signal.h>
 #include <unistd.h>
-#if defined(ADLJACK_HAVE_MLOCKALL)
-#    include <sys/mman.h>
-#endif
+#include <sys/types.h>
+#include <sys/stat.h>
 #if defined(ADLJACK_GTK3)
 #   include "gtk_tray.h"
 #endif
@@ -31,12 +44,36 @@ namespace stc = std::chrono;
 
 std::unique_ptr<Player> player[player_type_count];
 std::string player_bank_file[player_type_count];
+static unsigned player_sample_rate = 0;
+// the rate of rendering for each player type, when it is not the host rate,
+// and the conversion to the host rate
+static unsigned player_render_rate[player_type_count] = {};
+static Resampler player_resampler[player_type_count];
+// the settings of the render rate
+static std::string render_rate_setting = "host";
+static Resampler_Quality resampler_quality = Resampler_Quality::Medium;
+// a new host rate, to apply on the interface thread
+static std::atomic<unsigned> pending_sample_rate{0};
+// rendering as fast as possible, not in real time
+static std::atomic<bool> bulk_mode_enabled{false};
+// the cycles of the audio thread, odd while one is in course
+static std::atomic<unsigned> audio_cycle_serial{0};
+// a player released in bulk mode, which the processing thread deletes
+static std::atomic<Player *> player_to_release{nullptr};
+// emulators of the player types, to restore when creating them again
+static unsigned player_emulator[player_type_count];
+static bool release_inactive = false;
+// TPDF dither of the 16-bit output
+static bool output_dither = true;
+static Record_Format record_format = Record_Format::WAV;
+static std::string record_directory;
+static uint64_t record_max_size = 0;
 int player_opl_embedded_bank_id = -1;
 
 IniProcessing configFile;
 
 std::vector<Emulator_Id> emulator_ids;
-unsigned active_emulator_id = (unsigned)-1;
+std::atomic<unsigned> active_emulator_id{(unsigned)-1};
 
 int player_volume = 100;
 DcFilter dcfilter[2];
@@ -47,15 +84,30 @@ Program channel_map[16];
 unsigned midi_channel_note_count[16] = {};
 std::bitset<128> midi_channel_note_active[16];
 unsigned midi_channel_last_note_p1[16] = {};
+static uint8_t midi_channel_note_velocity[16][128] = {};
+static uint8_t midi_channel_controller[16][128];
+static unsigned midi_channel_pitchbend[16];
+static unsigned midi_channel_rpn[16];
+static unsigned midi_channel_bend_sensitivity[16];
 static unsigned sysex_device_id = 0x10;
-static constexpr unsigned sysex_broadcast_id = 0x7f;
+static std::bitset<128> midi_channel_note_sustained[16];
+static uint8_t midi_mode_sysex[midi_mode_sysex_max];
+static unsigned midi_mode_sysex_size = 0;
+bool midi_coalesce_enabled = false;
+Midi_Coalescer midi_coalescer;
 
 std::unique_ptr<Ring_Buffer> fifo_notify;
+static std::unique_ptr<Ring_Buffer> fifo_sysex;
+static constexpr unsigned fifo_sysex_size = 256 * sizeof(Sysex_Block *);
 
 Player_Type arg_player_type = Player_Type::OPL3;
 unsigned arg_nchip = default_nchip;
 const char *arg_bankfile = nullptr;
 std::string arg_config_file;
+std::string arg_journal_file;
+std::string arg_midi_file;
+double arg_midi_file_speed = 1;
+bool arg_midi_file_loop = false;
 unsigned arg_emulator = 0;
 bool arg_autoconnect = false;
 #if defined(ADLJACK_USE_CURSES)
@@ -74,7 +126,7 @@ static unsigned channels_update_left;
 void generic_usage(const char *progname, const char *more_options)
 {
     std::string usage_string =
-        _("Usage:\n    %s [-p player] [-n num-chips] [-b bank.wopl] [-e emulator] [-v volume percent] [-a]");
+        _("Usage:\n    %s [-p player] [-n num-chips] [-b bank.wopl] [-e emulator] [-v volume percent] [-a] [-j journal] [-f file.mid [-s speed] [-l]]");
 #if defined(ADLJACK_USE_CURSES)
     usage_string += " [-t]";
 #endif
@@ -98,7 +150,7 @@ void generic_usage(const char *progname, const char *more_options)
 
 int generic_getopt(int argc, char *argv[], const char *more_options, void(&usagefn)())
 {
-    const char *basic_optstr = "hp:n:b:e:v:a"
+    const char *basic_optstr = "hp:n:b:e:v:aj:f:s:l"
 #if defined(ADLJACK_USE_CURSES)
         "t"
 #endif
@@ -134,6 +186,22 @@ int generic_getopt(int argc, char *argv[], const char *more_options, void(&usage
         case 'a':
             arg_autoconnect = true;
             break;
+        case 'j':
+            arg_journal_file = optarg;
+            break;
+        case 'f':
+            arg_midi_file = optarg;
+            break;
+        case 's':
+            arg_midi_file_speed = std::atof(optarg);
+            if (!(arg_midi_file_speed > 0)) {
+                fprintf(stderr, "%s\n", _("Invalid speed of the MIDI file."));
+                exit(1);
+            }
+            break;
+        case 'l':
+            arg_midi_file_loop = true;
+            break;
         case 'v':
             player_volume = std::stoi(optarg);
             if (player_volume < 0 || player_volume > volume_max) {
@@ -167,6 +235,219 @@ void load_config()
     configFile.open(arg_config_file);
 }
 
+// sets up a new player with the saved bank
+static bool setup_player(Player &player, bool quiet)
+{
+    Player_Type pt = player.type();
+    bool success = true;
+
+    if (!player.set_embedded_bank(0)) {
+        qfprintf(quiet, stderr, "%s\n", _("Error setting default bank."));
+        success = false;
+    }
+
+    player.set_soft_pan_enabled(1);
+
+    const std::string &bank_file = ::player_bank_file[(unsigned)pt];
+    if (pt == Player_Type::OPL3 && ::player_opl_embedded_bank_id >= 0) {
+        if (!player.set_embedded_bank(::player_opl_embedded_bank_id)) {
+            qfprintf(quiet, stderr, "%s\n", _("Error setting saved embedded bank id for player."));
+            success = false;
+        }
+    }
+    else if (!bank_file.empty() && !player.load_bank(bank_file.c_str())) {
+        qfprintf(quiet, stderr, "%s\n", _("Error loading saved bank file for player."));
+        success = false;
+    }
+
+    return success;
+}
+
+Player *require_player(Player_Type pt)
+{
+    if (Player *player = ::player[(unsigned)pt].get())
+        return player;
+
+    unsigned render_rate = ::player_render_rate[(unsigned)pt];
+    std::unique_ptr<Player> player(Player::create(pt, render_rate ? render_rate : ::player_sample_rate));
+    if (!player)
+        return nullptr;
+    setup_player(*player, true);
+
+    unsigned emulator = ::player_emulator[(unsigned)pt];
+    if (emulator != (unsigned)-1)
+        player->set_emulator(emulator);
+
+    ::player[(unsigned)pt] = std::move(player);
+    return ::player[(unsigned)pt].get();
+}
+
+// releases a player which is not the active one; the audio thread may still
+// hold it, if it took it before the switch, until the end of its cycle
+static void release_player(Player_Type pt)
+{
+    std::unique_ptr<Player> &slot = ::player[(unsigned)pt];
+    if (!slot)
+        return;
+
+    ::player_emulator[(unsigned)pt] = slot->emulator();
+    std::unique_ptr<Player> player(std::move(slot));
+
+    unsigned serial = ::audio_cycle_serial.load();
+    if (!(serial & 1))
+        return;  // no cycle in course, the next ones see the switch
+
+    if (bulk_mode()) {
+        // the processing thread does not wait, it deletes at its next cycle
+        Player *expected = nullptr;
+        while (!::player_to_release.compare_exchange_weak(expected, player.get())) {
+            expected = nullptr;
+            std::this_thread::sleep_for(stc::milliseconds(1));
+        }
+        player.release();
+        // unless the cycle has ended meanwhile, and may not come back
+        if (::audio_cycle_serial.load() != serial)
+            player.reset(::player_to_release.exchange(nullptr));
+        return;
+    }
+
+    while (::audio_cycle_serial.load() == serial)
+        std::this_thread::sleep_for(stc::milliseconds(1));
+}
+
+const char *player_emulator_name(Player_Type pt)
+{
+    if (Player *player = ::player[(unsigned)pt].get())
+        return player->emulator_name();
+
+    unsigned emulator = ::player_emulator[(unsigned)pt];
+    for (const Player::Emulator &e : Player::enumerate_emulators(pt))
+        if (e.id == emulator)
+            return e.name;
+    Player::Emulator e = Player::default_emulator(pt);
+    return e ? e.name : "";
+}
+
+void set_player_emulator(Player_Type pt, unsigned emulator)
+{
+    ::player_emulator[(unsigned)pt] = emulator;
+    if (Player *player = ::player[(unsigned)pt].get())
+        player->set_emulator(emulator);
+}
+
+static unsigned render_rate_for(Player_Type pt, unsigned sample_rate)
+{
+    const std::string &setting = ::render_rate_setting;
+    unsigned rate = 0;
+    if (setting == "native")
+        rate = Player::native_sample_rate(pt);
+    else if (setting != "host")
+        rate = std::strtoul(setting.c_str(), nullptr, 10);
+    return (rate == sample_rate) ? 0 : rate;
+}
+
+// sets up all the processing which depends on the host rate
+static void setup_sample_rate(unsigned sample_rate)
+{
+    ::player_sample_rate = sample_rate;
+
+    for (unsigned i = 0; i < player_type_count; ++i) {
+        unsigned rate = render_rate_for((Player_Type)i, sample_rate);
+        ::player_render_rate[i] = rate;
+        if (rate)
+            ::player_resampler[i].setup(rate, sample_rate, ::resampler_quality, resampler_block_size);
+    }
+
+    for (unsigned i = 0; i < 2; ++i) {
+        dcfilter[i].cutoff(dccutoff / sample_rate);
+        lvmonitor[i].release(lvrelease * sample_rate);
+    }
+
+    ::channels_update_frames = std::ceil(channels_update_delay * sample_rate);
+    ::channels_update_left = ::channels_update_frames;
+}
+
+// locks the buffers of the audio processing which the engine allocates; the
+// state internal to the synthesizers cannot be reached, except by locking all
+static void lock_engine_memory()
+{
+    switch (rt_settings().memory_lock) {
+    case Rt_Memory_Lock::None:
+        break;
+    case Rt_Memory_Lock::All:
+        rt_lock_all_memory();
+        break;
+    case Rt_Memory_Lock::Engine: {
+        rt_lock_memory(::sysex_pool.memory(), ::sysex_pool.memory_size());
+        for (unsigned i = 0; i < player_type_count; ++i) {
+            if (::player_render_rate[i])
+                ::player_resampler[i].for_each_buffer(rt_lock_memory);
+        }
+        rt_lock_memory(&::midi_coalescer, sizeof(::midi_coalescer));
+        rt_lock_memory(::midi_channel_note_active, sizeof(::midi_channel_note_active));
+        rt_lock_memory(::midi_channel_note_sustained, sizeof(::midi_channel_note_sustained));
+        rt_lock_memory(::midi_mode_sysex, sizeof(::midi_mode_sysex));
+        rt_lock_memory(::midi_channel_controller, sizeof(::midi_channel_controller));
+        rt_lock_memory(::midi_channel_note_velocity, sizeof(::midi_channel_note_velocity));
+        rt_lock_memory(::channel_map, sizeof(::channel_map));
+        break;
+    }
+    }
+}
+
+void notify_sample_rate_change(unsigned sample_rate)
+{
+    ::pending_sample_rate.store(sample_rate);
+}
+
+void handle_sample_rate_change()
+{
+    unsigned sample_rate = ::pending_sample_rate.exchange(0);
+    if (sample_rate == 0 || sample_rate == ::player_sample_rate)
+        return;
+
+    Player_Type active_pt = (Player_Type)active_player_index();
+
+    // the inactive players are created again on next use
+    for (unsigned i = 0; i < player_type_count; ++i) {
+        Player_Type pt = (Player_Type)i;
+        Player *player = ::player[i].get();
+        if (pt != active_pt && player) {
+            unsigned rate = render_rate_for(pt, sample_rate);
+            if (player->sample_rate() != (rate ? rate : sample_rate))
+                release_player(pt);
+        }
+    }
+
+    // the active one is prepared aside, and keeps its notes
+    Player &player = active_player();
+    unsigned rate = render_rate_for(active_pt, sample_rate);
+    if (!player.dynamic_set_sample_rate(rate ? rate : sample_rate, ::midi_tracking))
+        debug_printf("Error changing the sample rate of the player.\n");
+
+    // the files have the rate in their header
+    if (::recorder.active()) {
+        stop_recording();
+        const char *text = _("Recording stopped.");
+        notify(Notify_Status, (const uint8_t *)text, strlen(text));
+    }
+
+    {
+        auto lock = player.take_lock();
+        auto lock2 = player.setBusy();
+        setup_sample_rate(sample_rate);
+    }
+    ::midi_file_source.set_sample_rate(sample_rate);
+    journal_control(Journal_Control::Sample_Rate, sample_rate);
+    lock_engine_memory();
+    if (::output_latency_changed)
+        ::output_latency_changed();
+
+    char text[64];
+    int len = snprintf(text, sizeof(text), _("Sample rate changed to %u Hz"), sample_rate);
+    notify(Notify_Status, (const uint8_t *)text, std::min<unsigned>(len, sizeof(text) - 1));
+}
+
 bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, const char *bankfile, unsigned emulator, bool quiet)
 {
     configFile.beginGroup("synth");
@@ -179,27 +460,33 @@ bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, con
 
     ::player_opl_embedded_bank_id = configFile.value("opl-embedded-bank", -1).toInt();
 
-#if defined(ADLJACK_HAVE_MLOCKALL)
-    if(mlockall(MCL_CURRENT|MCL_FUTURE) == -1)
-        qfprintf(quiet, stderr, _("Error locking memory."));
-#endif
+    // bank cache capacity in KiB
+    unsigned bank_cache_kb = configFile.value("bank-cache-size", (unsigned)(bank_cache_default_capacity / 1024)).toUInt();
+    ::bank_cache.set_capacity((size_t)bank_cache_kb * 1024);
 
-    ::fifo_notify.reset(new Ring_Buffer(fifo_notify_size));
+    Rt_Settings rt;
+    rt.priority = configFile.value("rt-priority", 0).toInt();
+    rt.audio_cpus = configFile.value("rt-audio-cpus", "").toString();
+    rt.worker_cpus = configFile.value("rt-worker-cpus", "").toString();
+    rt.memory_lock = rt_memory_lock_by_name(
+        configFile.value("lock-memory", "all").toString().c_str(), Rt_Memory_Lock::All);
+    rt_configure(rt);
+    ::bank_cache.set_thread_setup(&rt_setup_worker_thread);
 
-    for (unsigned i = 0; i < player_type_count; ++i) {
-        Player_Type pt = (Player_Type)i;
-        Player *player = Player::create(pt, sample_rate);
-        if (!player) {
-            qfprintf(quiet, stderr, "%s\n", _("Error instantiating player."));
-            return false;
-        }
-        ::player[i].reset(player);
+    ::fifo_notify.reset(new Ring_Buffer(fifo_notify_size));
+    ::fifo_sysex.reset(new Ring_Buffer(fifo_sysex_size));
 
-        if (!player->set_embedded_bank(0))
-            qfprintf(quiet, stderr, "%s\n", _("Error setting default bank."));
+    stc::steady_clock::time_point time_start = stc::steady_clock::now();
 
-        player->set_soft_pan_enabled(1);
+    // the emulator catalogue, from the cache of a previous run if possible
+    bool emulator_cache = configFile.value("emulator-cache", true).toBool();
+    std::string emulator_cache_file = emulator_cache ? cache_file_path("emulators.cache") : std::string();
+    if (!emulator_cache_file.empty() &&
+        !Player::load_emulator_catalog(emulator_cache_file.c_str()))
+        Player::save_emulator_catalog(emulator_cache_file.c_str());
 
+    for (unsigned i = 0; i < player_type_count; ++i) {
+        Player_Type pt = (Player_Type)i;
         for (const Player::Emulator &e : Player::enumerate_emulators(pt)) {
             Emulator_Id id { pt, e.id, std::string(e.name) };
             emulator_ids.push_back(id);
@@ -207,20 +494,52 @@ bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, con
 
         std::string bankname_field = "bankfile-" + std::to_string(i);
         player_bank_file[i] = configFile.value(bankname_field.c_str(), player_bank_file[i]).toString();
+    }
 
-        if(pt == Player_Type::OPL3 && ::player_opl_embedded_bank_id >= 0) {
-            if (!::player[i]->set_embedded_bank(::player_opl_embedded_bank_id)) {
-                qfprintf(quiet, stderr, "%s\n", _("Error setting saved embedded bank id for player."));
-                return 1;
-            }
-        }
-        else if (!player_bank_file[i].empty() && !::player[i]->load_bank_file(player_bank_file[i].c_str()))
-        {
-            qfprintf(quiet, stderr, "%s\n", _("Error loading saved bank file for player."));
-            return 1;
-        }
+    stc::steady_clock::time_point time_catalog = stc::steady_clock::now();
+
+    // the cost model of the emulators, measured once for this machine
+    if (configFile.value("cost-calibration", true).toBool()) {
+        std::string costs_cache_file = emulator_cache ? cache_file_path("costs.cache") : std::string();
+        if (!calibrate_emulator_costs(costs_cache_file, 0.5))
+            qfprintf(quiet, stderr, "%s\n", _("The calibration of the emulators continues at the next start."));
     }
 
+    stc::steady_clock::time_point time_calibration = stc::steady_clock::now();
+
+    // the players render at the host rate, or at a fixed rate then converted
+    ::render_rate_setting = configFile.value("render-rate", "host").toString();
+    ::resampler_quality = resampler_quality_by_name(
+        configFile.value("resampler-quality", "medium").toString().c_str());
+    setup_sample_rate(sample_rate);
+    if (unsigned rate = ::player_render_rate[(unsigned)pt])
+        qfprintf(quiet, stderr, _("Rendering at %u Hz, resampled with %s quality\n"),
+                 rate, resampler_quality_name(::resampler_quality));
+
+    // only the active player is created now, the others on first use
+    ::release_inactive = configFile.value("release-inactive-players", false).toBool();
+    ::midi_coalesce_enabled = configFile.value("coalesce-controllers", false).toBool();
+    log_start(configFile.value("log-output", "syslog").toString());
+    ::output_dither = configFile.value("dither", true).toBool();
+    ::record_format = record_format_by_name(
+        configFile.value("record-format", "wav").toString().c_str(), Record_Format::WAV);
+    ::record_directory = configFile.value("record-directory", "").toString();
+    ::record_max_size = (uint64_t)configFile.value("record-max-size", 0).toUInt() * 1024 * 1024;
+    std::fill(::player_emulator, ::player_emulator + player_type_count, (unsigned)-1);
+    ::player_emulator[(unsigned)pt] = emulator;
+
+    unsigned active_rate = ::player_render_rate[(unsigned)pt];
+    Player *active = Player::create(pt, active_rate ? active_rate : sample_rate);
+    if (!active) {
+        qfprintf(quiet, stderr, "%s\n", _("Error instantiating player."));
+        return false;
+    }
+    ::player[(unsigned)pt].reset(active);
+
+    stc::steady_clock::time_point time_create = stc::steady_clock::now();
+
+    setup_player(*active, quiet);
+
     auto emulator_id_pos = std::find(
         emulator_ids.begin(), emulator_ids.end(),
         Emulator_Id{ pt, emulator, "" });
@@ -248,7 +567,7 @@ bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, con
         qfprintf(quiet, stderr, "%s\n", _("Using default banks."));
     }
     else {
-        if (!player.load_bank_file(bankfile)) {
+        if (!player.load_bank(bankfile)) {
             qfprintf(quiet, stderr, "%s\n", _("Error loading bank file."));
             return 1;
         }
@@ -256,6 +575,21 @@ bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, con
         ::player_bank_file[(unsigned)pt] = bankfile;
     }
 
+    stc::steady_clock::time_point time_banks = stc::steady_clock::now();
+
+    // without a count given, the capacity of the host for the emulator
+    if (!has_nchip_arg && !configFile.hasKey("nchip")) {
+        Capacity_Profile profile;
+        const Capacity_Entry *entry = nullptr;
+        if (profile.load(cache_file_path("capacity.profile")))
+            entry = profile.find(pt, player.emulator_name());
+        if (entry) {
+            nchip = entry->chips;
+            qfprintf(quiet, stderr, _("Using %u chips from the capacity profile, for a period of %u frames\n"),
+                     nchip, profile.period);
+        }
+    }
+
     if (!player.set_chip_count(nchip)) {
         qfprintf(quiet, stderr, "%s\n", _("Error setting the number of chips."));
         return 1;
@@ -265,105 +599,125 @@ bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, con
         player.set_channel_alloc_mode(configFile.value("chanalloc", -1).toInt());
     }
 
+    qfprintf(quiet, stderr, _("Startup: emulators %.1f ms, calibration %.1f ms, player %.1f ms, banks %.1f ms\n"),
+             stc::duration<double, std::milli>(time_catalog - time_start).count(),
+             stc::duration<double, std::milli>(time_calibration - time_catalog).count(),
+             stc::duration<double, std::milli>(time_create - time_calibration).count(),
+             stc::duration<double, std::milli>(time_banks - time_create).count());
+
     qfprintf(quiet, stderr, _("DC filter @ %f Hz, LV monitor @ %f ms\n"), dccutoff, lvrelease * 1e3);
-    for (unsigned i = 0; i < 2; ++i) {
-        dcfilter[i].cutoff(dccutoff / sample_rate);
-        lvmonitor[i].release(lvrelease * sample_rate);
-    }
 
-    ::channels_update_frames = std::ceil(channels_update_delay * sample_rate);
-    ::channels_update_left = ::channels_update_frames;
+    lock_engine_memory();
 
     configFile.endGroup();
 
+    if (!::arg_journal_file.empty()) {
+        // what the replay needs to set the engine up the same way
+        Journal_Settings settings;
+        settings.emplace_back("pt", std::to_string((unsigned)pt));
+        settings.emplace_back("emulator", std::to_string(player.emulator()));
+        settings.emplace_back("nchip", std::to_string(player.chip_count()));
+        settings.emplace_back("volume", std::to_string(::player_volume));
+        settings.emplace_back("chanalloc", std::to_string(player.get_channel_alloc_mode()));
+        settings.emplace_back("opl-embedded-bank", std::to_string(::player_opl_embedded_bank_id));
+        for (unsigned i = 0; i < player_type_count; ++i) {
+            settings.emplace_back("bankfile-" + std::to_string(i), ::player_bank_file[i]);
+            // the replay checks that the file is still the same
+            Bank_Image_Ptr image;
+            if (Player *p = ::player[i].get())
+                image = p->bank_image();
+            else if (!::player_bank_file[i].empty())
+                image = ::bank_cache.load(::player_bank_file[i].c_str());
+            settings.emplace_back("bankhash-" + std::to_string(i), journal_bank_hash(image.get()));
+        }
+        settings.emplace_back("render-rate", ::render_rate_setting);
+        settings.emplace_back("resampler-quality", resampler_quality_name(::resampler_quality));
+        settings.emplace_back("coalesce-controllers", ::midi_coalesce_enabled ? "true" : "false");
+        settings.emplace_back("release-inactive-players", ::release_inactive ? "true" : "false");
+        if (journal_start(::arg_journal_file, sample_rate, settings))
+            qfprintf(quiet, stderr, _("Journal of the input in \"%s\"\n"), ::arg_journal_file.c_str());
+    }
+
+    if (!::arg_midi_file.empty()) {
+        if (!::midi_file_source.open(::arg_midi_file)) {
+            qfprintf(quiet, stderr, _("Cannot play the MIDI file \"%s\".\n"), ::arg_midi_file.c_str());
+            return false;
+        }
+        ::midi_file_source.start(sample_rate, ::arg_midi_file_speed, ::arg_midi_file_loop);
+        qfprintf(quiet, stderr, _("Playing the MIDI file \"%s\", %.1f s at speed %g%s\n"),
+                 ::arg_midi_file.c_str(), ::midi_file_source.duration(), ::arg_midi_file_speed,
+                 ::arg_midi_file_loop ? _(", looping") : "");
+    }
+
     return true;
 }
 
 void player_ready(bool quiet)
 {
+    rt_report(quiet);
+
     Player &player = active_player();
     qfprintf(quiet, stderr, _("%s ready with %u chips.\n"),
              Player::name(player.type()), player.chip_count());
 }
 
-void play_midi(const uint8_t *msg, unsigned len)
+static void defer_sysex(const Midi_Event &event);
+
+static Midi_Tracking init_midi_tracking()
 {
+    for (unsigned channel = 0; channel < 16; ++channel) {
+        std::fill_n(::midi_channel_controller[channel], 128, 0xff);
+        ::midi_channel_pitchbend[channel] = 8192;
+        ::midi_channel_rpn[channel] = 0x3fff;
+        ::midi_channel_bend_sensitivity[channel] = (unsigned)-1;
+    }
+
+    Midi_Tracking tk;
+    tk.note_count = ::midi_channel_note_count;
+    tk.note_active = ::midi_channel_note_active;
+    tk.note_sustained = ::midi_channel_note_sustained;
+    tk.last_note_p1 = ::midi_channel_last_note_p1;
+    tk.program = ::channel_map;
+    tk.note_velocity = ::midi_channel_note_velocity;
+    tk.controller = ::midi_channel_controller;
+    tk.pitchbend = ::midi_channel_pitchbend;
+    tk.rpn = ::midi_channel_rpn;
+    tk.bend_sensitivity = ::midi_channel_bend_sensitivity;
+    tk.sysex_device_id = ::sysex_device_id;
+    tk.mode_sysex = ::midi_mode_sysex;
+    tk.mode_sysex_size = &::midi_mode_sysex_size;
+    tk.other_sysex = &defer_sysex;
+    return tk;
+}
+
+const Midi_Tracking midi_tracking = init_midi_tracking();
+
+void play_midi_events(Midi_Event *events, size_t count)
+{
+    if (count <= 0)
+        return;
+
+    // no events are lost when not in real time
+    bool bulk = bulk_mode();
     Player &player = active_player();
-    auto lock = player.take_lock(std::try_to_lock);
+    auto lock = bulk ? player.take_lock() : player.take_lock(std::try_to_lock);
     if (!lock.owns_lock())
         return;
 
-    if (len <= 0)
-        return;
+    journal_events(events, count);
 
-    uint8_t status = msg[0];
-    if (status == 0xf0)
-        return play_sysex(msg, len);
-
-    uint8_t channel = status & 0x0f;
-    switch (status >> 4) {
-    case 0b1001: {
-        if (len < 3) break;
-        unsigned vel = msg[2] & 0x7f;
-        if (vel != 0) {
-            unsigned note = msg[1] & 0x7f;
-            player.rt_note_on(channel, note, vel);
-            if (!midi_channel_note_active[channel][note]) {
-                ++midi_channel_note_count[channel];
-                midi_channel_note_active[channel][note] = true;
-            }
-            midi_channel_last_note_p1[channel] = note + 1;
-            break;
-        }
-    }
-    case 0b1000: {
-        if (len < 3) break;
-        unsigned note = msg[1] & 0x7f;
-        player.rt_note_off(channel, note);
-        if (midi_channel_note_active[channel][note]) {
-            --midi_channel_note_count[channel];
-            midi_channel_note_active[channel][note] = false;
-        }
-        break;
-    }
-    case 0b1010:
-        if (len < 3) break;
-        player.rt_note_aftertouch(channel, msg[1] & 0x7f, msg[2] & 0x7f);
-        break;
-    case 0b1101:
-        if (len < 2) break;
-        player.rt_channel_aftertouch(channel, msg[1] & 0x7f);
-        break;
-    case 0b1011: {
-        if (len < 3) break;
-        unsigned cc = msg[1] & 0x7f;
-        unsigned val = msg[2] & 0x7f;
-        player.rt_controller_change(channel, cc, val);
-        if (cc == 120 || cc == 123) {
-            midi_channel_note_count[channel] = 0;
-            midi_channel_note_active[channel].reset();
-        }
-        else if (cc == 0) {
-            channel_map[channel].bank_msb = val;
-        }
-        else if (cc == 32) {
-            channel_map[channel].bank_lsb = val;
-        }
-        break;
-    }
-    case 0b1100: {
-        if (len < 2) break;
-        unsigned pgm = msg[1] & 0x7f;
-        player.rt_program_change(channel, pgm);
-        channel_map[channel].gm = pgm;
-        break;
-    }
-    case 0b1110:
-        if (len < 3) break;
-        unsigned value = (msg[1] & 0x7f) | ((msg[2] & 0x7f) << 7);
-        player.rt_pitchbend(channel, value);
-        break;
-    }
+    if (::midi_coalesce_enabled)
+        count = ::midi_coalescer.process(events, count);
+
+    player.rt_events(events, count, ::midi_tracking);
+}
+
+void play_midi(const uint8_t *msg, unsigned len)
+{
+    Midi_Event event;
+    event.size = len;
+    event.data = msg;
+    play_midi_events(&event, 1);
 }
 
 static void play_roland_sysex(unsigned address, const uint8_t *data, unsigned len)
@@ -380,17 +734,80 @@ static void play_roland_sc_sysex(unsigned address, const uint8_t *data, unsigned
     }
 }
 
+void play_midi_events_and_release(Midi_Event *events, size_t count)
+{
+    // the coalescing compacts the events, so note the blocks beforehand
+    Sysex_Block *blocks[midi_events_max];
+    unsigned nblocks = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (events[i].block)
+            blocks[nblocks++] = events[i].block;
+    }
+    play_midi_events(events, count);
+    for (unsigned i = 0; i < nblocks; ++i)
+        Sysex_Pool::release(blocks[i]);
+}
+
 void play_sysex(const uint8_t *msg, unsigned len)
 {
-    if (len < 4 || msg[0] != 0xf0 || msg[len - 1] != 0xf7 ||
-        (msg[2] != sysex_device_id && msg[2] != sysex_broadcast_id))
+    if (len <= 0 || msg[0] != 0xf0)
         return;
+    play_midi(msg, len);
+}
 
-    Player &player = active_player();
+static void defer_sysex(const Midi_Event &event)
+{
+    Ring_Buffer *fifo = ::fifo_sysex.get();
+    if (!fifo)
+        return;
+
+    // a message passed by reference is shared, otherwise copied to the pool
+    Sysex_Block *block = event.block;
+    if (block)
+        Sysex_Pool::retain(block);
+    else if (!(block = ::sysex_pool.store(event.data, event.size)))
+        return;
+
+    if (!fifo->put(block))
+        Sysex_Pool::release(block);
+}
+
+// F0 7D <device> 01 <percussive> <msb> <lsb> <program> <record> F7
+//   sets an instrument from a WOPL/WOPN record of the latest version,
+//   each byte of the record sent as two nibbles, the high one first
+static void play_adljack_sysex(const uint8_t *data, unsigned len)
+{
+    if (len < 1)
+        return;
+
+    switch (data[0]) {
+    case 0x01: {
+        if (len < 5 || ((len - 5) & 1) || !have_active_player())
+            break;
+        Bank_Instrument_Id id;
+        id.percussive = data[1] & 1;
+        id.msb = data[2] & 0x7f;
+        id.lsb = data[3] & 0x7f;
+        id.program = data[4] & 0x7f;
+        std::vector<uint8_t> record((len - 5) / 2);
+        for (size_t i = 0; i < record.size(); ++i)
+            record[i] = ((data[5 + 2 * i] & 0x0f) << 4) | (data[6 + 2 * i] & 0x0f);
+        if (!active_player().dynamic_set_instrument(id, record.data(), record.size()))
+            debug_printf("Cannot set the instrument from SysEx.\n");
+        journal_control(Journal_Control::Instrument,
+                        journal_pack_instrument(id.percussive, id.msb, id.lsb, id.program),
+                        record.data(), record.size());
+        break;
+    }
+    }
+}
+
+static void play_other_sysex(const uint8_t *msg, unsigned len)
+{
     uint8_t manufacturer = msg[1];
     switch (manufacturer) {
-        case 0x7f: // Universal realtime
-            player.rt_system_exclusive(msg, len);
+        case 0x7d:  // non-commercial, for the messages specific to adljack
+            play_adljack_sysex(&msg[3], len - 4);
             break;
         case 0x41:  // Roland
             if (len < 10)
@@ -415,6 +832,19 @@ void play_sysex(const uint8_t *msg, unsigned len)
     }
 }
 
+void handle_deferred_sysex()
+{
+    Ring_Buffer *fifo = ::fifo_sysex.get();
+    if (!fifo)
+        return;
+
+    Sysex_Block *block;
+    while (fifo->get(block)) {
+        play_other_sysex(block->data, block->size);
+        Sysex_Pool::release(block);
+    }
+}
+
 bool notify(Notification_Type type, const uint8_t *data, unsigned len)
 {
     Ring_Buffer *fifo = ::fifo_notify.get();
@@ -428,13 +858,11 @@ bool notify(Notification_Type type, const uint8_t *data, unsigned len)
     return true;
 }
 
-void generate_outputs(float *left, float *right, unsigned nframes, unsigned stride)
+static void render_outputs(float *left, float *right, unsigned nframes, unsigned stride)
 {
-    if (nframes <= 0)
-        return;
-
+    bool bulk = bulk_mode();
     Player &player = active_player();
-    auto lock = player.take_lock(std::try_to_lock);
+    auto lock = bulk ? player.take_lock() : player.take_lock(std::try_to_lock);
     if (!lock.owns_lock()) {
         for (unsigned i = 0; i < nframes; ++i) {
             float *leftp = &left[i * stride];
@@ -442,15 +870,31 @@ void generate_outputs(float *left, float *right, unsigned nframes, unsigned stri
             *leftp = 0;
             *rightp = 0;
         }
+        journal_silence(nframes);
         return;
     }
 
+    int volume = ::player_volume;
+    journal_render(nframes, volume);
+
     Player::Audio_Format format;
     format.type = ADLMIDI_SampleType_F32;
     format.containerSize = sizeof(float);
     format.sampleOffset = stride * sizeof(float);
     stc::steady_clock::time_point t_before_gen = stc::steady_clock::now();
-    player.generate(nframes, left, right, format);
+    if (!::player_render_rate[(unsigned)player.type()])
+        player.generate(nframes, left, right, format);
+    else {
+        Resampler &rs = ::player_resampler[(unsigned)player.type()];
+        format.sampleOffset = sizeof(float);
+        for (unsigned i = 0; i < nframes;) {
+            unsigned count = std::min(nframes - i, rs.max_out_frames());
+            unsigned count_in = rs.input_needed(count);
+            player.generate(count_in, rs.input_buffer(0), rs.input_buffer(1), format);
+            rs.process(count_in, &left[i * stride], &right[i * stride], count, stride);
+            i += count;
+        }
+    }
     stc::steady_clock::time_point t_after_gen = stc::steady_clock::now();
     lock.unlock();
 
@@ -458,7 +902,18 @@ void generate_outputs(float *left, float *right, unsigned nframes, unsigned stri
     DcFilter &dcrf = dcfilter[1];
     double lvcurrent[2];
 
-    const double outputgain = ::player_volume * (1.0 / 100.0) * player.output_gain();
+    const double outputgain = volume * (1.0 / 100.0) * player.output_gain();
+    if (bulk) {
+        // without the metering and the notifications
+        for (unsigned i = 0; i < nframes; ++i) {
+            float *leftp = &left[i * stride];
+            float *rightp = &right[i * stride];
+            *leftp = dclf.process(outputgain * *leftp);
+            *rightp = dcrf.process(outputgain * *rightp);
+        }
+        return;
+    }
+
     for (unsigned i = 0; i < nframes; ++i) {
         float *leftp = &left[i * stride];
         float *rightp = &right[i * stride];
@@ -475,7 +930,7 @@ void generate_outputs(float *left, float *right, unsigned nframes, unsigned stri
 
     stc::steady_clock::duration d_gen = t_after_gen - t_before_gen;
     double d_sec = 1e-6 * stc::duration_cast<stc::microseconds>(d_gen).count();
-    ::cpuratio = d_sec / ((double)nframes / player.sample_rate());
+    ::cpuratio = d_sec / ((double)nframes / ::player_sample_rate);
 
     if (::channels_update_left > nframes)
         ::channels_update_left -= nframes;
@@ -494,6 +949,176 @@ void generate_outputs(float *left, float *right, unsigned nframes, unsigned stri
     }
 }
 
+void generate_outputs(float *left, float *right, unsigned nframes, unsigned stride)
+{
+    if (nframes <= 0)
+        return;
+
+    // the messages of the file are played at their frame, cutting the block
+    if (!::midi_file_source.active())
+        render_outputs(left, right, nframes, stride);
+    else {
+        for (unsigned i = 0; i < nframes;) {
+            unsigned count = ::midi_file_source.play(nframes - i);
+            render_outputs(left + i * stride, right + i * stride, count, stride);
+            i += count;
+        }
+    }
+    ::recorder.write(left, right, nframes, stride);
+}
+
+Audio_Cycle_Guard::Audio_Cycle_Guard()
+{
+    ::audio_cycle_serial.fetch_add(1);
+}
+
+Audio_Cycle_Guard::~Audio_Cycle_Guard()
+{
+    if (::player_to_release.load(std::memory_order_relaxed))
+        delete ::player_to_release.exchange(nullptr);
+    ::audio_cycle_serial.fetch_add(1);
+}
+
+void set_bulk_mode(bool bulk)
+{
+    ::bulk_mode_enabled.store(bulk);
+}
+
+bool bulk_mode()
+{
+    return ::bulk_mode_enabled.load(std::memory_order_relaxed);
+}
+
+unsigned output_latency()
+{
+    Player_Type pt = (Player_Type)active_player_index();
+    if (!::player_render_rate[(unsigned)pt])
+        return 0;
+    return std::ceil(::player_resampler[(unsigned)pt].latency());
+}
+
+void (*output_latency_changed)() = nullptr;
+
+bool start_recording()
+{
+    char name[64];
+    time_t now = time(nullptr);
+    strftime(name, sizeof(name), "adljack-%Y%m%d-%H%M%S", localtime(&now));
+
+    std::string path = ::record_directory;
+    if (!path.empty() && path.back() != '/')
+        path += '/';
+    path += name;
+
+    return ::recorder.start(path, ::player_sample_rate, ::record_format, ::record_max_size);
+}
+
+void stop_recording()
+{
+    ::recorder.stop();
+}
+
+Sample_Format sample_format_by_name(const char *name, Sample_Format def)
+{
+    if (!strcmp(name, "f32"))
+        return Sample_Format::F32;
+    if (!strcmp(name, "s16"))
+        return Sample_Format::S16;
+    if (!strcmp(name, "s32"))
+        return Sample_Format::S32;
+    return def;
+}
+
+const char *sample_format_name(Sample_Format format)
+{
+    switch (format) {
+    default: assert(false);
+    case Sample_Format::F32: return "f32";
+    case Sample_Format::S16: return "s16";
+    case Sample_Format::S32: return "s32";
+    }
+}
+
+size_t sample_format_size(Sample_Format format)
+{
+    switch (format) {
+    default: assert(false);
+    case Sample_Format::F32: return sizeof(float);
+    case Sample_Format::S16: return sizeof(int16_t);
+    case Sample_Format::S32: return sizeof(int32_t);
+    }
+}
+
+// scales and rounds to integer with saturation, adding the dither in units
+// of the least significant bit
+template <class T>
+static void convert_samples(const float *in, const float *dither, T *out, unsigned nframes, unsigned stride)
+{
+    const float scale = -(float)std::numeric_limits<T>::min();
+    const float lo = (float)std::numeric_limits<T>::min();
+    // the largest float which does not overflow the integer
+    float hi = (float)std::numeric_limits<T>::max();
+    if ((double)hi > (double)std::numeric_limits<T>::max())
+        hi = std::nextafter(hi, 0.0f);
+    for (unsigned i = 0; i < nframes; ++i) {
+        float x = in[i] * scale + dither[i];
+        x = std::max(lo, std::min(hi, x));
+        out[i * stride] = (T)(x + (x >= 0 ? 0.5f : -0.5f));
+    }
+}
+
+// triangular noise, the sum of two uniform variables of 1 LSB
+static void generate_tpdf(float *out, unsigned nframes)
+{
+    static uint32_t seed = 1;
+    uint32_t x = seed;
+    const float unit = 1.0f / 4294967296.0f;
+    for (unsigned i = 0; i < nframes; ++i) {
+        x = x * 1664525u + 1013904223u;
+        float a = x * unit;
+        x = x * 1664525u + 1013904223u;
+        float b = x * unit;
+        out[i] = a - b;
+    }
+    seed = x;
+}
+
+void generate_outputs(Sample_Format format, void *left, void *right, unsigned nframes, unsigned stride)
+{
+    if (format == Sample_Format::F32)
+        return generate_outputs((float *)left, (float *)right, nframes, stride);
+
+    // rendered in float, converted after the processing
+    constexpr unsigned block_size = 256;
+    float buffer[2][block_size];
+    float dither[block_size];
+
+    bool need_dither = ::output_dither && format == Sample_Format::S16;
+    if (!need_dither)
+        std::fill_n(dither, block_size, 0.0f);
+
+    size_t sample_size = sample_format_size(format);
+    for (unsigned i = 0; i < nframes;) {
+        unsigned count = std::min(nframes - i, block_size);
+        generate_outputs(buffer[0], buffer[1], count, 1);
+
+        uint8_t *outputs[2] = {
+            (uint8_t *)left + i * stride * sample_size,
+            (uint8_t *)right + i * stride * sample_size,
+        };
+        for (unsigned c = 0; c < 2; ++c) {
+            if (need_dither)
+                generate_tpdf(dither, count);
+            if (format == Sample_Format::S16)
+                convert_samples(buffer[c], dither, (int16_t *)outputs[c], count, stride);
+            else
+                convert_samples(buffer[c], dither, (int32_t *)outputs[c], count, stride);
+        }
+
+        i += count;
+    }
+}
+
 void dynamic_switch_emulator_id(unsigned index)
 {
     if (index == active_emulator_id)
@@ -502,28 +1127,43 @@ void dynamic_switch_emulator_id(unsigned index)
     Emulator_Id old_id = emulator_ids[active_emulator_id];
     Emulator_Id new_id  = emulator_ids[index];
 
-    Player &player = active_player();
-    auto lock = player.take_lock();
-    auto lock2 = player.setBusy();
+    // create the new player first, without interrupting the audio
+    Player *new_player = require_player(new_id.player);
+    if (!new_player)
+        return;
 
-    player.panic();
-    if (old_id.player == new_id.player) {
-        player.set_emulator(new_id.emulator);
-    }
-    else {
-        Player &new_player = *::player[(unsigned)new_id.player];
-        new_player.set_emulator(new_id.emulator);
-        new_player.set_chip_count(player.chip_count());
-        new_player.set_channel_alloc_mode(player.get_channel_alloc_mode());
-        // transmit bank change and program change events
-        for (unsigned channel = 0; channel < 16; ++channel) {
-            new_player.rt_bank_change_msb(channel, channel_map[channel].bank_msb);
-            new_player.rt_bank_change_lsb(channel, channel_map[channel].bank_lsb);
-            new_player.rt_program_change(channel, channel_map[channel].gm);
+    {
+        Player &player = active_player();
+        auto lock = player.take_lock();
+        auto lock2 = player.setBusy();
+
+        player.panic();
+        ::player_resampler[(unsigned)new_id.player].reset();
+        if (old_id.player == new_id.player) {
+            player.set_emulator(new_id.emulator);
         }
+        else {
+            new_player->set_emulator(new_id.emulator);
+            new_player->set_chip_count(player.chip_count());
+            new_player->set_channel_alloc_mode(player.get_channel_alloc_mode());
+            // transmit bank change and program change events
+            for (unsigned channel = 0; channel < 16; ++channel) {
+                new_player->rt_bank_change_msb(channel, channel_map[channel].bank_msb);
+                new_player->rt_bank_change_lsb(channel, channel_map[channel].bank_lsb);
+                new_player->rt_program_change(channel, channel_map[channel].gm);
+            }
+        }
+
+        ::player_emulator[(unsigned)new_id.player] = new_id.emulator;
+        ::active_emulator_id = index;
     }
+    journal_control(Journal_Control::Emulator, index);
 
-    ::active_emulator_id = index;
+    if (::output_latency_changed && old_id.player != new_id.player)
+        ::output_latency_changed();
+
+    if (::release_inactive && old_id.player != new_id.player)
+        release_player(old_id.player);
 }
 
 //------------------------------------------------------------------------------
@@ -550,6 +1190,9 @@ static void simple_interface_exec(void(*idle_proc)(void *), void *idle_data)
         if (idle_proc)
             idle_proc(idle_data);
 
+        handle_deferred_sysex();
+        handle_sample_rate_change();
+
         fprintf(stderr, "\033[2K");
         double volumes[2] = {lvcurrent[0], lvcurrent[1]};
         const char *names[2] = {"Left", "Right"};
@@ -576,13 +1219,19 @@ static void simple_interface_exec(void(*idle_proc)(void *), void *idle_data)
     }
 }
 
+// whether the interface has the terminal
+static std::atomic<bool> terminal_in_use{false};
+
 void interface_exec(void(*idle_proc)(void *), void *idle_data)
 {
 #if defined(ADLJACK_USE_CURSES)
     if (arg_simple_interface)
         simple_interface_exec(idle_proc, idle_data);
-    else
+    else {
+        ::terminal_in_use = true;
         curses_interface_exec(idle_proc, idle_data);
+        ::terminal_in_use = false;
+    }
 #else
     simple_interface_exec();
 #endif
@@ -635,20 +1284,11 @@ void debug_printf(const char *fmt, ...)
     va_end(ap);
 }
 
-#if defined(_WIN32)
-void debug_vprintf(const char *fmt, va_list ap)
-{
-    char buf[256];
-    vsnprintf(buf, sizeof(buf), fmt, ap);
-    buf[sizeof(buf) - 1] = '\0';
-    OutputDebugStringA(buf);
-}
-#else
 void debug_vprintf(const char *fmt, va_list ap)
 {
-    vsyslog(LOG_INFO, fmt, ap);
+    // queued, it is safe from any thread
+    log_vprintf(fmt, ap);
 }
-#endif
 
 void qfprintf(bool q, FILE *stream, const char *fmt, ...)
 {
@@ -660,7 +1300,8 @@ void qfprintf(bool q, FILE *stream, const char *fmt, ...)
 
 void qvfprintf(bool q, FILE *stream, const char *fmt, va_list ap)
 {
-    if (q)
+    // the terminal is not for text while curses has it
+    if (q || ::terminal_in_use)
         debug_vprintf(fmt, ap);
     else
         vfprintf(stream, fmt, ap);
@@ -7,12 +7,16 @@
 #include "player.h"
 #include "dcfilter.h"
 #include "vumonitor.h"
+#include "midi_coalesce.h"
+#include "sysex_pool.h"
+#include "cache_file.h"
 #include "IniProcessor/ini_processing.h"
 #include <ring_buffer/ring_buffer.h>
 #include <getopt.h>
 #include <string>
 #include <bitset>
 #include <memory>
+#include <atomic>
 #include <adlmidi.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -43,7 +47,8 @@ inline bool operator!=(const Emulator_Id &a, const Emulator_Id &b)
     { return !operator==(a, b); }
 
 extern std::vector<Emulator_Id> emulator_ids;
-extern unsigned active_emulator_id;
+// published by the interface thread, read by the audio thread
+extern std::atomic<unsigned> active_emulator_id;
 
 inline bool have_active_player()
     { return ::active_emulator_id != (unsigned)-1; }
@@ -60,6 +65,11 @@ inline Player &active_player()
 inline std::string &active_bank_file()
     { return ::player_bank_file[active_player_index()]; }
 
+// the inactive player types are created on first use
+Player *require_player(Player_Type pt);
+const char *player_emulator_name(Player_Type pt);
+void set_player_emulator(Player_Type pt, unsigned emulator);
+
 inline int &active_opl_embedded_bank()
     { return ::player_opl_embedded_bank_id; };
 
@@ -74,23 +84,26 @@ static constexpr double lvrelease = 20e-3;
 static constexpr int volume_min = 0;
 static constexpr int volume_max = 500;
 
-struct Program {
-    unsigned gm = 0;
-    unsigned bank_msb = 0;
-    unsigned bank_lsb = 0;
-};
 extern Program channel_map[16];
 
 extern unsigned midi_channel_note_count[16];
 extern std::bitset<128> midi_channel_note_active[16];
 extern unsigned midi_channel_last_note_p1[16];
+// all the channel state updated by the MIDI events
+extern const Midi_Tracking midi_tracking;
+
+extern bool midi_coalesce_enabled;
+extern Midi_Coalescer midi_coalescer;
 
 extern std::unique_ptr<Ring_Buffer> fifo_notify;
 static constexpr unsigned fifo_notify_size = 8192;
 
 enum Notification_Type {
+    // the text sent for the display of a Roland SC
     Notify_TextInsert,
     Notify_Channels,
+    // a message about the state of the program
+    Notify_Status,
 };
 struct Notify_Header {
     Notification_Type type;
@@ -102,11 +115,19 @@ bool notify(Notification_Type type, const uint8_t *data, unsigned len);
 static constexpr unsigned default_nchip = 2;
 static constexpr unsigned midi_message_max_size = 64;
 static constexpr unsigned midi_buffer_size = 64 * 1024;
+// maximum number of events dispatched together
+static constexpr unsigned midi_events_max = 256;
+// maximum frames converted at once, when the players render at another rate
+static constexpr unsigned resampler_block_size = 256;
 
 extern Player_Type arg_player_type;
 extern unsigned arg_nchip;
 extern const char *arg_bankfile;
 extern std::string arg_config_file;
+extern std::string arg_journal_file;
+extern std::string arg_midi_file;
+extern double arg_midi_file_speed;
+extern bool arg_midi_file_loop;
 extern unsigned arg_emulator;
 extern bool arg_autoconnect;
 #if defined(ADLJACK_USE_CURSES)
@@ -120,8 +141,51 @@ void load_config();
 bool initialize_player(Player_Type pt, unsigned sample_rate, unsigned nchip, const char *bankfile, unsigned emulator, bool quiet = false);
 void player_ready(bool quiet = false);
 void play_midi(const uint8_t *msg, unsigned len);
+// plays the events of a block, at once under the player lock; the events
+// may be modified by the controller coalescing
+void play_midi_events(Midi_Event *events, size_t count);
+// plays at most midi_events_max events, then releases the blocks of the
+// sysex pool which they hold
+void play_midi_events_and_release(Midi_Event *events, size_t count);
 void play_sysex(const uint8_t *msg, unsigned len);
+// parses the system exclusive messages deferred by the audio thread
+void handle_deferred_sysex();
+// records a change of the host rate, to apply on the interface thread
+void notify_sample_rate_change(unsigned sample_rate);
+// rebuilds the players and the processing for the new host rate
+void handle_sample_rate_change();
 void generate_outputs(float *left, float *right, unsigned nframes, unsigned stride);
+// brackets a cycle of the audio thread, which may hold the active player
+// until its end; the players which are released wait for the cycle in course
+struct Audio_Cycle_Guard {
+    Audio_Cycle_Guard();
+    ~Audio_Cycle_Guard();
+    Audio_Cycle_Guard(const Audio_Cycle_Guard &) = delete;
+    Audio_Cycle_Guard &operator=(const Audio_Cycle_Guard &) = delete;
+};
+// in bulk mode, rendering is not in real time: the locks are waited on,
+// and the metering and notifications are skipped
+void set_bulk_mode(bool bulk);
+bool bulk_mode();
+// the delay added by the processing, in frames at the host rate
+unsigned output_latency();
+// called on the interface thread when the output latency changes
+extern void (*output_latency_changed)();
+// captures the output into a file named after the current time, in the
+// directory of the settings
+bool start_recording();
+void stop_recording();
+
+enum class Sample_Format {
+    F32,
+    S16,
+    S32,
+};
+Sample_Format sample_format_by_name(const char *name, Sample_Format def);
+const char *sample_format_name(Sample_Format format);
+size_t sample_format_size(Sample_Format format);
+// renders into samples of the given format, the stride counted in samples
+void generate_outputs(Sample_Format format, void *left, void *right, unsigned nframes, unsigned stride);
 
 void dynamic_switch_emulator_id(unsigned index);
 
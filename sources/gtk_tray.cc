@@ -10,12 +10,14 @@
 #include "i18n.h"
 #include "common.h"
 #include "player.h"
+#include "journal.h"
 
 #include <gtk/gtk.h>
 #include <asm/ioctls.h>
 #include <sys/select.h>
 #include <sys/ioctl.h>
 #include <termios.h>
+#include <string.h>
 
 static GtkStatusIcon *s_tray_icon = nullptr;
 static GMutex mutex_interface;
@@ -206,6 +208,7 @@ static void adl_gtk_bank_select_dialogue_real(TUI_contextP ctx)
             }
             show_status_p(ctx, _("Bank loaded!"));
             active_bank_file() = filename;
+            journal_bank_control(Journal_Control::Load_Bank, 0, filename, player->bank_image().get());
             update_bank_mtime_p(ctx);
         }
         else
@@ -245,7 +248,9 @@ static void tray_icon_open_bank(TUI_context *ctx)
 static void tray_icon_set_opl_embedded_bank(intptr_t bank_id)
 {
     ::player_opl_embedded_bank_id = bank_id;
-    active_player().dynamic_set_embedded_bank(active_bank_file().c_str(), ::player_opl_embedded_bank_id);
+    const std::string &path = active_bank_file();
+    active_player().dynamic_set_embedded_bank(path.c_str(), ::player_opl_embedded_bank_id);
+    journal_bank_control(Journal_Control::Embedded_Bank, ::player_opl_embedded_bank_id, path, active_player().bank_image().get());
     configFile.beginGroup("synth");
     configFile.setValue("opl-embedded-bank", ::player_opl_embedded_bank_id);
     configFile.endGroup();
@@ -273,6 +278,7 @@ static void tray_icon_quickVolume(intptr_t volume)
 static void tray_icon_chanAlloc(intptr_t mode)
 {
     active_player().dynamic_set_channel_alloc((int)mode);
+    journal_control(Journal_Control::Channel_Alloc, mode);
     configFile.beginGroup("synth");
     configFile.setValue("chanalloc", mode);
     configFile.endGroup();
@@ -282,7 +288,8 @@ static void tray_icon_chanAlloc(intptr_t mode)
 
 static void tray_icon_chipsNum(intptr_t chips)
 {
-    active_player().dynamic_set_chip_count((unsigned)chips);
+    active_player().dynamic_set_chip_count((unsigned)chips, ::midi_tracking);
+    journal_control(Journal_Control::Chip_Count, active_player().chip_count());
     configFile.beginGroup("synth");
     configFile.setValue("nchip", (unsigned)chips);
     configFile.endGroup();
@@ -7,6 +7,7 @@
 #include "insnames.h"
 #include "i18n.h"
 #include "common.h"
+#include "rt_setup.h"
 #include <stdio.h>
 
 static std::string program_title = "ADLhaiku";
@@ -15,14 +16,18 @@ static double arg_latency = 20e-3;  // audio latency, 20ms default
 static FILE *logstream = stderr;
 
 struct Midi_Message_Header {
-    uint8_t size;
+    unsigned size;
     double timestamp;
+    // holds the message if large, otherwise the message follows the header
+    Sysex_Block *block;
 };
 
 static void play_buffer(void *cookie, void *buffer, size_t size, const media_raw_audio_format &format)
 {
     Audio_Context &ctx = *(Audio_Context *)cookie;
     Ring_Buffer &midi_rb = *ctx.midi_rb;
+    rt_setup_audio_thread();
+    Audio_Cycle_Guard cycle;
 
     size_t nframes = size / (2 * sizeof(float));
     double fs = format.frame_rate;
@@ -42,8 +47,10 @@ static void play_buffer(void *cookie, void *buffer, size_t size, const media_raw
             midi_delta = segment_nframes * ts;
 
         Midi_Message_Header hdr;
-        uint8_t evdata[midi_message_max_size];
-        while (midi_rb.peek(hdr) && sizeof(hdr) + hdr.size <= midi_rb.size_used()) {
+        Midi_Event events[midi_events_max];
+        uint8_t evdata[midi_events_max][midi_message_max_size];
+        unsigned nevents = 0;
+        while (midi_rb.peek(hdr) && sizeof(hdr) + (hdr.block ? 0 : hdr.size) <= midi_rb.size_used()) {
             double timestamp = hdr.timestamp;
             if (!midi_stream_started) {
                 timestamp = 0;
@@ -53,10 +60,24 @@ static void play_buffer(void *cookie, void *buffer, size_t size, const media_raw
                 break;  // not yet
             midi_delta -= timestamp;
 
+            if (nevents == midi_events_max) {
+                play_midi_events_and_release(events, nevents);
+                nevents = 0;
+            }
             midi_rb.discard(sizeof(hdr));
-            midi_rb.get(evdata, hdr.size);
-            play_midi(evdata, hdr.size);
+            Midi_Event &ev = events[nevents];
+            ev.time = iframe;
+            ev.size = hdr.size;
+            ev.block = hdr.block;
+            if (hdr.block)
+                ev.data = hdr.block->data;
+            else {
+                midi_rb.get(evdata[nevents], hdr.size);
+                ev.data = evdata[nevents];
+            }
+            ++nevents;
         }
+        play_midi_events_and_release(events, nevents);
 
         generate_outputs(
             (float *)buffer + 2 * iframe,
@@ -72,23 +93,31 @@ static void play_buffer(void *cookie, void *buffer, size_t size, const media_raw
 
 static void generic_midi_event(const uint8_t *data, unsigned size, double timestamp, Audio_Context &ctx)
 {
+    // large messages are passed by reference to a block of the pool
+    Sysex_Block *block = nullptr;
     if (size > midi_message_max_size) {
-        ctx.midi_timestamp_accum += timestamp;
-        return;
+        block = ::sysex_pool.store(data, size);
+        if (!block) {
+            ctx.midi_timestamp_accum += timestamp;
+            return;
+        }
     }
+    unsigned payload_size = block ? 0 : size;
+
     Ring_Buffer &midi_rb = *ctx.midi_rb;
     Midi_Message_Header hdr;
     hdr.size = size;
     hdr.timestamp = timestamp + ctx.midi_timestamp_accum;
+    hdr.block = block;
 
     // wait for buffer space (this is non-RT!)
-    while (midi_rb.size_free() < sizeof(hdr) + size) {
+    while (midi_rb.size_free() < sizeof(hdr) + payload_size) {
         // fprintf(logstream, "MIDI buffer full!\n");
         std::this_thread::sleep_for(stc::microseconds(100));
     }
 
     midi_rb.put(hdr);
-    midi_rb.put(data, size);
+    midi_rb.put(data, payload_size);
     ctx.midi_timestamp_accum = 0;
 }
 
@@ -186,7 +215,6 @@ std::string get_program_title()
 int main(int argc, char *argv[])
 {
     i18n_setup();
-    midi_db.init();
 
     for (int c; (c = generic_getopt(argc, argv, "L:A:M:", usage)) != -1;) {
         switch (c) {
@@ -5,6 +5,7 @@
 
 #include "insnames.h"
 #include "i18n.h"
+#include <stddef.h>
 
 const char *midi_spec_name(Midi_Spec spec)
 {
@@ -20,1016 +21,1069 @@ const char *midi_spec_name(Midi_Spec spec)
 
 Midi_Db midi_db;
 
-void Midi_Db::init()
-{
-    init_midi_inst();
-    init_midi_perc();
-    init_midi_ex();
-}
+// marks the names for extraction, they are translated when first displayed
+#define N_INST(x) x
+#define N_PERC(x) x
+#define N_EX(x) x
+
+static constexpr const char *midi_inst_names[128] = {
+    N_INST("Acoustic Grand Piano"),
+    N_INST("Bright Acoustic Piano"),
+    N_INST("Electric Grand Piano"),
+    N_INST("Honky-Tonk Piano"),
+    N_INST("Rhodes Piano"),
+    N_INST("Chorused Piano"),
+    N_INST("Harpsichord"),
+    N_INST("Clavinet"),
+    N_INST("Celesta"),
+    N_INST("Glockenspiel"),
+    N_INST("Music box"),
+    N_INST("Vibraphone"),
+    N_INST("Marimba"),
+    N_INST("Xylophone"),
+    N_INST("Tubular Bells"),
+    N_INST("Dulcimer"),
+    N_INST("Hammond Organ"),
+    N_INST("Percussive Organ"),
+    N_INST("Rock Organ"),
+    N_INST("Church Organ"),
+    N_INST("Reed Organ"),
+    N_INST("Accordion"),
+    N_INST("Harmonica"),
+    N_INST("Tango Accordion"),
+    N_INST("Acoustic Guitar (nylon)"),
+    N_INST("Acoustic Guitar (steel)"),
+    N_INST("Electric Guitar (jazz)"),
+    N_INST("Electric Guitar (clean)"),
+    N_INST("Electric Guitar (muted)"),
+    N_INST("Overdrive Guitar"),
+    N_INST("Distortion Guitar"),
+    N_INST("Guitar Harmonics"),
+    N_INST("Acoustic Bass"),
+    N_INST("Electric Bass (finger)"),
+    N_INST("Electric Bass (pick)"),
+    N_INST("Fretless Bass"),
+    N_INST("Slap Bass 1"),
+    N_INST("Slap Bass 2"),
+    N_INST("Synth Bass 1"),
+    N_INST("Synth Bass 2"),
+    N_INST("Violin"),
+    N_INST("Viola"),
+    N_INST("Cello"),
+    N_INST("Contrabass"),
+    N_INST("Tremolo Strings"),
+    N_INST("Pizzicato String"),
+    N_INST("Orchestral Harp"),
+    N_INST("Timpany"),
+    N_INST("String Ensemble 1"),
+    N_INST("String Ensemble 2"),
+    N_INST("Synth Strings 1"),
+    N_INST("Synth Strings 2"),
+    N_INST("Choir Aahs"),
+    N_INST("Voice Oohs"),
+    N_INST("Synth Voice"),
+    N_INST("Orchestra Hit"),
+    N_INST("Trumpet"),
+    N_INST("Trombone"),
+    N_INST("Tuba"),
+    N_INST("Muted Trumpet"),
+    N_INST("French Horn"),
+    N_INST("Brass Section"),
+    N_INST("Synth Brass 1"),
+    N_INST("Synth Brass 2"),
+    N_INST("Soprano Sax"),
+    N_INST("Alto Sax"),
+    N_INST("Tenor Sax"),
+    N_INST("Baritone Sax"),
+    N_INST("Oboe"),
+    N_INST("English Horn"),
+    N_INST("Bassoon"),
+    N_INST("Clarinet"),
+    N_INST("Piccolo"),
+    N_INST("Flute"),
+    N_INST("Recorder"),
+    N_INST("Pan Flute"),
+    N_INST("Bottle Blow"),
+    N_INST("Shakuhachi"),
+    N_INST("Whistle"),
+    N_INST("Ocarina"),
+    N_INST("Lead 1 (Square)"),
+    N_INST("Lead 2 (Sawtooth)"),
+    N_INST("Lead 3 (Calliope)"),
+    N_INST("Lead 4 (Chiff)"),
+    N_INST("Lead 5 (Charang)"),
+    N_INST("Lead 6 (Voice)"),
+    N_INST("Lead 7 (Fifths)"),
+    N_INST("Lead 8 (Lead+Bass)"),
+    N_INST("Pad 1 (New age)"),
+    N_INST("Pad 2 (Warm)"),
+    N_INST("Pad 3 (Polysynth)"),
+    N_INST("Pad 4 (Choir)"),
+    N_INST("Pad 5 (Bowed)"),
+    N_INST("Pad 6 (Metallic)"),
+    N_INST("Pad 7 (Halo)"),
+    N_INST("Pad 8 (Sweep)"),
+    N_INST("FX 1 (Rain)"),
+    N_INST("FX 2 (Soundtrack)"),
+    N_INST("FX 3 (Crystal)"),
+    N_INST("FX 4 (Atmosphere)"),
+    N_INST("FX 5 (Brightness)"),
+    N_INST("FX 6 (Goblins)"),
+    N_INST("FX 7 (Echoes)"),
+    N_INST("FX 8 (Sci-fi)"),
+    N_INST("Sitar"),
+    N_INST("Banjo"),
+    N_INST("Shamisen"),
+    N_INST("Koto"),
+    N_INST("Kalimba"),
+    N_INST("Bagpipe"),
+    N_INST("Fiddle"),
+    N_INST("Shanai"),
+    N_INST("Tinkle Bell"),
+    N_INST("Agogo Bells"),
+    N_INST("Steel Drums"),
+    N_INST("Woodblock"),
+    N_INST("Taiko Drum"),
+    N_INST("Melodic Tom"),
+    N_INST("Synth Drum"),
+    N_INST("Reverse Cymbal"),
+    N_INST("Guitar Fret Noise"),
+    N_INST("Breath Noise"),
+    N_INST("Seashore"),
+    N_INST("Bird Tweet"),
+    N_INST("Telephone"),
+    N_INST("Helicopter"),
+    N_INST("Applause/Noise"),
+    N_INST("Gunshot"),
+};
 
-void Midi_Db::init_midi_inst()
+static constexpr Midi_Program_Ex midi_perc_names[128] = {
+    {Midi_Spec::GM, N_PERC("<Reserved 0>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 1>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 2>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 3>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 4>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 5>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 6>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 7>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 8>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 9>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 10>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 11>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 12>")},
+    {Midi_Spec::XG, N_PERC("Surdo Mute")},
+    {Midi_Spec::XG, N_PERC("Surdo Open")},
+    {Midi_Spec::XG, N_PERC("High Q")},
+    {Midi_Spec::XG, N_PERC("Whip Slap")},
+    {Midi_Spec::XG, N_PERC("Scratch Push")},
+    {Midi_Spec::XG, N_PERC("Scratch Pull")},
+    {Midi_Spec::XG, N_PERC("Finger Snap")},
+    {Midi_Spec::XG, N_PERC("Click Noise")},
+    {Midi_Spec::XG, N_PERC("Metronome Click")},
+    {Midi_Spec::XG, N_PERC("Metronome Bell")},
+    {Midi_Spec::XG, N_PERC("Seq Click L")},
+    {Midi_Spec::XG, N_PERC("Seq Click H")},
+    {Midi_Spec::XG, N_PERC("Brush Tap")},
+    {Midi_Spec::XG, N_PERC("Brush Swirl L")},
+    {Midi_Spec::GS, N_PERC("High Q")},  // (XG) Brush Slap
+    {Midi_Spec::GS, N_PERC("Slap")},  // (XG) Brush Swirl H
+    {Midi_Spec::GS, N_PERC("Scratch Push")},  // (XG) Snare Roll
+    {Midi_Spec::GS, N_PERC("Scratch Pull")},  // (XG) Castanet
+    {Midi_Spec::GS, N_PERC("Sticks")},  // (XG) Snare L
+    {Midi_Spec::GS, N_PERC("Square Click")},  // (XG) Sticks
+    {Midi_Spec::GS, N_PERC("Metronome Click")},  // (XG) Bass Drum L
+    {Midi_Spec::GS, N_PERC("Metronome Bell")},  // (XG) Open Rim Shot
+    {Midi_Spec::GM, N_PERC("Acoustic Bass Drum")},
+    {Midi_Spec::GM, N_PERC("Bass Drum 1")},
+    {Midi_Spec::GM, N_PERC("Side Stick")},
+    {Midi_Spec::GM, N_PERC("Acoustic Snare")},
+    {Midi_Spec::GM, N_PERC("Hand Clap")},
+    {Midi_Spec::GM, N_PERC("Electric Snare")},
+    {Midi_Spec::GM, N_PERC("Low Floor Tom")},
+    {Midi_Spec::GM, N_PERC("Closed High Hat")},
+    {Midi_Spec::GM, N_PERC("High Floor Tom")},
+    {Midi_Spec::GM, N_PERC("Pedal High Hat")},
+    {Midi_Spec::GM, N_PERC("Low Tom")},
+    {Midi_Spec::GM, N_PERC("Open High Hat")},
+    {Midi_Spec::GM, N_PERC("Low-Mid Tom")},
+    {Midi_Spec::GM, N_PERC("High-Mid Tom")},
+    {Midi_Spec::GM, N_PERC("Crash Cymbal 1")},
+    {Midi_Spec::GM, N_PERC("High Tom")},
+    {Midi_Spec::GM, N_PERC("Ride Cymbal 1")},
+    {Midi_Spec::GM, N_PERC("Chinese Cymbal")},
+    {Midi_Spec::GM, N_PERC("Ride Bell")},
+    {Midi_Spec::GM, N_PERC("Tambourine")},
+    {Midi_Spec::GM, N_PERC("Splash Cymbal")},
+    {Midi_Spec::GM, N_PERC("Cow Bell")},
+    {Midi_Spec::GM, N_PERC("Crash Cymbal 2")},
+    {Midi_Spec::GM, N_PERC("Vibraslap")},
+    {Midi_Spec::GM, N_PERC("Ride Cymbal 2")},
+    {Midi_Spec::GM, N_PERC("High Bongo")},
+    {Midi_Spec::GM, N_PERC("Low Bongo")},
+    {Midi_Spec::GM, N_PERC("Mute High Conga")},
+    {Midi_Spec::GM, N_PERC("Open High Conga")},
+    {Midi_Spec::GM, N_PERC("Low Conga")},
+    {Midi_Spec::GM, N_PERC("High Timbale")},
+    {Midi_Spec::GM, N_PERC("Low Timbale")},
+    {Midi_Spec::GM, N_PERC("High Agogo")},
+    {Midi_Spec::GM, N_PERC("Low Agogo")},
+    {Midi_Spec::GM, N_PERC("Cabasa")},
+    {Midi_Spec::GM, N_PERC("Maracas")},
+    {Midi_Spec::GM, N_PERC("Short Whistle")},
+    {Midi_Spec::GM, N_PERC("Long Whistle")},
+    {Midi_Spec::GM, N_PERC("Short Guiro")},
+    {Midi_Spec::GM, N_PERC("Long Guiro")},
+    {Midi_Spec::GM, N_PERC("Claves")},
+    {Midi_Spec::GM, N_PERC("High Wood Block")},
+    {Midi_Spec::GM, N_PERC("Low Wood Block")},
+    {Midi_Spec::GM, N_PERC("Mute Cuica")},
+    {Midi_Spec::GM, N_PERC("Open Cuica")},
+    {Midi_Spec::GM, N_PERC("Mute Triangle")},
+    {Midi_Spec::GM, N_PERC("Open Triangle")},
+    {Midi_Spec::GS, N_PERC("Shaker")},
+    {Midi_Spec::GS, N_PERC("Jingle Bell")},
+    {Midi_Spec::GS, N_PERC("Bell Tree")},
+    {Midi_Spec::GS, N_PERC("Castanets")},
+    {Midi_Spec::GS, N_PERC("Mute Surdu")},
+    {Midi_Spec::GS, N_PERC("Open Surdu")},
+    {Midi_Spec::GM, N_PERC("<Reserved 88>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 89>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 90>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 91>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 92>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 93>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 94>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 95>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 96>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 97>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 98>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 99>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 100>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 101>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 102>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 103>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 104>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 105>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 106>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 107>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 108>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 109>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 110>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 111>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 112>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 113>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 114>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 115>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 116>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 117>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 118>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 119>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 120>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 121>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 122>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 123>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 124>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 125>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 126>")},
+    {Midi_Spec::GM, N_PERC("<Reserved 127>")},
+};
+
+static constexpr unsigned midi_ex_id(
+    unsigned msb, unsigned lsb, unsigned pgm)
 {
-    midi_inst_[0] = _INST("Acoustic Grand Piano");
-    midi_inst_[1] = _INST("Bright Acoustic Piano");
-    midi_inst_[2] = _INST("Electric Grand Piano");
-    midi_inst_[3] = _INST("Honky-Tonk Piano");
-    midi_inst_[4] = _INST("Rhodes Piano");
-    midi_inst_[5] = _INST("Chorused Piano");
-    midi_inst_[6] = _INST("Harpsichord");
-    midi_inst_[7] = _INST("Clavinet");
-    midi_inst_[8] = _INST("Celesta");
-    midi_inst_[9] = _INST("Glockenspiel");
-    midi_inst_[10] = _INST("Music box");
-    midi_inst_[11] = _INST("Vibraphone");
-    midi_inst_[12] = _INST("Marimba");
-    midi_inst_[13] = _INST("Xylophone");
-    midi_inst_[14] = _INST("Tubular Bells");
-    midi_inst_[15] = _INST("Dulcimer");
-    midi_inst_[16] = _INST("Hammond Organ");
-    midi_inst_[17] = _INST("Percussive Organ");
-    midi_inst_[18] = _INST("Rock Organ");
-    midi_inst_[19] = _INST("Church Organ");
-    midi_inst_[20] = _INST("Reed Organ");
-    midi_inst_[21] = _INST("Accordion");
-    midi_inst_[22] = _INST("Harmonica");
-    midi_inst_[23] = _INST("Tango Accordion");
-    midi_inst_[24] = _INST("Acoustic Guitar (nylon)");
-    midi_inst_[25] = _INST("Acoustic Guitar (steel)");
-    midi_inst_[26] = _INST("Electric Guitar (jazz)");
-    midi_inst_[27] = _INST("Electric Guitar (clean)");
-    midi_inst_[28] = _INST("Electric Guitar (muted)");
-    midi_inst_[29] = _INST("Overdrive Guitar");
-    midi_inst_[30] = _INST("Distortion Guitar");
-    midi_inst_[31] = _INST("Guitar Harmonics");
-    midi_inst_[32] = _INST("Acoustic Bass");
-    midi_inst_[33] = _INST("Electric Bass (finger)");
-    midi_inst_[34] = _INST("Electric Bass (pick)");
-    midi_inst_[35] = _INST("Fretless Bass");
-    midi_inst_[36] = _INST("Slap Bass 1");
-    midi_inst_[37] = _INST("Slap Bass 2");
-    midi_inst_[38] = _INST("Synth Bass 1");
-    midi_inst_[39] = _INST("Synth Bass 2");
-    midi_inst_[40] = _INST("Violin");
-    midi_inst_[41] = _INST("Viola");
-    midi_inst_[42] = _INST("Cello");
-    midi_inst_[43] = _INST("Contrabass");
-    midi_inst_[44] = _INST("Tremolo Strings");
-    midi_inst_[45] = _INST("Pizzicato String");
-    midi_inst_[46] = _INST("Orchestral Harp");
-    midi_inst_[47] = _INST("Timpany");
-    midi_inst_[48] = _INST("String Ensemble 1");
-    midi_inst_[49] = _INST("String Ensemble 2");
-    midi_inst_[50] = _INST("Synth Strings 1");
-    midi_inst_[51] = _INST("Synth Strings 2");
-    midi_inst_[52] = _INST("Choir Aahs");
-    midi_inst_[53] = _INST("Voice Oohs");
-    midi_inst_[54] = _INST("Synth Voice");
-    midi_inst_[55] = _INST("Orchestra Hit");
-    midi_inst_[56] = _INST("Trumpet");
-    midi_inst_[57] = _INST("Trombone");
-    midi_inst_[58] = _INST("Tuba");
-    midi_inst_[59] = _INST("Muted Trumpet");
-    midi_inst_[60] = _INST("French Horn");
-    midi_inst_[61] = _INST("Brass Section");
-    midi_inst_[62] = _INST("Synth Brass 1");
-    midi_inst_[63] = _INST("Synth Brass 2");
-    midi_inst_[64] = _INST("Soprano Sax");
-    midi_inst_[65] = _INST("Alto Sax");
-    midi_inst_[66] = _INST("Tenor Sax");
-    midi_inst_[67] = _INST("Baritone Sax");
-    midi_inst_[68] = _INST("Oboe");
-    midi_inst_[69] = _INST("English Horn");
-    midi_inst_[70] = _INST("Bassoon");
-    midi_inst_[71] = _INST("Clarinet");
-    midi_inst_[72] = _INST("Piccolo");
-    midi_inst_[73] = _INST("Flute");
-    midi_inst_[74] = _INST("Recorder");
-    midi_inst_[75] = _INST("Pan Flute");
-    midi_inst_[76] = _INST("Bottle Blow");
-    midi_inst_[77] = _INST("Shakuhachi");
-    midi_inst_[78] = _INST("Whistle");
-    midi_inst_[79] = _INST("Ocarina");
-    midi_inst_[80] = _INST("Lead 1 (Square)");
-    midi_inst_[81] = _INST("Lead 2 (Sawtooth)");
-    midi_inst_[82] = _INST("Lead 3 (Calliope)");
-    midi_inst_[83] = _INST("Lead 4 (Chiff)");
-    midi_inst_[84] = _INST("Lead 5 (Charang)");
-    midi_inst_[85] = _INST("Lead 6 (Voice)");
-    midi_inst_[86] = _INST("Lead 7 (Fifths)");
-    midi_inst_[87] = _INST("Lead 8 (Lead+Bass)");
-    midi_inst_[88] = _INST("Pad 1 (New age)");
-    midi_inst_[89] = _INST("Pad 2 (Warm)");
-    midi_inst_[90] = _INST("Pad 3 (Polysynth)");
-    midi_inst_[91] = _INST("Pad 4 (Choir)");
-    midi_inst_[92] = _INST("Pad 5 (Bowed)");
-    midi_inst_[93] = _INST("Pad 6 (Metallic)");
-    midi_inst_[94] = _INST("Pad 7 (Halo)");
-    midi_inst_[95] = _INST("Pad 8 (Sweep)");
-    midi_inst_[96] = _INST("FX 1 (Rain)");
-    midi_inst_[97] = _INST("FX 2 (Soundtrack)");
-    midi_inst_[98] = _INST("FX 3 (Crystal)");
-    midi_inst_[99] = _INST("FX 4 (Atmosphere)");
-    midi_inst_[100] = _INST("FX 5 (Brightness)");
-    midi_inst_[101] = _INST("FX 6 (Goblins)");
-    midi_inst_[102] = _INST("FX 7 (Echoes)");
-    midi_inst_[103] = _INST("FX 8 (Sci-fi)");
-    midi_inst_[104] = _INST("Sitar");
-    midi_inst_[105] = _INST("Banjo");
-    midi_inst_[106] = _INST("Shamisen");
-    midi_inst_[107] = _INST("Koto");
-    midi_inst_[108] = _INST("Kalimba");
-    midi_inst_[109] = _INST("Bagpipe");
-    midi_inst_[110] = _INST("Fiddle");
-    midi_inst_[111] = _INST("Shanai");
-    midi_inst_[112] = _INST("Tinkle Bell");
-    midi_inst_[113] = _INST("Agogo Bells");
-    midi_inst_[114] = _INST("Steel Drums");
-    midi_inst_[115] = _INST("Woodblock");
-    midi_inst_[116] = _INST("Taiko Drum");
-    midi_inst_[117] = _INST("Melodic Tom");
-    midi_inst_[118] = _INST("Synth Drum");
-    midi_inst_[119] = _INST("Reverse Cymbal");
-    midi_inst_[120] = _INST("Guitar Fret Noise");
-    midi_inst_[121] = _INST("Breath Noise");
-    midi_inst_[122] = _INST("Seashore");
-    midi_inst_[123] = _INST("Bird Tweet");
-    midi_inst_[124] = _INST("Telephone");
-    midi_inst_[125] = _INST("Helicopter");
-    midi_inst_[126] = _INST("Applause/Noise");
-    midi_inst_[127] = _INST("Gunshot");
+    return ((msb & 0x7f) << 14) | ((lsb & 0x7f) << 7) | (pgm & 0x7f);
 }
 
-void Midi_Db::init_midi_perc()
+struct Midi_Ex_Entry {
+    unsigned id;
+    Midi_Program_Ex ex;
+};
+
+// sorted by identifier, for the binary search
+static constexpr Midi_Ex_Entry midi_ex_names[] = {
+    {midi_ex_id(00, 0x1, 00), {Midi_Spec::XG, N_EX("Grand PianoK")}},
+    {midi_ex_id(00, 0x1, 0x1), {Midi_Spec::XG, N_EX("Bright Piano K")}},
+    {midi_ex_id(00, 0x1, 0x2), {Midi_Spec::XG, N_EX("Electric Grand Piano K")}},
+    {midi_ex_id(00, 0x1, 0x3), {Midi_Spec::XG, N_EX("Honky Tonk K")}},
+    {midi_ex_id(00, 0x1, 0x4), {Midi_Spec::XG, N_EX("Electric Piano 1K")}},
+    {midi_ex_id(00, 0x1, 0x5), {Midi_Spec::XG, N_EX("Electric Piano2 K")}},
+    {midi_ex_id(00, 0x1, 0x6), {Midi_Spec::XG, N_EX("Harpsichord K")}},
+    {midi_ex_id(00, 0x1, 0x7), {Midi_Spec::XG, N_EX("Clavinet K")}},
+    {midi_ex_id(00, 0x1, 0xb), {Midi_Spec::XG, N_EX("VibesK")}},
+    {midi_ex_id(00, 0x1, 0xc), {Midi_Spec::XG, N_EX("Marimba K")}},
+    {midi_ex_id(00, 0x3, 0x30), {Midi_Spec::XG, N_EX("S.Strngs")}},
+    {midi_ex_id(00, 0x3, 0x31), {Midi_Spec::XG, N_EX("S.SlwStr")}},
+    {midi_ex_id(00, 0x3, 0x34), {Midi_Spec::XG, N_EX("S.Choir")}},
+    {midi_ex_id(00, 0x6, 0x27), {Midi_Spec::XG, N_EX("MelloSB1")}},
+    {midi_ex_id(00, 0x6, 0x3c), {Midi_Spec::XG, N_EX("FrHrSolo")}},
+    {midi_ex_id(00, 0x6, 0x50), {Midi_Spec::XG, N_EX("Square 2")}},
+    {midi_ex_id(00, 0x6, 0x51), {Midi_Spec::XG, N_EX("Saw 2")}},
+    {midi_ex_id(00, 0x8, 0x28), {Midi_Spec::XG, N_EX("SlowVln")}},
+    {midi_ex_id(00, 0x8, 0x2c), {Midi_Spec::XG, N_EX("SlowTrStr")}},
+    {midi_ex_id(00, 0x8, 0x30), {Midi_Spec::XG, N_EX("SlowStr")}},
+    {midi_ex_id(00, 0x8, 0x31), {Midi_Spec::XG, N_EX("LegatoSt")}},
+    {midi_ex_id(00, 0x8, 0x50), {Midi_Spec::XG, N_EX("LMSquare")}},
+    {midi_ex_id(00, 0x8, 0x51), {Midi_Spec::XG, N_EX("ThickSaw")}},
+    {midi_ex_id(00, 0x8, 0x66), {Midi_Spec::XG, N_EX("EchoPad2")}},
+    {midi_ex_id(00, 0xc, 0x27), {Midi_Spec::XG, N_EX("Seq Bass")}},
+    {midi_ex_id(00, 0xc, 0x3e), {Midi_Spec::XG, N_EX("QuackBr")}},
+    {midi_ex_id(00, 0xc, 0x62), {Midi_Spec::XG, N_EX("SynDrCmp")}},
+    {midi_ex_id(00, 0xe, 0x62), {Midi_Spec::XG, N_EX("Popcorn")}},
+    {midi_ex_id(00, 0xe, 0x66), {Midi_Spec::XG, N_EX("Echo Pan")}},
+    {midi_ex_id(00, 0x10, 0x18), {Midi_Spec::XG, N_EX("NylonGt2")}},
+    {midi_ex_id(00, 0x10, 0x19), {Midi_Spec::XG, N_EX("SteelGt2")}},
+    {midi_ex_id(00, 0x10, 0x34), {Midi_Spec::XG, N_EX("Ch.Aahs2")}},
+    {midi_ex_id(00, 0x10, 0x38), {Midi_Spec::XG, N_EX("Trumpet2")}},
+    {midi_ex_id(00, 0x10, 0x3a), {Midi_Spec::XG, N_EX("Tuba 2")}},
+    {midi_ex_id(00, 0x10, 0x57), {Midi_Spec::XG, N_EX("Big&Low")}},
+    {midi_ex_id(00, 0x10, 0x59), {Midi_Spec::XG, N_EX("ThickPad")}},
+    {midi_ex_id(00, 0x11, 0x38), {Midi_Spec::XG, N_EX("BriteTrp")}},
+    {midi_ex_id(00, 0x11, 0x59), {Midi_Spec::XG, N_EX("Soft Pad")}},
+    {midi_ex_id(00, 0x12, 00), {Midi_Spec::XG, N_EX("MelloGrP")}},
+    {midi_ex_id(00, 0x12, 0x4), {Midi_Spec::XG, N_EX("MelloEP1")}},
+    {midi_ex_id(00, 0x12, 0x1a), {Midi_Spec::XG, N_EX("MelloGtr")}},
+    {midi_ex_id(00, 0x12, 0x21), {Midi_Spec::XG, N_EX("FingrDrk")}},
+    {midi_ex_id(00, 0x12, 0x26), {Midi_Spec::XG, N_EX("SynBa1Dk")}},
+    {midi_ex_id(00, 0x12, 0x27), {Midi_Spec::XG, N_EX("SynBa1Dk")}},
+    {midi_ex_id(00, 0x12, 0x28), {Midi_Spec::XG, N_EX("ClkSynBa")}},
+    {midi_ex_id(00, 0x12, 0x39), {Midi_Spec::XG, N_EX("Trmbone2")}},
+    {midi_ex_id(00, 0x12, 0x3f), {Midi_Spec::XG, N_EX("Soft Brs")}},
+    {midi_ex_id(00, 0x12, 0x50), {Midi_Spec::XG, N_EX("Hollow")}},
+    {midi_ex_id(00, 0x12, 0x51), {Midi_Spec::XG, N_EX("DynaSaw")}},
+    {midi_ex_id(00, 0x12, 0x59), {Midi_Spec::XG, N_EX("SinePad")}},
+    {midi_ex_id(00, 0x12, 0x62), {Midi_Spec::XG, N_EX("TinyBell")}},
+    {midi_ex_id(00, 0x12, 0x63), {Midi_Spec::XG, N_EX("WarmAtms")}},
+    {midi_ex_id(00, 0x13, 0x27), {Midi_Spec::XG, N_EX("SynBa2Dk")}},
+    {midi_ex_id(00, 0x13, 0x50), {Midi_Spec::XG, N_EX("Shmoog")}},
+    {midi_ex_id(00, 0x13, 0x51), {Midi_Spec::XG, N_EX("DigiSaw")}},
+    {midi_ex_id(00, 0x13, 0x63), {Midi_Spec::XG, N_EX("HollwRls")}},
+    {midi_ex_id(00, 0x14, 0x26), {Midi_Spec::XG, N_EX("FastResB")}},
+    {midi_ex_id(00, 0x14, 0x3e), {Midi_Spec::XG, N_EX("RezSynBr")}},
+    {midi_ex_id(00, 0x14, 0x51), {Midi_Spec::XG, N_EX("Big Lead")}},
+    {midi_ex_id(00, 0x14, 0x5f), {Midi_Spec::XG, N_EX("Shwimmer")}},
+    {midi_ex_id(00, 0x18, 0x11), {Midi_Spec::XG, N_EX("70sPcOr1")}},
+    {midi_ex_id(00, 0x18, 0x26), {Midi_Spec::XG, N_EX("AcidBass")}},
+    {midi_ex_id(00, 0x18, 0x30), {Midi_Spec::XG, N_EX("ArcoStr")}},
+    {midi_ex_id(00, 0x18, 0x3e), {Midi_Spec::XG, N_EX("PolyBrss")}},
+    {midi_ex_id(00, 0x18, 0x51), {Midi_Spec::XG, N_EX("HeavySyn")}},
+    {midi_ex_id(00, 0x18, 0x55), {Midi_Spec::XG, N_EX("SynthAah")}},
+    {midi_ex_id(00, 0x19, 0x6), {Midi_Spec::XG, N_EX("Harpsi.2")}},
+    {midi_ex_id(00, 0x19, 0x18), {Midi_Spec::XG, N_EX("NylonGt3")}},
+    {midi_ex_id(00, 0x19, 0x51), {Midi_Spec::XG, N_EX("WaspySyn")}},
+    {midi_ex_id(00, 0x1b, 0x7), {Midi_Spec::XG, N_EX("ClaviWah")}},
+    {midi_ex_id(00, 0x1b, 0x21), {Midi_Spec::XG, N_EX("FlangeBa")}},
+    {midi_ex_id(00, 0x1b, 0x24), {Midi_Spec::XG, N_EX("ResoSlap")}},
+    {midi_ex_id(00, 0x1b, 0x32), {Midi_Spec::XG, N_EX("ResoStr")}},
+    {midi_ex_id(00, 0x1b, 0x3e), {Midi_Spec::XG, N_EX("SynBras3")}},
+    {midi_ex_id(00, 0x1b, 0x5f), {Midi_Spec::XG, N_EX("Converge")}},
+    {midi_ex_id(00, 0x1b, 0x61), {Midi_Spec::XG, N_EX("Prologue")}},
+    {midi_ex_id(00, 0x1c, 0x22), {Midi_Spec::XG, N_EX("MutePkBa")}},
+    {midi_ex_id(00, 0x1c, 0x69), {Midi_Spec::XG, N_EX("MuteBnjo")}},
+    {midi_ex_id(00, 0x20, 0x2), {Midi_Spec::XG, N_EX("Det.CP80")}},
+    {midi_ex_id(00, 0x20, 0x4), {Midi_Spec::XG, N_EX("Chor.EP1")}},
+    {midi_ex_id(00, 0x20, 0x5), {Midi_Spec::XG, N_EX("Chor.EP2")}},
+    {midi_ex_id(00, 0x20, 0x10), {Midi_Spec::XG, N_EX("DetDrwOr")}},
+    {midi_ex_id(00, 0x20, 0x11), {Midi_Spec::XG, N_EX("DetPrcOr")}},
+    {midi_ex_id(00, 0x20, 0x13), {Midi_Spec::XG, N_EX("ChurOrg3")}},
+    {midi_ex_id(00, 0x20, 0x15), {Midi_Spec::XG, N_EX("AccordIt")}},
+    {midi_ex_id(00, 0x20, 0x16), {Midi_Spec::XG, N_EX("Harmo 2")}},
+    {midi_ex_id(00, 0x20, 0x1a), {Midi_Spec::XG, N_EX("JazzAmp")}},
+    {midi_ex_id(00, 0x20, 0x1b), {Midi_Spec::XG, N_EX("ChorusGt")}},
+    {midi_ex_id(00, 0x20, 0x23), {Midi_Spec::XG, N_EX("Fretles2")}},
+    {midi_ex_id(00, 0x20, 0x24), {Midi_Spec::XG, N_EX("PunchThm")}},
+    {midi_ex_id(00, 0x20, 0x27), {Midi_Spec::XG, N_EX("SmthBa 2")}},
+    {midi_ex_id(00, 0x20, 0x34), {Midi_Spec::XG, N_EX("MelChoir")}},
+    {midi_ex_id(00, 0x20, 0x38), {Midi_Spec::XG, N_EX("WarmTrp")}},
+    {midi_ex_id(00, 0x20, 0x3c), {Midi_Spec::XG, N_EX("FrHorn2")}},
+    {midi_ex_id(00, 0x20, 0x3e), {Midi_Spec::XG, N_EX("JumpBrss")}},
+    {midi_ex_id(00, 0x20, 0x68), {Midi_Spec::XG, N_EX("DetSitar")}},
+    {midi_ex_id(00, 0x21, 0x5), {Midi_Spec::XG, N_EX("DX Hard")}},
+    {midi_ex_id(00, 0x21, 0x10), {Midi_Spec::XG, N_EX("60sDrOr1")}},
+    {midi_ex_id(00, 0x21, 0x11), {Midi_Spec::XG, N_EX("LiteOrg")}},
+    {midi_ex_id(00, 0x21, 0x23), {Midi_Spec::XG, N_EX("Fretles3")}},
+    {midi_ex_id(00, 0x22, 0x5), {Midi_Spec::XG, N_EX("DXLegend")}},
+    {midi_ex_id(00, 0x22, 0x10), {Midi_Spec::XG, N_EX("60sDrOr2")}},
+    {midi_ex_id(00, 0x22, 0x23), {Midi_Spec::XG, N_EX("Fretles4")}},
+    {midi_ex_id(00, 0x23, 0x6), {Midi_Spec::XG, N_EX("Harpsi.3")}},
+    {midi_ex_id(00, 0x23, 0xf), {Midi_Spec::XG, N_EX("Dulcimr2")}},
+    {midi_ex_id(00, 0x23, 0x10), {Midi_Spec::XG, N_EX("70sDrOr1")}},
+    {midi_ex_id(00, 0x23, 0x13), {Midi_Spec::XG, N_EX("ChurOrg2")}},
+    {midi_ex_id(00, 0x23, 0x19), {Midi_Spec::XG, N_EX("12StrGtr")}},
+    {midi_ex_id(00, 0x23, 0x26), {Midi_Spec::XG, N_EX("Clv Bass")}},
+    {midi_ex_id(00, 0x23, 0x30), {Midi_Spec::XG, N_EX("60sStrng")}},
+    {midi_ex_id(00, 0x23, 0x37), {Midi_Spec::XG, N_EX("OrchHit2")}},
+    {midi_ex_id(00, 0x23, 0x3d), {Midi_Spec::XG, N_EX("Tp&TbSec")}},
+    {midi_ex_id(00, 0x23, 0x56), {Midi_Spec::XG, N_EX("Big Five")}},
+    {midi_ex_id(00, 0x23, 0x62), {Midi_Spec::XG, N_EX("RndGlock")}},
+    {midi_ex_id(00, 0x23, 0x68), {Midi_Spec::XG, N_EX("Sitar 2")}},
+    {midi_ex_id(00, 0x24, 0x10), {Midi_Spec::XG, N_EX("DrawOrg2")}},
+    {midi_ex_id(00, 0x25, 0x10), {Midi_Spec::XG, N_EX("60sDrOr3")}},
+    {midi_ex_id(00, 0x25, 0x11), {Midi_Spec::XG, N_EX("PercOrg2")}},
+    {midi_ex_id(00, 0x25, 0x3c), {Midi_Spec::XG, N_EX("HornOrch")}},
+    {midi_ex_id(00, 0x26, 0x10), {Midi_Spec::XG, N_EX("EvenBar")}},
+    {midi_ex_id(00, 0x28, 00), {Midi_Spec::XG, N_EX("PianoStr")}},
+    {midi_ex_id(00, 0x28, 0x2), {Midi_Spec::XG, N_EX("ElGrPno1")}},
+    {midi_ex_id(00, 0x28, 0x4), {Midi_Spec::XG, N_EX("HardEl.P")}},
+    {midi_ex_id(00, 0x28, 0x5), {Midi_Spec::XG, N_EX("DX Phase")}},
+    {midi_ex_id(00, 0x28, 0x10), {Midi_Spec::XG, N_EX("16+2\"2/3")}},
+    {midi_ex_id(00, 0x28, 0x13), {Midi_Spec::XG, N_EX("NotreDam")}},
+    {midi_ex_id(00, 0x28, 0x14), {Midi_Spec::XG, N_EX("Puff Org")}},
+    {midi_ex_id(00, 0x28, 0x19), {Midi_Spec::XG, N_EX("Nyln&Stl")}},
+    {midi_ex_id(00, 0x28, 0x1c), {Midi_Spec::XG, N_EX("FunkGtr1")}},
+    {midi_ex_id(00, 0x28, 0x1e), {Midi_Spec::XG, N_EX("FeedbkGt")}},
+    {midi_ex_id(00, 0x28, 0x20), {Midi_Spec::XG, N_EX("Jazz Rhythm")}},
+    {midi_ex_id(00, 0x28, 0x21), {Midi_Spec::XG, N_EX("Ba&DstEG")}},
+    {midi_ex_id(00, 0x28, 0x26), {Midi_Spec::XG, N_EX("Techno Bass")}},
+    {midi_ex_id(00, 0x28, 0x27), {Midi_Spec::XG, N_EX("Modular Bass")}},
+    {midi_ex_id(00, 0x28, 0x2c), {Midi_Spec::XG, N_EX("Susp Str")}},
+    {midi_ex_id(00, 0x28, 0x2e), {Midi_Spec::XG, N_EX("Yang Chin")}},
+    {midi_ex_id(00, 0x28, 0x30), {Midi_Spec::XG, N_EX("Orchestra")}},
+    {midi_ex_id(00, 0x28, 0x31), {Midi_Spec::XG, N_EX("Warm Str")}},
+    {midi_ex_id(00, 0x28, 0x34), {Midi_Spec::XG, N_EX("ChoirStr")}},
+    {midi_ex_id(00, 0x28, 0x36), {Midi_Spec::XG, N_EX("SynVox2")}},
+    {midi_ex_id(00, 0x28, 0x3d), {Midi_Spec::XG, N_EX("BrassSec2")}},
+    {midi_ex_id(00, 0x28, 0x3f), {Midi_Spec::XG, N_EX("SynBras4")}},
+    {midi_ex_id(00, 0x28, 0x41), {Midi_Spec::XG, N_EX("Sax Sect")}},
+    {midi_ex_id(00, 0x28, 0x42), {Midi_Spec::XG, N_EX("BrthTnSx")}},
+    {midi_ex_id(00, 0x28, 0x51), {Midi_Spec::XG, N_EX("Pulse Saw")}},
+    {midi_ex_id(00, 0x28, 0x62), {Midi_Spec::XG, N_EX("GlockChi")}},
+    {midi_ex_id(00, 0x28, 0x63), {Midi_Spec::XG, N_EX("NylonEP")}},
+    {midi_ex_id(00, 0x29, 00), {Midi_Spec::XG, N_EX("Dream")}},
+    {midi_ex_id(00, 0x29, 0x2), {Midi_Spec::XG, N_EX("ElGrPno2")}},
+    {midi_ex_id(00, 0x29, 0x5), {Midi_Spec::XG, N_EX("DX+Analg")}},
+    {midi_ex_id(00, 0x29, 0x19), {Midi_Spec::XG, N_EX("Stl&Body")}},
+    {midi_ex_id(00, 0x29, 0x1c), {Midi_Spec::XG, N_EX("MuteStlG")}},
+    {midi_ex_id(00, 0x29, 0x1e), {Midi_Spec::XG, N_EX("FeedbGt2")}},
+    {midi_ex_id(00, 0x29, 0x27), {Midi_Spec::XG, N_EX("DX Bass")}},
+    {midi_ex_id(00, 0x29, 0x30), {Midi_Spec::XG, N_EX("Orchstr2")}},
+    {midi_ex_id(00, 0x29, 0x31), {Midi_Spec::XG, N_EX("Kingdom")}},
+    {midi_ex_id(00, 0x29, 0x36), {Midi_Spec::XG, N_EX("Choral")}},
+    {midi_ex_id(00, 0x29, 0x3d), {Midi_Spec::XG, N_EX("HiBrass")}},
+    {midi_ex_id(00, 0x29, 0x3f), {Midi_Spec::XG, N_EX("ChorBrss")}},
+    {midi_ex_id(00, 0x29, 0x42), {Midi_Spec::XG, N_EX("SoftTenr")}},
+    {midi_ex_id(00, 0x29, 0x51), {Midi_Spec::XG, N_EX("Dr. Lead")}},
+    {midi_ex_id(00, 0x29, 0x62), {Midi_Spec::XG, N_EX("ClearBel")}},
+    {midi_ex_id(00, 0x2a, 0x5), {Midi_Spec::XG, N_EX("DXKotoEP")}},
+    {midi_ex_id(00, 0x2a, 0x30), {Midi_Spec::XG, N_EX("TremOrch")}},
+    {midi_ex_id(00, 0x2a, 0x3d), {Midi_Spec::XG, N_EX("MelloBrs")}},
+    {midi_ex_id(00, 0x2a, 0x62), {Midi_Spec::XG, N_EX("ChorBell")}},
+    {midi_ex_id(00, 0x2b, 0x18), {Midi_Spec::XG, N_EX("VelGtHrm")}},
+    {midi_ex_id(00, 0x2b, 0x1c), {Midi_Spec::XG, N_EX("FunkGtr2")}},
+    {midi_ex_id(00, 0x2b, 0x1d), {Midi_Spec::XG, N_EX("Gt.Pinch")}},
+    {midi_ex_id(00, 0x2b, 0x21), {Midi_Spec::XG, N_EX("FngrSlap")}},
+    {midi_ex_id(00, 0x2b, 0x25), {Midi_Spec::XG, N_EX("VeloSlap")}},
+    {midi_ex_id(00, 0x2b, 0x41), {Midi_Spec::XG, N_EX("HyprAlto")}},
+    {midi_ex_id(00, 0x2d, 0x4), {Midi_Spec::XG, N_EX("VX El.P1")}},
+    {midi_ex_id(00, 0x2d, 0x5), {Midi_Spec::XG, N_EX("VX El.P2")}},
+    {midi_ex_id(00, 0x2d, 0xb), {Midi_Spec::XG, N_EX("HardVibe")}},
+    {midi_ex_id(00, 0x2d, 0x1c), {Midi_Spec::XG, N_EX("Jazz Man")}},
+    {midi_ex_id(00, 0x2d, 0x20), {Midi_Spec::XG, N_EX("VX Upright")}},
+    {midi_ex_id(00, 0x2d, 0x21), {Midi_Spec::XG, N_EX("FngBass2")}},
+    {midi_ex_id(00, 0x2d, 0x30), {Midi_Spec::XG, N_EX("VeloStr")}},
+    {midi_ex_id(00, 0x2d, 0x3e), {Midi_Spec::XG, N_EX("AnaVelBr")}},
+    {midi_ex_id(00, 0x2d, 0x3f), {Midi_Spec::XG, N_EX("VelBras2")}},
+    {midi_ex_id(00, 0x2d, 0x51), {Midi_Spec::XG, N_EX("VeloLead")}},
+    {midi_ex_id(00, 0x2d, 0x60), {Midi_Spec::XG, N_EX("ClaviPad")}},
+    {midi_ex_id(00, 0x40, 0x4), {Midi_Spec::XG, N_EX("60sEl.P")}},
+    {midi_ex_id(00, 0x40, 0x7), {Midi_Spec::XG, N_EX("PulseClv")}},
+    {midi_ex_id(00, 0x40, 0xa), {Midi_Spec::XG, N_EX("Orgel")}},
+    {midi_ex_id(00, 0x40, 0xc), {Midi_Spec::XG, N_EX("SineMrmb")}},
+    {midi_ex_id(00, 0x40, 0x10), {Midi_Spec::XG, N_EX("Organ Ba")}},
+    {midi_ex_id(00, 0x40, 0x12), {Midi_Spec::XG, N_EX("RotaryOr")}},
+    {midi_ex_id(00, 0x40, 0x13), {Midi_Spec::XG, N_EX("OrgFlute")}},
+    {midi_ex_id(00, 0x40, 0x17), {Midi_Spec::XG, N_EX("TngoAcd2")}},
+    {midi_ex_id(00, 0x40, 0x26), {Midi_Spec::XG, N_EX("Oscar")}},
+    {midi_ex_id(00, 0x40, 0x27), {Midi_Spec::XG, N_EX("X WireBa")}},
+    {midi_ex_id(00, 0x40, 0x31), {Midi_Spec::XG, N_EX("70s Str")}},
+    {midi_ex_id(00, 0x40, 0x32), {Midi_Spec::XG, N_EX("Syn Str4")}},
+    {midi_ex_id(00, 0x40, 0x36), {Midi_Spec::XG, N_EX("AnaVoice")}},
+    {midi_ex_id(00, 0x40, 0x37), {Midi_Spec::XG, N_EX("Impact")}},
+    {midi_ex_id(00, 0x40, 0x3e), {Midi_Spec::XG, N_EX("AnaBrss1")}},
+    {midi_ex_id(00, 0x40, 0x3f), {Midi_Spec::XG, N_EX("AnaBras2")}},
+    {midi_ex_id(00, 0x40, 0x42), {Midi_Spec::XG, N_EX("TnrSax 2")}},
+    {midi_ex_id(00, 0x40, 0x50), {Midi_Spec::XG, N_EX("Mellow")}},
+    {midi_ex_id(00, 0x40, 0x53), {Midi_Spec::XG, N_EX("Rubby")}},
+    {midi_ex_id(00, 0x40, 0x54), {Midi_Spec::XG, N_EX("DistLead")}},
+    {midi_ex_id(00, 0x40, 0x55), {Midi_Spec::XG, N_EX("VoxLead")}},
+    {midi_ex_id(00, 0x40, 0x57), {Midi_Spec::XG, N_EX("Fat&Prky")}},
+    {midi_ex_id(00, 0x40, 0x58), {Midi_Spec::XG, N_EX("Fantasy2")}},
+    {midi_ex_id(00, 0x40, 0x59), {Midi_Spec::XG, N_EX("Horn Pad")}},
+    {midi_ex_id(00, 0x40, 0x5a), {Midi_Spec::XG, N_EX("PolyPd80")}},
+    {midi_ex_id(00, 0x40, 0x5b), {Midi_Spec::XG, N_EX("Heaven2")}},
+    {midi_ex_id(00, 0x40, 0x5c), {Midi_Spec::XG, N_EX("Glacier")}},
+    {midi_ex_id(00, 0x40, 0x5d), {Midi_Spec::XG, N_EX("Tine Pad")}},
+    {midi_ex_id(00, 0x40, 0x5f), {Midi_Spec::XG, N_EX("PolarPad")}},
+    {midi_ex_id(00, 0x40, 0x60), {Midi_Spec::XG, N_EX("HrmoRain")}},
+    {midi_ex_id(00, 0x40, 0x61), {Midi_Spec::XG, N_EX("Ancestrl")}},
+    {midi_ex_id(00, 0x40, 0x62), {Midi_Spec::XG, N_EX("SynMalet")}},
+    {midi_ex_id(00, 0x40, 0x63), {Midi_Spec::XG, N_EX("NylnHarp")}},
+    {midi_ex_id(00, 0x40, 0x64), {Midi_Spec::XG, N_EX("FantaBel")}},
+    {midi_ex_id(00, 0x40, 0x65), {Midi_Spec::XG, N_EX("GobSyn")}},
+    {midi_ex_id(00, 0x40, 0x66), {Midi_Spec::XG, N_EX("EchoBell")}},
+    {midi_ex_id(00, 0x40, 0x67), {Midi_Spec::XG, N_EX("Starz")}},
+    {midi_ex_id(00, 0x40, 0x6f), {Midi_Spec::XG, N_EX("Shanai2")}},
+    {midi_ex_id(00, 0x40, 0x75), {Midi_Spec::XG, N_EX("Mel Tom2")}},
+    {midi_ex_id(00, 0x40, 0x76), {Midi_Spec::XG, N_EX("Ana Tom")}},
+    {midi_ex_id(00, 0x41, 0x7), {Midi_Spec::XG, N_EX("PierceCl")}},
+    {midi_ex_id(00, 0x41, 0x10), {Midi_Spec::XG, N_EX("70sDrOr2")}},
+    {midi_ex_id(00, 0x41, 0x12), {Midi_Spec::XG, N_EX("SlwRotar")}},
+    {midi_ex_id(00, 0x41, 0x13), {Midi_Spec::XG, N_EX("TrmOrgFl")}},
+    {midi_ex_id(00, 0x41, 0x1f), {Midi_Spec::XG, N_EX("GtFeedbk")}},
+    {midi_ex_id(00, 0x41, 0x21), {Midi_Spec::XG, N_EX("ModAlem")}},
+    {midi_ex_id(00, 0x41, 0x26), {Midi_Spec::XG, N_EX("SqrBass")}},
+    {midi_ex_id(00, 0x41, 0x32), {Midi_Spec::XG, N_EX("SS Str")}},
+    {midi_ex_id(00, 0x41, 0x50), {Midi_Spec::XG, N_EX("SoloSine")}},
+    {midi_ex_id(00, 0x41, 0x52), {Midi_Spec::XG, N_EX("Pure Pad")}},
+    {midi_ex_id(00, 0x41, 0x54), {Midi_Spec::XG, N_EX("WireLead")}},
+    {midi_ex_id(00, 0x41, 0x57), {Midi_Spec::XG, N_EX("SoftWurl")}},
+    {midi_ex_id(00, 0x41, 0x59), {Midi_Spec::XG, N_EX("RotarStr")}},
+    {midi_ex_id(00, 0x41, 0x5a), {Midi_Spec::XG, N_EX("ClickPad")}},
+    {midi_ex_id(00, 0x41, 0x5c), {Midi_Spec::XG, N_EX("GlassPad")}},
+    {midi_ex_id(00, 0x41, 0x5d), {Midi_Spec::XG, N_EX("Pan Pad")}},
+    {midi_ex_id(00, 0x41, 0x60), {Midi_Spec::XG, N_EX("AfrcnWod")}},
+    {midi_ex_id(00, 0x41, 0x62), {Midi_Spec::XG, N_EX("SftCryst")}},
+    {midi_ex_id(00, 0x41, 0x63), {Midi_Spec::XG, N_EX("Harp Vox")}},
+    {midi_ex_id(00, 0x41, 0x65), {Midi_Spec::XG, N_EX("50sSciFi")}},
+    {midi_ex_id(00, 0x41, 0x66), {Midi_Spec::XG, N_EX("Big Pan")}},
+    {midi_ex_id(00, 0x41, 0x75), {Midi_Spec::XG, N_EX("Real Tom")}},
+    {midi_ex_id(00, 0x41, 0x76), {Midi_Spec::XG, N_EX("ElecPerc")}},
+    {midi_ex_id(00, 0x42, 0x10), {Midi_Spec::XG, N_EX("CheezOrg")}},
+    {midi_ex_id(00, 0x42, 0x12), {Midi_Spec::XG, N_EX("FstRotar")}},
+    {midi_ex_id(00, 0x42, 0x1f), {Midi_Spec::XG, N_EX("GtrHrmo2")}},
+    {midi_ex_id(00, 0x42, 0x26), {Midi_Spec::XG, N_EX("RubberBa")}},
+    {midi_ex_id(00, 0x42, 0x50), {Midi_Spec::XG, N_EX("SineLead")}},
+    {midi_ex_id(00, 0x42, 0x5a), {Midi_Spec::XG, N_EX("Ana Pad")}},
+    {midi_ex_id(00, 0x42, 0x5b), {Midi_Spec::XG, N_EX("Itopia")}},
+    {midi_ex_id(00, 0x42, 0x5f), {Midi_Spec::XG, N_EX("Celstial")}},
+    {midi_ex_id(00, 0x42, 0x60), {Midi_Spec::XG, N_EX("Caribean")}},
+    {midi_ex_id(00, 0x42, 0x62), {Midi_Spec::XG, N_EX("LoudGlok")}},
+    {midi_ex_id(00, 0x42, 0x63), {Midi_Spec::XG, N_EX("AtmosPad")}},
+    {midi_ex_id(00, 0x42, 0x65), {Midi_Spec::XG, N_EX("Ring Pad")}},
+    {midi_ex_id(00, 0x42, 0x66), {Midi_Spec::XG, N_EX("SynPiano")}},
+    {midi_ex_id(00, 0x42, 0x75), {Midi_Spec::XG, N_EX("Rock Tom")}},
+    {midi_ex_id(00, 0x43, 0x10), {Midi_Spec::XG, N_EX("DrawOrg3")}},
+    {midi_ex_id(00, 0x43, 0x5a), {Midi_Spec::XG, N_EX("SquarPad")}},
+    {midi_ex_id(00, 0x43, 0x5b), {Midi_Spec::XG, N_EX("CC Pad")}},
+    {midi_ex_id(00, 0x43, 0x62), {Midi_Spec::XG, N_EX("XmasBell")}},
+    {midi_ex_id(00, 0x43, 0x63), {Midi_Spec::XG, N_EX("Planet")}},
+    {midi_ex_id(00, 0x43, 0x65), {Midi_Spec::XG, N_EX("Ritual")}},
+    {midi_ex_id(00, 0x43, 0x66), {Midi_Spec::XG, N_EX("Creation")}},
+    {midi_ex_id(00, 0x44, 0x62), {Midi_Spec::XG, N_EX("VibeBell")}},
+    {midi_ex_id(00, 0x44, 0x65), {Midi_Spec::XG, N_EX("ToHeaven")}},
+    {midi_ex_id(00, 0x44, 0x66), {Midi_Spec::XG, N_EX("Stardust")}},
+    {midi_ex_id(00, 0x45, 0x62), {Midi_Spec::XG, N_EX("DigiBell")}},
+    {midi_ex_id(00, 0x45, 0x66), {Midi_Spec::XG, N_EX("Reso Pan")}},
+    {midi_ex_id(00, 0x46, 0x62), {Midi_Spec::XG, N_EX("AirBells")}},
+    {midi_ex_id(00, 0x46, 0x65), {Midi_Spec::XG, N_EX("Night")}},
+    {midi_ex_id(00, 0x47, 0x62), {Midi_Spec::XG, N_EX("BellHarp")}},
+    {midi_ex_id(00, 0x47, 0x65), {Midi_Spec::XG, N_EX("Glisten")}},
+    {midi_ex_id(00, 0x48, 0x62), {Midi_Spec::XG, N_EX("Gamelmba")}},
+    {midi_ex_id(00, 0x60, 0xe), {Midi_Spec::XG, N_EX("Church Bell")}},
+    {midi_ex_id(00, 0x60, 0xf), {Midi_Spec::XG, N_EX("Cimbalom")}},
+    {midi_ex_id(00, 0x60, 0x18), {Midi_Spec::XG, N_EX("Ukelele")}},
+    {midi_ex_id(00, 0x60, 0x19), {Midi_Spec::XG, N_EX("Mandolin")}},
+    {midi_ex_id(00, 0x60, 0x23), {Midi_Spec::XG, N_EX("SynFretl")}},
+    {midi_ex_id(00, 0x60, 0x26), {Midi_Spec::XG, N_EX("Hammer")}},
+    {midi_ex_id(00, 0x60, 0x51), {Midi_Spec::XG, N_EX("Seq Ana")}},
+    {midi_ex_id(00, 0x60, 0x64), {Midi_Spec::XG, N_EX("Smokey")}},
+    {midi_ex_id(00, 0x60, 0x65), {Midi_Spec::XG, N_EX("BelChoir")}},
+    {midi_ex_id(00, 0x60, 0x68), {Midi_Spec::XG, N_EX("Tambra")}},
+    {midi_ex_id(00, 0x60, 0x69), {Midi_Spec::XG, N_EX("Rabab")}},
+    {midi_ex_id(00, 0x60, 0x6b), {Midi_Spec::XG, N_EX("T.Koto")}},
+    {midi_ex_id(00, 0x60, 0x6f), {Midi_Spec::XG, N_EX("Pungi")}},
+    {midi_ex_id(00, 0x60, 0x70), {Midi_Spec::XG, N_EX("Bonang")}},
+    {midi_ex_id(00, 0x60, 0x73), {Midi_Spec::XG, N_EX("Castanets")}},
+    {midi_ex_id(00, 0x60, 0x74), {Midi_Spec::XG, N_EX("Gr.Cassa")}},
+    {midi_ex_id(00, 0x61, 0xc), {Midi_Spec::XG, N_EX("Balafon2")}},
+    {midi_ex_id(00, 0x61, 0xe), {Midi_Spec::XG, N_EX("Carillon")}},
+    {midi_ex_id(00, 0x61, 0xf), {Midi_Spec::XG, N_EX("Santur")}},
+    {midi_ex_id(00, 0x61, 0x23), {Midi_Spec::XG, N_EX("Smooth")}},
+    {midi_ex_id(00, 0x61, 0x68), {Midi_Spec::XG, N_EX("Tamboura")}},
+    {midi_ex_id(00, 0x61, 0x69), {Midi_Spec::XG, N_EX("Gopichnt")}},
+    {midi_ex_id(00, 0x61, 0x6b), {Midi_Spec::XG, N_EX("Kanoon")}},
+    {midi_ex_id(00, 0x61, 0x6f), {Midi_Spec::XG, N_EX("Hichriki")}},
+    {midi_ex_id(00, 0x61, 0x70), {Midi_Spec::XG, N_EX("Gender")}},
+    {midi_ex_id(00, 0x61, 0x72), {Midi_Spec::XG, N_EX("GlasPerc")}},
+    {midi_ex_id(00, 0x62, 0xc), {Midi_Spec::XG, N_EX("Log Drum")}},
+    {midi_ex_id(00, 0x62, 0x69), {Midi_Spec::XG, N_EX("Oud")}},
+    {midi_ex_id(00, 0x62, 0x70), {Midi_Spec::XG, N_EX("Gamelan")}},
+    {midi_ex_id(00, 0x62, 0x72), {Midi_Spec::XG, N_EX("ThaiBell")}},
+    {midi_ex_id(00, 0x63, 0x70), {Midi_Spec::XG, N_EX("S.Gamlan")}},
+    {midi_ex_id(00, 0x64, 0x70), {Midi_Spec::XG, N_EX("Rama Cym")}},
+    {midi_ex_id(00, 0x65, 0x70), {Midi_Spec::XG, N_EX("AsianBel")}},
+    {midi_ex_id(0x1, 00, 0x2), {Midi_Spec::SC88, N_EX("EG+Rhodes1")}},
+    {midi_ex_id(0x1, 00, 0xb), {Midi_Spec::SC88, N_EX("Hard Vibe")}},
+    {midi_ex_id(0x1, 00, 0xf), {Midi_Spec::SC88, N_EX("Santur 2")}},
+    {midi_ex_id(0x1, 00, 0x10), {Midi_Spec::SC88, N_EX("Organ 101")}},
+    {midi_ex_id(0x1, 00, 0x11), {Midi_Spec::SC88, N_EX("Organ 201")}},
+    {midi_ex_id(0x1, 00, 0x16), {Midi_Spec::SC88, N_EX("Harmonica 2")}},
+    {midi_ex_id(0x1, 00, 0x1a), {Midi_Spec::SC88, N_EX("Mellow Gt.")}},
+    {midi_ex_id(0x1, 00, 0x1c), {Midi_Spec::SC88, N_EX("Muted Dis.Gt")}},
+    {midi_ex_id(0x1, 00, 0x1e), {Midi_Spec::SC88, N_EX("Dist.Gt 2")}},
+    {midi_ex_id(0x1, 00, 0x21), {Midi_Spec::SC88, N_EX("Fingered Bs2")}},
+    {midi_ex_id(0x1, 00, 0x23), {Midi_Spec::SC88, N_EX("Fretless Bs2")}},
+    {midi_ex_id(0x1, 00, 0x26), {Midi_Spec::GS, N_EX("Synth Bass 101")}},
+    {midi_ex_id(0x1, 00, 0x27), {Midi_Spec::SC88, N_EX("Synth Bass 201")}},
+    {midi_ex_id(0x1, 00, 0x30), {Midi_Spec::SC88, N_EX("Strings 2")}},
+    {midi_ex_id(0x1, 00, 0x31), {Midi_Spec::SC88, N_EX("SlowStrings2")}},
+    {midi_ex_id(0x1, 00, 0x32), {Midi_Spec::SC88, N_EX("OB Strings")}},
+    {midi_ex_id(0x1, 00, 0x38), {Midi_Spec::SC88, N_EX("Trumpet 2")}},
+    {midi_ex_id(0x1, 00, 0x39), {Midi_Spec::GS, N_EX("Trombone 2")}},
+    {midi_ex_id(0x1, 00, 0x3a), {Midi_Spec::SC88, N_EX("Tuba 2")}},
+    {midi_ex_id(0x1, 00, 0x3c), {Midi_Spec::GS, N_EX("French Horn2")}},
+    {midi_ex_id(0x1, 00, 0x3e), {Midi_Spec::SC88, N_EX("Poly Brass")}},
+    {midi_ex_id(0x1, 00, 0x3f), {Midi_Spec::SC88, N_EX("Soft Brass")}},
+    {midi_ex_id(0x1, 00, 0x50), {Midi_Spec::GS, N_EX("Square")}},
+    {midi_ex_id(0x1, 00, 0x51), {Midi_Spec::GS, N_EX("Saw")}},
+    {midi_ex_id(0x1, 00, 0x52), {Midi_Spec::SC88, N_EX("Vent Synth")}},
+    {midi_ex_id(0x1, 00, 0x56), {Midi_Spec::SC88, N_EX("Big Fives")}},
+    {midi_ex_id(0x1, 00, 0x57), {Midi_Spec::SC88, N_EX("Big & Raw")}},
+    {midi_ex_id(0x1, 00, 0x58), {Midi_Spec::SC88, N_EX("Fantasia 2")}},
+    {midi_ex_id(0x1, 00, 0x59), {Midi_Spec::SC88, N_EX("Thick Pad")}},
+    {midi_ex_id(0x1, 00, 0x5a), {Midi_Spec::SC88, N_EX("80's PolySyn")}},
+    {midi_ex_id(0x1, 00, 0x5b), {Midi_Spec::SC88, N_EX("Heaven II")}},
+    {midi_ex_id(0x1, 00, 0x5d), {Midi_Spec::SC88, N_EX("Tine Pad")}},
+    {midi_ex_id(0x1, 00, 0x5f), {Midi_Spec::SC88, N_EX("Polar Pad")}},
+    {midi_ex_id(0x1, 00, 0x60), {Midi_Spec::SC88, N_EX("Harmo Rain")}},
+    {midi_ex_id(0x1, 00, 0x61), {Midi_Spec::SC88, N_EX("Ancestral")}},
+    {midi_ex_id(0x1, 00, 0x62), {Midi_Spec::GS, N_EX("Syn Mallet")}},
+    {midi_ex_id(0x1, 00, 0x63), {Midi_Spec::SC88, N_EX("Warm Atmos")}},
+    {midi_ex_id(0x1, 00, 0x65), {Midi_Spec::SC88, N_EX("Goblinson")}},
+    {midi_ex_id(0x1, 00, 0x66), {Midi_Spec::GS, N_EX("Echo Bell")}},
+    {midi_ex_id(0x1, 00, 0x67), {Midi_Spec::SC88, N_EX("Star Theme 2")}},
+    {midi_ex_id(0x1, 00, 0x68), {Midi_Spec::GS, N_EX("Sitar 2")}},
+    {midi_ex_id(0x1, 00, 0x69), {Midi_Spec::SC88, N_EX("Muted Banjo")}},
+    {midi_ex_id(0x1, 00, 0x6a), {Midi_Spec::SC88, N_EX("Tsugaru")}},
+    {midi_ex_id(0x1, 00, 0x6f), {Midi_Spec::SC88, N_EX("Shanai 2")}},
+    {midi_ex_id(0x1, 00, 0x75), {Midi_Spec::SC88, N_EX("Real Tom")}},
+    {midi_ex_id(0x1, 00, 0x77), {Midi_Spec::SC88, N_EX("Reverse Cym2")}},
+    {midi_ex_id(0x1, 00, 0x78), {Midi_Spec::GS, N_EX("Gt. Cut Noise")}},
+    {midi_ex_id(0x1, 00, 0x79), {Midi_Spec::GS, N_EX("Flute Key Click")}},
+    {midi_ex_id(0x1, 00, 0x7a), {Midi_Spec::GS, N_EX("Rain")}},
+    {midi_ex_id(0x1, 00, 0x7b), {Midi_Spec::GS, N_EX("Dog")}},
+    {midi_ex_id(0x1, 00, 0x7c), {Midi_Spec::GS, N_EX("Telephone 2")}},
+    {midi_ex_id(0x1, 00, 0x7d), {Midi_Spec::GS, N_EX("Car-Engine")}},
+    {midi_ex_id(0x1, 00, 0x7e), {Midi_Spec::GS, N_EX("Laughing")}},
+    {midi_ex_id(0x1, 00, 0x7f), {Midi_Spec::GS, N_EX("Machine Gun")}},
+    {midi_ex_id(0x2, 00, 0x2), {Midi_Spec::SC88, N_EX("EG+Rhodes2")}},
+    {midi_ex_id(0x2, 00, 0x1e), {Midi_Spec::SC88, N_EX("Dazed Guitar")}},
+    {midi_ex_id(0x2, 00, 0x21), {Midi_Spec::SC88, N_EX("Jazz Bass")}},
+    {midi_ex_id(0x2, 00, 0x23), {Midi_Spec::SC88, N_EX("Fretless Bs3")}},
+    {midi_ex_id(0x2, 00, 0x27), {Midi_Spec::SC88, N_EX("Modular Bass")}},
+    {midi_ex_id(0x2, 00, 0x50), {Midi_Spec::SC88, N_EX("Hollow Mini")}},
+    {midi_ex_id(0x2, 00, 0x51), {Midi_Spec::SC88, N_EX("Pulse Saw")}},
+    {midi_ex_id(0x2, 00, 0x52), {Midi_Spec::SC88, N_EX("Pure PanLead")}},
+    {midi_ex_id(0x2, 00, 0x57), {Midi_Spec::SC88, N_EX("Fat & Perky")}},
+    {midi_ex_id(0x2, 00, 0x59), {Midi_Spec::SC88, N_EX("Horn Pad")}},
+    {midi_ex_id(0x2, 00, 0x5d), {Midi_Spec::SC88, N_EX("Panner Pad")}},
+    {midi_ex_id(0x2, 00, 0x60), {Midi_Spec::SC88, N_EX("African Wood")}},
+    {midi_ex_id(0x2, 00, 0x61), {Midi_Spec::SC88, N_EX("Prologue")}},
+    {midi_ex_id(0x2, 00, 0x62), {Midi_Spec::SC88, N_EX("Soft Crystal")}},
+    {midi_ex_id(0x2, 00, 0x63), {Midi_Spec::SC88, N_EX("Nylon Harp")}},
+    {midi_ex_id(0x2, 00, 0x65), {Midi_Spec::SC88, N_EX("50's Sci-Fi")}},
+    {midi_ex_id(0x2, 00, 0x66), {Midi_Spec::GS, N_EX("Echo Pan")}},
+    {midi_ex_id(0x2, 00, 0x68), {Midi_Spec::SC88, N_EX("Detune Sitar")}},
+    {midi_ex_id(0x2, 00, 0x78), {Midi_Spec::GS, N_EX("String Slap")}},
+    {midi_ex_id(0x2, 00, 0x7a), {Midi_Spec::GS, N_EX("Thunder")}},
+    {midi_ex_id(0x2, 00, 0x7b), {Midi_Spec::GS, N_EX("Horse-Gallop")}},
+    {midi_ex_id(0x2, 00, 0x7c), {Midi_Spec::GS, N_EX("Door Creaking")}},
+    {midi_ex_id(0x2, 00, 0x7d), {Midi_Spec::GS, N_EX("Car-Stop")}},
+    {midi_ex_id(0x2, 00, 0x7e), {Midi_Spec::GS, N_EX("Screaming")}},
+    {midi_ex_id(0x2, 00, 0x7f), {Midi_Spec::GS, N_EX("Lasergun")}},
+    {midi_ex_id(0x3, 00, 0x23), {Midi_Spec::SC88, N_EX("Fretless Bs4")}},
+    {midi_ex_id(0x3, 00, 0x27), {Midi_Spec::SC88, N_EX("Seq Bass")}},
+    {midi_ex_id(0x3, 00, 0x50), {Midi_Spec::SC88, N_EX("Mellow FM")}},
+    {midi_ex_id(0x3, 00, 0x51), {Midi_Spec::SC88, N_EX("Feline GR")}},
+    {midi_ex_id(0x3, 00, 0x59), {Midi_Spec::SC88, N_EX("RotaryString")}},
+    {midi_ex_id(0x3, 00, 0x62), {Midi_Spec::SC88, N_EX("Round Glock")}},
+    {midi_ex_id(0x3, 00, 0x63), {Midi_Spec::SC88, N_EX("Harpvox")}},
+    {midi_ex_id(0x3, 00, 0x66), {Midi_Spec::SC88, N_EX("Echo Pan 2")}},
+    {midi_ex_id(0x3, 00, 0x78), {Midi_Spec::SC88, N_EX("Gt.CutNoise2")}},
+    {midi_ex_id(0x3, 00, 0x7a), {Midi_Spec::GS, N_EX("Wind")}},
+    {midi_ex_id(0x3, 00, 0x7b), {Midi_Spec::GS, N_EX("Bird 2")}},
+    {midi_ex_id(0x3, 00, 0x7c), {Midi_Spec::GS, N_EX("Door Close")}},
+    {midi_ex_id(0x3, 00, 0x7d), {Midi_Spec::GS, N_EX("Car-Pass")}},
+    {midi_ex_id(0x3, 00, 0x7e), {Midi_Spec::GS, N_EX("Punch")}},
+    {midi_ex_id(0x3, 00, 0x7f), {Midi_Spec::GS, N_EX("Explosion")}},
+    {midi_ex_id(0x4, 00, 0x50), {Midi_Spec::SC88, N_EX("CC Solo")}},
+    {midi_ex_id(0x4, 00, 0x51), {Midi_Spec::SC88, N_EX("Big Lead")}},
+    {midi_ex_id(0x4, 00, 0x59), {Midi_Spec::SC88, N_EX("Soft Pad")}},
+    {midi_ex_id(0x4, 00, 0x62), {Midi_Spec::SC88, N_EX("Loud Glock")}},
+    {midi_ex_id(0x4, 00, 0x63), {Midi_Spec::SC88, N_EX("HollowReleas")}},
+    {midi_ex_id(0x4, 00, 0x66), {Midi_Spec::SC88, N_EX("Big Panner")}},
+    {midi_ex_id(0x4, 00, 0x78), {Midi_Spec::SC88, N_EX("Dist.CutNoise")}},
+    {midi_ex_id(0x4, 00, 0x7a), {Midi_Spec::GS, N_EX("Stream")}},
+    {midi_ex_id(0x4, 00, 0x7b), {Midi_Spec::SC88, N_EX("Kitty")}},
+    {midi_ex_id(0x4, 00, 0x7c), {Midi_Spec::GS, N_EX("Scratch")}},
+    {midi_ex_id(0x4, 00, 0x7d), {Midi_Spec::GS, N_EX("Car-Crash")}},
+    {midi_ex_id(0x4, 00, 0x7e), {Midi_Spec::GS, N_EX("Heart Beat")}},
+    {midi_ex_id(0x5, 00, 0x23), {Midi_Spec::SC88, N_EX("Mr.Smooth")}},
+    {midi_ex_id(0x5, 00, 0x50), {Midi_Spec::SC88, N_EX("Shmoog")}},
+    {midi_ex_id(0x5, 00, 0x51), {Midi_Spec::SC88, N_EX("Velo Lead")}},
+    {midi_ex_id(0x5, 00, 0x62), {Midi_Spec::SC88, N_EX("GlockenChime")}},
+    {midi_ex_id(0x5, 00, 0x63), {Midi_Spec::SC88, N_EX("Nylon+Rhodes")}},
+    {midi_ex_id(0x5, 00, 0x66), {Midi_Spec::SC88, N_EX("Reso Panner")}},
+    {midi_ex_id(0x5, 00, 0x78), {Midi_Spec::SC88, N_EX("Bass Slide")}},
+    {midi_ex_id(0x5, 00, 0x7a), {Midi_Spec::GS, N_EX("Bubble")}},
+    {midi_ex_id(0x5, 00, 0x7b), {Midi_Spec::SC88, N_EX("Growl")}},
+    {midi_ex_id(0x5, 00, 0x7c), {Midi_Spec::GS, N_EX("Windchime")}},
+    {midi_ex_id(0x5, 00, 0x7d), {Midi_Spec::GS, N_EX("Siren")}},
+    {midi_ex_id(0x5, 00, 0x7e), {Midi_Spec::GS, N_EX("Footsteps")}},
+    {midi_ex_id(0x6, 00, 0x50), {Midi_Spec::SC88, N_EX("LM Square")}},
+    {midi_ex_id(0x6, 00, 0x51), {Midi_Spec::SC88, N_EX("GR-300")}},
+    {midi_ex_id(0x6, 00, 0x62), {Midi_Spec::SC88, N_EX("Clear Bells")}},
+    {midi_ex_id(0x6, 00, 0x63), {Midi_Spec::SC88, N_EX("Ambient Pad")}},
+    {midi_ex_id(0x6, 00, 0x66), {Midi_Spec::SC88, N_EX("Water Piano")}},
+    {midi_ex_id(0x6, 00, 0x78), {Midi_Spec::SC88, N_EX("Pick Scrape")}},
+    {midi_ex_id(0x6, 00, 0x7d), {Midi_Spec::GS, N_EX("Train")}},
+    {midi_ex_id(0x6, 00, 0x7e), {Midi_Spec::SC88, N_EX("Applause 2")}},
+    {midi_ex_id(0x7, 00, 0x51), {Midi_Spec::SC88, N_EX("LA Saw")}},
+    {midi_ex_id(0x7, 00, 0x62), {Midi_Spec::SC88, N_EX("ChristmasBel")}},
+    {midi_ex_id(0x7, 00, 0x7c), {Midi_Spec::SC88, N_EX("Scratch 2")}},
+    {midi_ex_id(0x7, 00, 0x7d), {Midi_Spec::GS, N_EX("Jetplane")}},
+    {midi_ex_id(0x8, 00, 00), {Midi_Spec::GS, N_EX("Piano 1w")}},
+    {midi_ex_id(0x8, 00, 0x1), {Midi_Spec::GS, N_EX("Piano 2w")}},
+    {midi_ex_id(0x8, 00, 0x2), {Midi_Spec::GS, N_EX("Piano 3w")}},
+    {midi_ex_id(0x8, 00, 0x3), {Midi_Spec::GS, N_EX("Honky-tonk w/Old Upright")}},
+    {midi_ex_id(0x8, 00, 0x4), {Midi_Spec::GS, N_EX("Detuned EP 1")}},
+    {midi_ex_id(0x8, 00, 0x5), {Midi_Spec::GS, N_EX("Detuned EP 2")}},
+    {midi_ex_id(0x8, 00, 0x6), {Midi_Spec::GS, N_EX("Coupled Hps.")}},
+    {midi_ex_id(0x8, 00, 0xb), {Midi_Spec::GS, N_EX("Vib.w")}},
+    {midi_ex_id(0x8, 00, 0xc), {Midi_Spec::GS, N_EX("Marimba w")}},
+    {midi_ex_id(0x8, 00, 0xe), {Midi_Spec::GS, N_EX("Church Bell")}},
+    {midi_ex_id(0x8, 00, 0xf), {Midi_Spec::SC88, N_EX("Cimbalom")}},
+    {midi_ex_id(0x8, 00, 0x10), {Midi_Spec::GS, N_EX("Detuned Or.1")}},
+    {midi_ex_id(0x8, 00, 0x11), {Midi_Spec::GS, N_EX("Detuned Or.2")}},
+    {midi_ex_id(0x8, 00, 0x12), {Midi_Spec::SC88, N_EX("Rotary Org.")}},
+    {midi_ex_id(0x8, 00, 0x13), {Midi_Spec::GS, N_EX("Church Org.2")}},
+    {midi_ex_id(0x8, 00, 0x15), {Midi_Spec::GS, N_EX("Accordion It")}},
+    {midi_ex_id(0x8, 00, 0x18), {Midi_Spec::GS, N_EX("Ukulele")}},
+    {midi_ex_id(0x8, 00, 0x19), {Midi_Spec::GS, N_EX("12-str Guitar")}},
+    {midi_ex_id(0x8, 00, 0x1a), {Midi_Spec::GS, N_EX("Hawaiian Gt./Pedal Steel")}},
+    {midi_ex_id(0x8, 00, 0x1b), {Midi_Spec::GS, N_EX("Chorus Gt.")}},
+    {midi_ex_id(0x8, 00, 0x1c), {Midi_Spec::GS, N_EX("Funk Gt/Funk Pop")}},
+    {midi_ex_id(0x8, 00, 0x1e), {Midi_Spec::GS, N_EX("Feedback Gt.")}},
+    {midi_ex_id(0x8, 00, 0x1f), {Midi_Spec::GS, N_EX("Gt.Feedback")}},
+    {midi_ex_id(0x8, 00, 0x22), {Midi_Spec::SC88, N_EX("Mute PickBs.")}},
+    {midi_ex_id(0x8, 00, 0x24), {Midi_Spec::SC88, N_EX("Reso Slap")}},
+    {midi_ex_id(0x8, 00, 0x26), {Midi_Spec::GS, N_EX("Synth Bass 3/Acid Bass")}},
+    {midi_ex_id(0x8, 00, 0x27), {Midi_Spec::GS, N_EX("Synth Bass 4/Beef FM Bass")}},
+    {midi_ex_id(0x8, 00, 0x28), {Midi_Spec::GS, N_EX("Slow Violin")}},
+    {midi_ex_id(0x8, 00, 0x2c), {Midi_Spec::SC88, N_EX("Slow Tremolo")}},
+    {midi_ex_id(0x8, 00, 0x30), {Midi_Spec::GS, N_EX("Orchestra")}},
+    {midi_ex_id(0x8, 00, 0x31), {Midi_Spec::SC88, N_EX("Legato Str.")}},
+    {midi_ex_id(0x8, 00, 0x32), {Midi_Spec::GS, N_EX("Syn.Strings 3")}},
+    {midi_ex_id(0x8, 00, 0x34), {Midi_Spec::SC88, N_EX("St.Choir")}},
+    {midi_ex_id(0x8, 00, 0x36), {Midi_Spec::SC88, N_EX("Syn.Voice")}},
+    {midi_ex_id(0x8, 00, 0x37), {Midi_Spec::SC88, N_EX("Impact Hit")}},
+    {midi_ex_id(0x8, 00, 0x38), {Midi_Spec::SC88, N_EX("Flugel Horn")}},
+    {midi_ex_id(0x8, 00, 0x3c), {Midi_Spec::SC88, N_EX("Fr.Horn Solo")}},
+    {midi_ex_id(0x8, 00, 0x3d), {Midi_Spec::GS, N_EX("Brass 2")}},
+    {midi_ex_id(0x8, 00, 0x3e), {Midi_Spec::GS, N_EX("Synth Brass 3")}},
+    {midi_ex_id(0x8, 00, 0x3f), {Midi_Spec::GS, N_EX("Synth Brass 4")}},
+    {midi_ex_id(0x8, 00, 0x41), {Midi_Spec::SC88, N_EX("Hyper Alto")}},
+    {midi_ex_id(0x8, 00, 0x42), {Midi_Spec::SC88, N_EX("BreathyTenor")}},
+    {midi_ex_id(0x8, 00, 0x47), {Midi_Spec::SC88, N_EX("Bs.Clarinet")}},
+    {midi_ex_id(0x8, 00, 0x4b), {Midi_Spec::SC88, N_EX("Kawala")}},
+    {midi_ex_id(0x8, 00, 0x50), {Midi_Spec::GS, N_EX("Sine Wave")}},
+    {midi_ex_id(0x8, 00, 0x51), {Midi_Spec::GS, N_EX("Doctor Solo")}},
+    {midi_ex_id(0x8, 00, 0x54), {Midi_Spec::SC88, N_EX("Dist.Lead")}},
+    {midi_ex_id(0x8, 00, 0x5f), {Midi_Spec::SC88, N_EX("Converge")}},
+    {midi_ex_id(0x8, 00, 0x60), {Midi_Spec::SC88, N_EX("Clavi Pad")}},
+    {midi_ex_id(0x8, 00, 0x61), {Midi_Spec::SC88, N_EX("Rave")}},
+    {midi_ex_id(0x8, 00, 0x62), {Midi_Spec::SC88, N_EX("Vibra Bells")}},
+    {midi_ex_id(0x8, 00, 0x68), {Midi_Spec::SC88, N_EX("Tambra")}},
+    {midi_ex_id(0x8, 00, 0x69), {Midi_Spec::SC88, N_EX("Rabab")}},
+    {midi_ex_id(0x8, 00, 0x6b), {Midi_Spec::GS, N_EX("Taisho Koto")}},
+    {midi_ex_id(0x8, 00, 0x6f), {Midi_Spec::SC88, N_EX("Pungi")}},
+    {midi_ex_id(0x8, 00, 0x70), {Midi_Spec::SC88, N_EX("Bonang")}},
+    {midi_ex_id(0x8, 00, 0x71), {Midi_Spec::SC88, N_EX("Atarigane")}},
+    {midi_ex_id(0x8, 00, 0x73), {Midi_Spec::GS, N_EX("Castanets")}},
+    {midi_ex_id(0x8, 00, 0x74), {Midi_Spec::GS, N_EX("Concert Bass Drum")}},
+    {midi_ex_id(0x8, 00, 0x75), {Midi_Spec::GS, N_EX("Melo. Tom 2")}},
+    {midi_ex_id(0x8, 00, 0x76), {Midi_Spec::GS, N_EX("808 Tom")}},
+    {midi_ex_id(0x8, 00, 0x77), {Midi_Spec::SC88, N_EX("Rev.Snare 1")}},
+    {midi_ex_id(0x8, 00, 0x7d), {Midi_Spec::GS, N_EX("Starship")}},
+    {midi_ex_id(0x9, 00, 0xe), {Midi_Spec::GS, N_EX("Carillon")}},
+    {midi_ex_id(0x9, 00, 0x10), {Midi_Spec::SC88, N_EX("Organ 109")}},
+    {midi_ex_id(0x9, 00, 0x19), {Midi_Spec::SC88, N_EX("Nylon+Steel")}},
+    {midi_ex_id(0x9, 00, 0x1e), {Midi_Spec::SC88, N_EX("Feedback Gt2")}},
+    {midi_ex_id(0x9, 00, 0x27), {Midi_Spec::SC88, N_EX("X Wire Bass")}},
+    {midi_ex_id(0x9, 00, 0x2c), {Midi_Spec::SC88, N_EX("Suspense Str")}},
+    {midi_ex_id(0x9, 00, 0x30), {Midi_Spec::SC88, N_EX("Orchestra 2")}},
+    {midi_ex_id(0x9, 00, 0x31), {Midi_Spec::SC88, N_EX("Warm Strings")}},
+    {midi_ex_id(0x9, 00, 0x34), {Midi_Spec::SC88, N_EX("Mello Choir")}},
+    {midi_ex_id(0x9, 00, 0x37), {Midi_Spec::SC88, N_EX("Philly Hit")}},
+    {midi_ex_id(0x9, 00, 0x3e), {Midi_Spec::SC88, N_EX("Quack Brass")}},
+    {midi_ex_id(0x9, 00, 0x5f), {Midi_Spec::SC88, N_EX("Shwimmer")}},
+    {midi_ex_id(0x9, 00, 0x62), {Midi_Spec::SC88, N_EX("Digi Bells")}},
+    {midi_ex_id(0x9, 00, 0x70), {Midi_Spec::SC88, N_EX("Gender")}},
+    {midi_ex_id(0x9, 00, 0x75), {Midi_Spec::SC88, N_EX("Rock Tom")}},
+    {midi_ex_id(0x9, 00, 0x76), {Midi_Spec::GS, N_EX("Elec Perc")}},
+    {midi_ex_id(0x9, 00, 0x77), {Midi_Spec::SC88, N_EX("Rev.Snare 2")}},
+    {midi_ex_id(0x9, 00, 0x7d), {Midi_Spec::GS, N_EX("Burst Noise")}},
+    {midi_ex_id(0xa, 00, 0x26), {Midi_Spec::SC88, N_EX("Tekno Bass")}},
+    {midi_ex_id(0xa, 00, 0x30), {Midi_Spec::SC88, N_EX("Tremolo Orch")}},
+    {midi_ex_id(0xa, 00, 0x31), {Midi_Spec::SC88, N_EX("St.Slow Str.")}},
+    {midi_ex_id(0xa, 00, 0x37), {Midi_Spec::SC88, N_EX("Double Hit")}},
+    {midi_ex_id(0xa, 00, 0x5f), {Midi_Spec::SC88, N_EX("Celestial Pd")}},
+    {midi_ex_id(0xa, 00, 0x70), {Midi_Spec::SC88, N_EX("Gamelan Gong")}},
+    {midi_ex_id(0xb, 00, 0x30), {Midi_Spec::SC88, N_EX("Choir Str.")}},
+    {midi_ex_id(0xb, 00, 0x70), {Midi_Spec::SC88, N_EX("St.Gamelan")}},
+    {midi_ex_id(0x10, 00, 00), {Midi_Spec::GS, N_EX("Piano 1d")}},
+    {midi_ex_id(0x10, 00, 0x4), {Midi_Spec::GS, N_EX("E.Piano 1w")}},
+    {midi_ex_id(0x10, 00, 0x5), {Midi_Spec::GS, N_EX("E.Piano 2w/Soft FM EP")}},
+    {midi_ex_id(0x10, 00, 0x6), {Midi_Spec::GS, N_EX("Harpsi.w")}},
+    {midi_ex_id(0x10, 00, 0xc), {Midi_Spec::SC88, N_EX("Barafon")}},
+    {midi_ex_id(0x10, 00, 0x10), {Midi_Spec::GS, N_EX("60's Organ 1")}},
+    {midi_ex_id(0x10, 00, 0x12), {Midi_Spec::SC88, N_EX("Rotary Org.S")}},
+    {midi_ex_id(0x10, 00, 0x13), {Midi_Spec::GS, N_EX("Church Org.3")}},
+    {midi_ex_id(0x10, 00, 0x18), {Midi_Spec::GS, N_EX("Nylon Gt.o")}},
+    {midi_ex_id(0x10, 00, 0x19), {Midi_Spec::GS, N_EX("Mandolin")}},
+    {midi_ex_id(0x10, 00, 0x1c), {Midi_Spec::GS, N_EX("Funk Gt.2")}},
+    {midi_ex_id(0x10, 00, 0x1e), {Midi_Spec::SC88, N_EX("Power Guitar")}},
+    {midi_ex_id(0x10, 00, 0x1f), {Midi_Spec::SC88, N_EX("Ac.Gt.Harmonx")}},
+    {midi_ex_id(0x10, 00, 0x26), {Midi_Spec::SC88, N_EX("Reso SH Bass")}},
+    {midi_ex_id(0x10, 00, 0x27), {Midi_Spec::GS, N_EX("Rubber Bass")}},
+    {midi_ex_id(0x10, 00, 0x30), {Midi_Spec::SC88, N_EX("St.Strings")}},
+    {midi_ex_id(0x10, 00, 0x37), {Midi_Spec::SC88, N_EX("Lo Fi Rave")}},
+    {midi_ex_id(0x10, 00, 0x3c), {Midi_Spec::SC88, N_EX("Horn Orch")}},
+    {midi_ex_id(0x10, 00, 0x3d), {Midi_Spec::SC88, N_EX("Brass Fall")}},
+    {midi_ex_id(0x10, 00, 0x3e), {Midi_Spec::GS, N_EX("Analog Brass1/Octave Brass")}},
+    {midi_ex_id(0x10, 00, 0x3f), {Midi_Spec::GS, N_EX("Analog Brass 2/Velo Brass 1")}},
+    {midi_ex_id(0x10, 00, 0x51), {Midi_Spec::SC88, N_EX("Waspy Synth")}},
+    {midi_ex_id(0x10, 00, 0x62), {Midi_Spec::SC88, N_EX("Choral Bells")}},
+    {midi_ex_id(0x10, 00, 0x68), {Midi_Spec::SC88, N_EX("Tamboura")}},
+    {midi_ex_id(0x10, 00, 0x69), {Midi_Spec::SC88, N_EX("Gopichant")}},
+    {midi_ex_id(0x10, 00, 0x6b), {Midi_Spec::SC88, N_EX("Kanoon")}},
+    {midi_ex_id(0x10, 00, 0x6f), {Midi_Spec::SC88, N_EX("Hichiriki")}},
+    {midi_ex_id(0x10, 00, 0x70), {Midi_Spec::SC88, N_EX("RAMA Cymbal")}},
+    {midi_ex_id(0x10, 00, 0x77), {Midi_Spec::SC88, N_EX("Rev.Kick 1")}},
+    {midi_ex_id(0x11, 00, 0xc), {Midi_Spec::SC88, N_EX("Barafon 2")}},
+    {midi_ex_id(0x11, 00, 0x10), {Midi_Spec::SC88, N_EX("60's Organ 2")}},
+    {midi_ex_id(0x11, 00, 0x1e), {Midi_Spec::SC88, N_EX("Power Gt.2")}},
+    {midi_ex_id(0x11, 00, 0x27), {Midi_Spec::SC88, N_EX("SH101 Bass 1")}},
+    {midi_ex_id(0x11, 00, 0x3f), {Midi_Spec::SC88, N_EX("Velo Brass 2")}},
+    {midi_ex_id(0x11, 00, 0x62), {Midi_Spec::SC88, N_EX("Air Bells")}},
+    {midi_ex_id(0x11, 00, 0x77), {Midi_Spec::SC88, N_EX("Rev.ConBD")}},
+    {midi_ex_id(0x12, 00, 0x10), {Midi_Spec::SC88, N_EX("60's Organ 3")}},
+    {midi_ex_id(0x12, 00, 0x1e), {Midi_Spec::SC88, N_EX("5th Dist.")}},
+    {midi_ex_id(0x12, 00, 0x27), {Midi_Spec::SC88, N_EX("SH101 Bass 2")}},
+    {midi_ex_id(0x12, 00, 0x62), {Midi_Spec::SC88, N_EX("Bell Harp")}},
+    {midi_ex_id(0x13, 00, 0x27), {Midi_Spec::SC88, N_EX("Smooth Bass")}},
+    {midi_ex_id(0x13, 00, 0x62), {Midi_Spec::SC88, N_EX("Gamelimba")}},
+    {midi_ex_id(0x18, 00, 0x4), {Midi_Spec::GS, N_EX("60's E.Piano")}},
+    {midi_ex_id(0x18, 00, 0x5), {Midi_Spec::SC88, N_EX("Hard FM EP")}},
+    {midi_ex_id(0x18, 00, 0x6), {Midi_Spec::GS, N_EX("Harpsi.o")}},
+    {midi_ex_id(0x18, 00, 0xc), {Midi_Spec::SC88, N_EX("Log Drum")}},
+    {midi_ex_id(0x18, 00, 0x10), {Midi_Spec::SC88, N_EX("Cheese Organ")}},
+    {midi_ex_id(0x18, 00, 0x12), {Midi_Spec::SC88, N_EX("Rotary Org.F")}},
+    {midi_ex_id(0x18, 00, 0x13), {Midi_Spec::SC88, N_EX("Organ Flute")}},
+    {midi_ex_id(0x18, 00, 0x18), {Midi_Spec::SC88, N_EX("Velo Harmnix")}},
+    {midi_ex_id(0x18, 00, 0x1e), {Midi_Spec::SC88, N_EX("Rock Rhythm")}},
+    {midi_ex_id(0x18, 00, 0x30), {Midi_Spec::SC88, N_EX("Velo Strings")}},
+    {midi_ex_id(0x18, 00, 0x38), {Midi_Spec::SC88, N_EX("Bright Tp.")}},
+    {midi_ex_id(0x18, 00, 0x69), {Midi_Spec::SC88, N_EX("Oud")}},
+    {midi_ex_id(0x18, 00, 0x77), {Midi_Spec::SC88, N_EX("Rev.Tom 1")}},
+    {midi_ex_id(0x19, 00, 0x4), {Midi_Spec::SC88, N_EX("Hard Rhodes")}},
+    {midi_ex_id(0x19, 00, 0x1e), {Midi_Spec::SC88, N_EX("Rock Rhythm2")}},
+    {midi_ex_id(0x19, 00, 0x38), {Midi_Spec::SC88, N_EX("Warm Tp.")}},
+    {midi_ex_id(0x19, 00, 0x77), {Midi_Spec::SC88, N_EX("Rev.Tom 2")}},
+    {midi_ex_id(0x1a, 00, 0x4), {Midi_Spec::SC88, N_EX("MellowRhodes")}},
+    {midi_ex_id(0x20, 00, 0x10), {Midi_Spec::GS, N_EX("Organ 4")}},
+    {midi_ex_id(0x20, 00, 0x11), {Midi_Spec::GS, N_EX("Organ 5")}},
+    {midi_ex_id(0x20, 00, 0x13), {Midi_Spec::SC88, N_EX("Trem.Flute")}},
+    {midi_ex_id(0x20, 00, 0x18), {Midi_Spec::GS, N_EX("Nylon Gt.2")}},
+    {midi_ex_id(0x20, 00, 0x19), {Midi_Spec::SC88, N_EX("Steel Gt.2")}},
+    {midi_ex_id(0x20, 00, 0x34), {Midi_Spec::GS, N_EX("Choir Aahs 2")}},
+    {midi_ex_id(0x21, 00, 0x10), {Midi_Spec::SC88, N_EX("Even Bar")}},
+    {midi_ex_id(0x28, 00, 0x10), {Midi_Spec::SC88, N_EX("Organ Bass")}},
+    {midi_ex_id(0x28, 00, 0x18), {Midi_Spec::SC88, N_EX("Lequint Gt.")}},
+    {midi_ex_id(0x7f, 00, 00), {Midi_Spec::MT32, N_EX("Acou Piano 1")}},
+    {midi_ex_id(0x7f, 00, 0x1), {Midi_Spec::MT32, N_EX("Acou Piano 2")}},
+    {midi_ex_id(0x7f, 00, 0x2), {Midi_Spec::MT32, N_EX("Acou Piano 3")}},
+    {midi_ex_id(0x7f, 00, 0x3), {Midi_Spec::MT32, N_EX("Elec Piano 1")}},
+    {midi_ex_id(0x7f, 00, 0x4), {Midi_Spec::MT32, N_EX("Elec Piano 2")}},
+    {midi_ex_id(0x7f, 00, 0x5), {Midi_Spec::MT32, N_EX("Elec Piano 3")}},
+    {midi_ex_id(0x7f, 00, 0x6), {Midi_Spec::MT32, N_EX("Elec Piano 4")}},
+    {midi_ex_id(0x7f, 00, 0x7), {Midi_Spec::MT32, N_EX("Honkytonk")}},
+    {midi_ex_id(0x7f, 00, 0x8), {Midi_Spec::MT32, N_EX("Elec Org 1")}},
+    {midi_ex_id(0x7f, 00, 0x9), {Midi_Spec::MT32, N_EX("Elec Org 2")}},
+    {midi_ex_id(0x7f, 00, 0xa), {Midi_Spec::MT32, N_EX("Elec Org 3")}},
+    {midi_ex_id(0x7f, 00, 0xb), {Midi_Spec::MT32, N_EX("Elec Org 4")}},
+    {midi_ex_id(0x7f, 00, 0xc), {Midi_Spec::MT32, N_EX("Pipe Org 1")}},
+    {midi_ex_id(0x7f, 00, 0xd), {Midi_Spec::MT32, N_EX("Pipe Org 2")}},
+    {midi_ex_id(0x7f, 00, 0xe), {Midi_Spec::MT32, N_EX("Pipe Org 3")}},
+    {midi_ex_id(0x7f, 00, 0xf), {Midi_Spec::MT32, N_EX("Accordion")}},
+    {midi_ex_id(0x7f, 00, 0x10), {Midi_Spec::MT32, N_EX("Harpsi 1")}},
+    {midi_ex_id(0x7f, 00, 0x11), {Midi_Spec::MT32, N_EX("Harpsi 2")}},
+    {midi_ex_id(0x7f, 00, 0x12), {Midi_Spec::MT32, N_EX("Harpsi 3")}},
+    {midi_ex_id(0x7f, 00, 0x13), {Midi_Spec::MT32, N_EX("Clavi 1")}},
+    {midi_ex_id(0x7f, 00, 0x14), {Midi_Spec::MT32, N_EX("Clavi 2")}},
+    {midi_ex_id(0x7f, 00, 0x15), {Midi_Spec::MT32, N_EX("Clavi 3")}},
+    {midi_ex_id(0x7f, 00, 0x16), {Midi_Spec::MT32, N_EX("Celesta 1")}},
+    {midi_ex_id(0x7f, 00, 0x17), {Midi_Spec::MT32, N_EX("Celesta 2")}},
+    {midi_ex_id(0x7f, 00, 0x18), {Midi_Spec::MT32, N_EX("Syn Brass 1")}},
+    {midi_ex_id(0x7f, 00, 0x19), {Midi_Spec::MT32, N_EX("Syn Brass 2")}},
+    {midi_ex_id(0x7f, 00, 0x1a), {Midi_Spec::MT32, N_EX("Syn Brass 3")}},
+    {midi_ex_id(0x7f, 00, 0x1b), {Midi_Spec::MT32, N_EX("Syn Brass 4")}},
+    {midi_ex_id(0x7f, 00, 0x1c), {Midi_Spec::MT32, N_EX("Syn Bass 1")}},
+    {midi_ex_id(0x7f, 00, 0x1d), {Midi_Spec::MT32, N_EX("Syn Bass 2")}},
+    {midi_ex_id(0x7f, 00, 0x1e), {Midi_Spec::MT32, N_EX("Syn Bass 3")}},
+    {midi_ex_id(0x7f, 00, 0x1f), {Midi_Spec::MT32, N_EX("Syn Bass 4")}},
+    {midi_ex_id(0x7f, 00, 0x20), {Midi_Spec::MT32, N_EX("Fantasy")}},
+    {midi_ex_id(0x7f, 00, 0x21), {Midi_Spec::MT32, N_EX("Harmo Pan")}},
+    {midi_ex_id(0x7f, 00, 0x22), {Midi_Spec::MT32, N_EX("Chorale")}},
+    {midi_ex_id(0x7f, 00, 0x23), {Midi_Spec::MT32, N_EX("Glasses")}},
+    {midi_ex_id(0x7f, 00, 0x24), {Midi_Spec::MT32, N_EX("Soundtrack")}},
+    {midi_ex_id(0x7f, 00, 0x25), {Midi_Spec::MT32, N_EX("Atmosphere")}},
+    {midi_ex_id(0x7f, 00, 0x26), {Midi_Spec::MT32, N_EX("Warm Bell")}},
+    {midi_ex_id(0x7f, 00, 0x27), {Midi_Spec::MT32, N_EX("Funny Vox")}},
+    {midi_ex_id(0x7f, 00, 0x28), {Midi_Spec::MT32, N_EX("Echo Bell")}},
+    {midi_ex_id(0x7f, 00, 0x29), {Midi_Spec::MT32, N_EX("Ice Rain")}},
+    {midi_ex_id(0x7f, 00, 0x2a), {Midi_Spec::MT32, N_EX("Oboe 2001")}},
+    {midi_ex_id(0x7f, 00, 0x2b), {Midi_Spec::MT32, N_EX("Echo Pan")}},
+    {midi_ex_id(0x7f, 00, 0x2c), {Midi_Spec::MT32, N_EX("Doctor Solo")}},
+    {midi_ex_id(0x7f, 00, 0x2d), {Midi_Spec::MT32, N_EX("School Daze")}},
+    {midi_ex_id(0x7f, 00, 0x2e), {Midi_Spec::MT32, N_EX("Bellsinger")}},
+    {midi_ex_id(0x7f, 00, 0x2f), {Midi_Spec::MT32, N_EX("Square Wave")}},
+    {midi_ex_id(0x7f, 00, 0x30), {Midi_Spec::MT32, N_EX("Str Sect 1")}},
+    {midi_ex_id(0x7f, 00, 0x31), {Midi_Spec::MT32, N_EX("Str Sect 2")}},
+    {midi_ex_id(0x7f, 00, 0x32), {Midi_Spec::MT32, N_EX("Str Sect 3")}},
+    {midi_ex_id(0x7f, 00, 0x33), {Midi_Spec::MT32, N_EX("Pizzicato")}},
+    {midi_ex_id(0x7f, 00, 0x34), {Midi_Spec::MT32, N_EX("Violin 1")}},
+    {midi_ex_id(0x7f, 00, 0x35), {Midi_Spec::MT32, N_EX("Violin 2")}},
+    {midi_ex_id(0x7f, 00, 0x36), {Midi_Spec::MT32, N_EX("Cello 1")}},
+    {midi_ex_id(0x7f, 00, 0x37), {Midi_Spec::MT32, N_EX("Cello 2")}},
+    {midi_ex_id(0x7f, 00, 0x38), {Midi_Spec::MT32, N_EX("Contrabass")}},
+    {midi_ex_id(0x7f, 00, 0x39), {Midi_Spec::MT32, N_EX("Harp 1")}},
+    {midi_ex_id(0x7f, 00, 0x3a), {Midi_Spec::MT32, N_EX("Harp 2")}},
+    {midi_ex_id(0x7f, 00, 0x3b), {Midi_Spec::MT32, N_EX("Guitar 1")}},
+    {midi_ex_id(0x7f, 00, 0x3c), {Midi_Spec::MT32, N_EX("Guitar 2")}},
+    {midi_ex_id(0x7f, 00, 0x3d), {Midi_Spec::MT32, N_EX("Elec Gtr 1")}},
+    {midi_ex_id(0x7f, 00, 0x3e), {Midi_Spec::MT32, N_EX("Elect Gtr 2")}},
+    {midi_ex_id(0x7f, 00, 0x3f), {Midi_Spec::MT32, N_EX("Sitar")}},
+    {midi_ex_id(0x7f, 00, 0x40), {Midi_Spec::MT32, N_EX("Acou Bass 1")}},
+    {midi_ex_id(0x7f, 00, 0x41), {Midi_Spec::MT32, N_EX("Acou Bass 2")}},
+    {midi_ex_id(0x7f, 00, 0x42), {Midi_Spec::MT32, N_EX("Elec Bass 1")}},
+    {midi_ex_id(0x7f, 00, 0x43), {Midi_Spec::MT32, N_EX("Elec Bass 2")}},
+    {midi_ex_id(0x7f, 00, 0x44), {Midi_Spec::MT32, N_EX("Slap Bass 1")}},
+    {midi_ex_id(0x7f, 00, 0x45), {Midi_Spec::MT32, N_EX("Slap Bass 2")}},
+    {midi_ex_id(0x7f, 00, 0x46), {Midi_Spec::MT32, N_EX("Fretless 1")}},
+    {midi_ex_id(0x7f, 00, 0x47), {Midi_Spec::MT32, N_EX("Fretless 2")}},
+    {midi_ex_id(0x7f, 00, 0x48), {Midi_Spec::MT32, N_EX("Flute 1")}},
+    {midi_ex_id(0x7f, 00, 0x49), {Midi_Spec::MT32, N_EX("Flute 2")}},
+    {midi_ex_id(0x7f, 00, 0x4a), {Midi_Spec::MT32, N_EX("Piccolo 1")}},
+    {midi_ex_id(0x7f, 00, 0x4b), {Midi_Spec::MT32, N_EX("Piccolo 2")}},
+    {midi_ex_id(0x7f, 00, 0x4c), {Midi_Spec::MT32, N_EX("Recorder")}},
+    {midi_ex_id(0x7f, 00, 0x4d), {Midi_Spec::MT32, N_EX("Pan Pipes")}},
+    {midi_ex_id(0x7f, 00, 0x4e), {Midi_Spec::MT32, N_EX("Sax 1")}},
+    {midi_ex_id(0x7f, 00, 0x4f), {Midi_Spec::MT32, N_EX("Sax 2")}},
+    {midi_ex_id(0x7f, 00, 0x50), {Midi_Spec::MT32, N_EX("Sax 3")}},
+    {midi_ex_id(0x7f, 00, 0x51), {Midi_Spec::MT32, N_EX("Sax 4")}},
+    {midi_ex_id(0x7f, 00, 0x52), {Midi_Spec::MT32, N_EX("Clarinet 1")}},
+    {midi_ex_id(0x7f, 00, 0x53), {Midi_Spec::MT32, N_EX("Clarinet 2")}},
+    {midi_ex_id(0x7f, 00, 0x54), {Midi_Spec::MT32, N_EX("Oboe")}},
+    {midi_ex_id(0x7f, 00, 0x55), {Midi_Spec::MT32, N_EX("Engl Horn")}},
+    {midi_ex_id(0x7f, 00, 0x56), {Midi_Spec::MT32, N_EX("Bassoon")}},
+    {midi_ex_id(0x7f, 00, 0x57), {Midi_Spec::MT32, N_EX("Harmonica")}},
+    {midi_ex_id(0x7f, 00, 0x58), {Midi_Spec::MT32, N_EX("Trumpet 1")}},
+    {midi_ex_id(0x7f, 00, 0x59), {Midi_Spec::MT32, N_EX("Trumpet 2")}},
+    {midi_ex_id(0x7f, 00, 0x5a), {Midi_Spec::MT32, N_EX("Trombone 1")}},
+    {midi_ex_id(0x7f, 00, 0x5b), {Midi_Spec::MT32, N_EX("Trombone 2")}},
+    {midi_ex_id(0x7f, 00, 0x5c), {Midi_Spec::MT32, N_EX("Fr Horn 1")}},
+    {midi_ex_id(0x7f, 00, 0x5d), {Midi_Spec::MT32, N_EX("Fr Horn 2")}},
+    {midi_ex_id(0x7f, 00, 0x5e), {Midi_Spec::MT32, N_EX("Tuba")}},
+    {midi_ex_id(0x7f, 00, 0x5f), {Midi_Spec::MT32, N_EX("Brs Sect 1")}},
+    {midi_ex_id(0x7f, 00, 0x60), {Midi_Spec::MT32, N_EX("Brs Sect 2")}},
+    {midi_ex_id(0x7f, 00, 0x61), {Midi_Spec::MT32, N_EX("Vibe 1")}},
+    {midi_ex_id(0x7f, 00, 0x62), {Midi_Spec::MT32, N_EX("Vibe 2")}},
+    {midi_ex_id(0x7f, 00, 0x63), {Midi_Spec::MT32, N_EX("Syn Mallet")}},
+    {midi_ex_id(0x7f, 00, 0x64), {Midi_Spec::MT32, N_EX("Windbell")}},
+    {midi_ex_id(0x7f, 00, 0x65), {Midi_Spec::MT32, N_EX("Glock")}},
+    {midi_ex_id(0x7f, 00, 0x66), {Midi_Spec::MT32, N_EX("Tube Bell")}},
+    {midi_ex_id(0x7f, 00, 0x67), {Midi_Spec::MT32, N_EX("Xylophone")}},
+    {midi_ex_id(0x7f, 00, 0x68), {Midi_Spec::MT32, N_EX("Marimba")}},
+    {midi_ex_id(0x7f, 00, 0x69), {Midi_Spec::MT32, N_EX("Koto")}},
+    {midi_ex_id(0x7f, 00, 0x6a), {Midi_Spec::MT32, N_EX("Sho")}},
+    {midi_ex_id(0x7f, 00, 0x6b), {Midi_Spec::MT32, N_EX("Shakuhachi")}},
+    {midi_ex_id(0x7f, 00, 0x6c), {Midi_Spec::MT32, N_EX("Whistle 1")}},
+    {midi_ex_id(0x7f, 00, 0x6d), {Midi_Spec::MT32, N_EX("Whistle 2")}},
+    {midi_ex_id(0x7f, 00, 0x6e), {Midi_Spec::MT32, N_EX("Bottleblow")}},
+    {midi_ex_id(0x7f, 00, 0x6f), {Midi_Spec::MT32, N_EX("Breathpipe")}},
+    {midi_ex_id(0x7f, 00, 0x70), {Midi_Spec::MT32, N_EX("Timpani")}},
+    {midi_ex_id(0x7f, 00, 0x71), {Midi_Spec::MT32, N_EX("Melodic Tom")}},
+    {midi_ex_id(0x7f, 00, 0x72), {Midi_Spec::MT32, N_EX("Deep Snare")}},
+    {midi_ex_id(0x7f, 00, 0x73), {Midi_Spec::MT32, N_EX("Elec Perc 1")}},
+    {midi_ex_id(0x7f, 00, 0x74), {Midi_Spec::MT32, N_EX("Elec Perc 2")}},
+    {midi_ex_id(0x7f, 00, 0x75), {Midi_Spec::MT32, N_EX("Taiko")}},
+    {midi_ex_id(0x7f, 00, 0x76), {Midi_Spec::MT32, N_EX("Taiko Rim")}},
+    {midi_ex_id(0x7f, 00, 0x77), {Midi_Spec::MT32, N_EX("Cymbal")}},
+    {midi_ex_id(0x7f, 00, 0x78), {Midi_Spec::MT32, N_EX("Castanets")}},
+    {midi_ex_id(0x7f, 00, 0x79), {Midi_Spec::MT32, N_EX("Triangle")}},
+    {midi_ex_id(0x7f, 00, 0x7a), {Midi_Spec::MT32, N_EX("Orche Hit")}},
+    {midi_ex_id(0x7f, 00, 0x7b), {Midi_Spec::MT32, N_EX("Telephone")}},
+    {midi_ex_id(0x7f, 00, 0x7c), {Midi_Spec::MT32, N_EX("Bird Tweet")}},
+    {midi_ex_id(0x7f, 00, 0x7d), {Midi_Spec::MT32, N_EX("One Note Jam")}},
+    {midi_ex_id(0x7f, 00, 0x7e), {Midi_Spec::MT32, N_EX("Water Bell")}},
+    {midi_ex_id(0x7f, 00, 0x7f), {Midi_Spec::MT32, N_EX("Jungle Tune")}},
+};
+
+static constexpr unsigned midi_ex_count =
+    sizeof(midi_ex_names) / sizeof(*midi_ex_names);
+
+static constexpr bool midi_ex_is_sorted(unsigned begin, unsigned end)
 {
-    midi_perc_[0] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 0>")};
-    midi_perc_[1] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 1>")};
-    midi_perc_[2] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 2>")};
-    midi_perc_[3] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 3>")};
-    midi_perc_[4] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 4>")};
-    midi_perc_[5] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 5>")};
-    midi_perc_[6] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 6>")};
-    midi_perc_[7] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 7>")};
-    midi_perc_[8] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 8>")};
-    midi_perc_[9] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 9>")};
-    midi_perc_[10] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 10>")};
-    midi_perc_[11] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 11>")};
-    midi_perc_[12] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 12>")};
-    midi_perc_[13] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Surdo Mute")};
-    midi_perc_[14] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Surdo Open")};
-    midi_perc_[15] = Midi_Program_Ex{Midi_Spec::XG, _PERC("High Q")};
-    midi_perc_[16] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Whip Slap")};
-    midi_perc_[17] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Scratch Push")};
-    midi_perc_[18] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Scratch Pull")};
-    midi_perc_[19] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Finger Snap")};
-    midi_perc_[20] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Click Noise")};
-    midi_perc_[21] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Metronome Click")};
-    midi_perc_[22] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Metronome Bell")};
-    midi_perc_[23] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Seq Click L")};
-    midi_perc_[24] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Seq Click H")};
-    midi_perc_[25] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Brush Tap")};
-    midi_perc_[26] = Midi_Program_Ex{Midi_Spec::XG, _PERC("Brush Swirl L")};
-    midi_perc_[27] = Midi_Program_Ex{Midi_Spec::GS, _PERC("High Q")},  // (XG) Brush Slap
-    midi_perc_[28] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Slap")},  // (XG) Brush Swirl H
-    midi_perc_[29] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Scratch Push")},  // (XG) Snare Roll
-    midi_perc_[30] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Scratch Pull")},  // (XG) Castanet
-    midi_perc_[31] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Sticks")},  // (XG) Snare L
-    midi_perc_[32] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Square Click")},  // (XG) Sticks
-    midi_perc_[33] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Metronome Click")},  // (XG) Bass Drum L
-    midi_perc_[34] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Metronome Bell")},  // (XG) Open Rim Shot
-    midi_perc_[35] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Acoustic Bass Drum")};
-    midi_perc_[36] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Bass Drum 1")};
-    midi_perc_[37] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Side Stick")};
-    midi_perc_[38] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Acoustic Snare")};
-    midi_perc_[39] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Hand Clap")};
-    midi_perc_[40] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Electric Snare")};
-    midi_perc_[41] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Floor Tom")};
-    midi_perc_[42] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Closed High Hat")};
-    midi_perc_[43] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High Floor Tom")};
-    midi_perc_[44] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Pedal High Hat")};
-    midi_perc_[45] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Tom")};
-    midi_perc_[46] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Open High Hat")};
-    midi_perc_[47] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low-Mid Tom")};
-    midi_perc_[48] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High-Mid Tom")};
-    midi_perc_[49] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Crash Cymbal 1")};
-    midi_perc_[50] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High Tom")};
-    midi_perc_[51] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Ride Cymbal 1")};
-    midi_perc_[52] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Chinese Cymbal")};
-    midi_perc_[53] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Ride Bell")};
-    midi_perc_[54] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Tambourine")};
-    midi_perc_[55] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Splash Cymbal")};
-    midi_perc_[56] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Cow Bell")};
-    midi_perc_[57] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Crash Cymbal 2")};
-    midi_perc_[58] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Vibraslap")};
-    midi_perc_[59] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Ride Cymbal 2")};
-    midi_perc_[60] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High Bongo")};
-    midi_perc_[61] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Bongo")};
-    midi_perc_[62] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Mute High Conga")};
-    midi_perc_[63] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Open High Conga")};
-    midi_perc_[64] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Conga")};
-    midi_perc_[65] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High Timbale")};
-    midi_perc_[66] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Timbale")};
-    midi_perc_[67] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High Agogo")};
-    midi_perc_[68] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Agogo")};
-    midi_perc_[69] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Cabasa")};
-    midi_perc_[70] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Maracas")};
-    midi_perc_[71] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Short Whistle")};
-    midi_perc_[72] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Long Whistle")};
-    midi_perc_[73] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Short Guiro")};
-    midi_perc_[74] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Long Guiro")};
-    midi_perc_[75] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Claves")};
-    midi_perc_[76] = Midi_Program_Ex{Midi_Spec::GM, _PERC("High Wood Block")};
-    midi_perc_[77] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Low Wood Block")};
-    midi_perc_[78] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Mute Cuica")};
-    midi_perc_[79] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Open Cuica")};
-    midi_perc_[80] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Mute Triangle")};
-    midi_perc_[81] = Midi_Program_Ex{Midi_Spec::GM, _PERC("Open Triangle")};
-    midi_perc_[82] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Shaker")};
-    midi_perc_[83] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Jingle Bell")};
-    midi_perc_[84] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Bell Tree")};
-    midi_perc_[85] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Castanets")};
-    midi_perc_[86] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Mute Surdu")};
-    midi_perc_[87] = Midi_Program_Ex{Midi_Spec::GS, _PERC("Open Surdu")};
-    midi_perc_[88] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 88>")};
-    midi_perc_[89] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 89>")};
-    midi_perc_[90] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 90>")};
-    midi_perc_[91] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 91>")};
-    midi_perc_[92] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 92>")};
-    midi_perc_[93] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 93>")};
-    midi_perc_[94] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 94>")};
-    midi_perc_[95] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 95>")};
-    midi_perc_[96] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 96>")};
-    midi_perc_[97] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 97>")};
-    midi_perc_[98] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 98>")};
-    midi_perc_[99] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 99>")};
-    midi_perc_[100] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 100>")};
-    midi_perc_[101] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 101>")};
-    midi_perc_[102] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 102>")};
-    midi_perc_[103] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 103>")};
-    midi_perc_[104] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 104>")};
-    midi_perc_[105] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 105>")};
-    midi_perc_[106] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 106>")};
-    midi_perc_[107] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 107>")};
-    midi_perc_[108] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 108>")};
-    midi_perc_[109] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 109>")};
-    midi_perc_[110] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 110>")};
-    midi_perc_[111] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 111>")};
-    midi_perc_[112] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 112>")};
-    midi_perc_[113] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 113>")};
-    midi_perc_[114] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 114>")};
-    midi_perc_[115] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 115>")};
-    midi_perc_[116] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 116>")};
-    midi_perc_[117] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 117>")};
-    midi_perc_[118] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 118>")};
-    midi_perc_[119] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 119>")};
-    midi_perc_[120] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 120>")};
-    midi_perc_[121] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 121>")};
-    midi_perc_[122] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 122>")};
-    midi_perc_[123] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 123>")};
-    midi_perc_[124] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 124>")};
-    midi_perc_[125] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 125>")};
-    midi_perc_[126] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 126>")};
-    midi_perc_[127] = Midi_Program_Ex{Midi_Spec::GM, _PERC("<Reserved 127>")};
+    // bisects to keep the recursion shallow
+    return (end - begin < 2) ? true :
+        (end - begin == 2) ? (midi_ex_names[begin].id < midi_ex_names[begin + 1].id) :
+        (midi_ex_is_sorted(begin, begin + (end - begin) / 2 + 1) &&
+         midi_ex_is_sorted(begin + (end - begin) / 2, end));
 }
 
-static inline unsigned midi_ex_id(
-    unsigned msb, unsigned lsb, unsigned pgm)
+static_assert(midi_ex_is_sorted(0, midi_ex_count),
+              "the extended instrument table must be sorted by identifier");
+
+// the translations, zero-initialized, filled on first use
+static const char *midi_inst_translated[128];
+static Midi_Program_Ex midi_perc_translated[128];
+static Midi_Program_Ex midi_ex_translated[midi_ex_count];
+
+const char *Midi_Db::inst(unsigned id7)
 {
-    return ((msb & 0x7f) << 14) | ((lsb & 0x7f) << 7) | (pgm & 0x7f);
+    const char *&name = midi_inst_translated[id7 & 127];
+    if (!name)
+        name = _INST(midi_inst_names[id7 & 127]);
+    return name;
 }
 
-void Midi_Db::init_midi_ex()
+const Midi_Program_Ex &Midi_Db::perc(unsigned id7)
 {
-    midi_ex_[midi_ex_id(0x1, 00, 0x26)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Synth Bass 101")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x39)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Trombone 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x3c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("French Horn2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Square")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Saw")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Syn Mallet")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Echo Bell")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x68)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Sitar 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Gt. Cut Noise")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x79)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Flute Key Click")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x7a)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Rain")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x7b)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Dog")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Telephone 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Car-Engine")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Laughing")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x7f)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Machine Gun")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Echo Pan")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::GS, _EX("String Slap")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x7a)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Thunder")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x7b)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Horse-Gallop")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Door Creaking")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Car-Stop")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Screaming")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x7f)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Lasergun")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x7a)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Wind")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x7b)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Bird 2")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Door Close")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Car-Pass")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Punch")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x7f)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Explosion")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x7a)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Stream")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Scratch")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Car-Crash")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Heart Beat")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x7a)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Bubble")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Windchime")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Siren")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Footsteps")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Train")};
-    midi_ex_[midi_ex_id(0x7, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Jetplane")};
-    midi_ex_[midi_ex_id(0x8, 00, 00)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Piano 1w")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x1)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Piano 2w")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x2)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Piano 3w")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x3)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Honky-tonk w/Old Upright")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x4)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Detuned EP 1")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x5)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Detuned EP 2")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x6)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Coupled Hps.")};
-    midi_ex_[midi_ex_id(0x8, 00, 0xb)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Vib.w")};
-    midi_ex_[midi_ex_id(0x8, 00, 0xc)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Marimba w")};
-    midi_ex_[midi_ex_id(0x8, 00, 0xe)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Church Bell")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Detuned Or.1")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x11)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Detuned Or.2")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x13)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Church Org.2")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x15)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Accordion It")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x18)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Ukulele")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x19)] = Midi_Program_Ex{Midi_Spec::GS, _EX("12-str Guitar")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x1a)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Hawaiian Gt./Pedal Steel")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x1b)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Chorus Gt.")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x1c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Funk Gt/Funk Pop")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Feedback Gt.")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x1f)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Gt.Feedback")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x26)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Synth Bass 3/Acid Bass")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Synth Bass 4/Beef FM Bass")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x28)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Slow Violin")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Orchestra")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x32)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Syn.Strings 3")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x3d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Brass 2")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x3e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Synth Brass 3")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x3f)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Synth Brass 4")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Sine Wave")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Doctor Solo")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x6b)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Taisho Koto")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x73)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Castanets")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x74)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Concert Bass Drum")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x75)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Melo. Tom 2")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x76)] = Midi_Program_Ex{Midi_Spec::GS, _EX("808 Tom")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Starship")};
-    midi_ex_[midi_ex_id(0x9, 00, 0xe)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Carillon")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x76)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Elec Perc")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Burst Noise")};
-    midi_ex_[midi_ex_id(0x10, 00, 00)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Piano 1d")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x4)] = Midi_Program_Ex{Midi_Spec::GS, _EX("E.Piano 1w")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x5)] = Midi_Program_Ex{Midi_Spec::GS, _EX("E.Piano 2w/Soft FM EP")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x6)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Harpsi.w")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::GS, _EX("60's Organ 1")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x13)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Church Org.3")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x18)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Nylon Gt.o")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x19)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Mandolin")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x1c)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Funk Gt.2")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Rubber Bass")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x3e)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Analog Brass1/Octave Brass")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x3f)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Analog Brass 2/Velo Brass 1")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x4)] = Midi_Program_Ex{Midi_Spec::GS, _EX("60's E.Piano")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x6)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Harpsi.o")};
-    midi_ex_[midi_ex_id(0x20, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Organ 4")};
-    midi_ex_[midi_ex_id(0x20, 00, 0x11)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Organ 5")};
-    midi_ex_[midi_ex_id(0x20, 00, 0x18)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Nylon Gt.2")};
-    midi_ex_[midi_ex_id(0x20, 00, 0x34)] = Midi_Program_Ex{Midi_Spec::GS, _EX("Choir Aahs 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x2)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("EG+Rhodes1")};
-    midi_ex_[midi_ex_id(0x1, 00, 0xb)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Hard Vibe")};
-    midi_ex_[midi_ex_id(0x1, 00, 0xf)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Santur 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Organ 101")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x11)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Organ 201")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x16)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Harmonica 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x1a)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Mellow Gt.")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x1c)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Muted Dis.Gt")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Dist.Gt 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x21)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fingered Bs2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x23)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fretless Bs2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Synth Bass 201")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Strings 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x31)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("SlowStrings2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x32)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("OB Strings")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x38)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Trumpet 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x3a)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tuba 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x3e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Poly Brass")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x3f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Soft Brass")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x52)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Vent Synth")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x56)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Big Fives")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x57)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Big & Raw")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x58)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fantasia 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x59)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Thick Pad")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x5a)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("80's PolySyn")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x5b)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Heaven II")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x5d)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tine Pad")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x5f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Polar Pad")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x60)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Harmo Rain")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x61)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Ancestral")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Warm Atmos")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x65)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Goblinson")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x67)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Star Theme 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x69)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Muted Banjo")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x6a)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tsugaru")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x6f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Shanai 2")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x75)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Real Tom")};
-    midi_ex_[midi_ex_id(0x1, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Reverse Cym2")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x2)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("EG+Rhodes2")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Dazed Guitar")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x21)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Jazz Bass")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x23)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fretless Bs3")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Modular Bass")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Hollow Mini")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Pulse Saw")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x52)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Pure PanLead")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x57)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fat & Perky")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x59)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Horn Pad")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x5d)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Panner Pad")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x60)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("African Wood")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x61)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Prologue")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Soft Crystal")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Nylon Harp")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x65)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("50's Sci-Fi")};
-    midi_ex_[midi_ex_id(0x2, 00, 0x68)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Detune Sitar")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x23)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fretless Bs4")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Seq Bass")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Mellow FM")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Feline GR")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x59)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("RotaryString")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Round Glock")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Harpvox")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Echo Pan 2")};
-    midi_ex_[midi_ex_id(0x3, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Gt.CutNoise2")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("CC Solo")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Big Lead")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x59)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Soft Pad")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Loud Glock")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("HollowReleas")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Big Panner")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Dist.CutNoise")};
-    midi_ex_[midi_ex_id(0x4, 00, 0x7b)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Kitty")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x23)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Mr.Smooth")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Shmoog")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Velo Lead")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("GlockenChime")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Nylon+Rhodes")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Reso Panner")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Bass Slide")};
-    midi_ex_[midi_ex_id(0x5, 00, 0x7b)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Growl")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("LM Square")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("GR-300")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Clear Bells")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Ambient Pad")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Water Piano")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Pick Scrape")};
-    midi_ex_[midi_ex_id(0x6, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Applause 2")};
-    midi_ex_[midi_ex_id(0x7, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("LA Saw")};
-    midi_ex_[midi_ex_id(0x7, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("ChristmasBel")};
-    midi_ex_[midi_ex_id(0x7, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Scratch 2")};
-    midi_ex_[midi_ex_id(0x8, 00, 0xf)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Cimbalom")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x12)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rotary Org.")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x22)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Mute PickBs.")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x24)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Reso Slap")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x2c)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Slow Tremolo")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x31)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Legato Str.")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x34)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("St.Choir")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x36)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Syn.Voice")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x37)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Impact Hit")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x38)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Flugel Horn")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x3c)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Fr.Horn Solo")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x41)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Hyper Alto")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x42)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("BreathyTenor")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x47)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Bs.Clarinet")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x4b)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Kawala")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x54)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Dist.Lead")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x5f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Converge")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x60)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Clavi Pad")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x61)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rave")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Vibra Bells")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x68)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tambra")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x69)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rabab")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x6f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Pungi")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x70)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Bonang")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x71)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Atarigane")};
-    midi_ex_[midi_ex_id(0x8, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rev.Snare 1")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Organ 109")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x19)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Nylon+Steel")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Feedback Gt2")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("X Wire Bass")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x2c)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Suspense Str")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Orchestra 2")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x31)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Warm Strings")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x34)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Mello Choir")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x37)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Philly Hit")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x3e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Quack Brass")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x5f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Shwimmer")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Digi Bells")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x70)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Gender")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x75)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rock Tom")};
-    midi_ex_[midi_ex_id(0x9, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rev.Snare 2")};
-    midi_ex_[midi_ex_id(0xa, 00, 0x26)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tekno Bass")};
-    midi_ex_[midi_ex_id(0xa, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tremolo Orch")};
-    midi_ex_[midi_ex_id(0xa, 00, 0x31)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("St.Slow Str.")};
-    midi_ex_[midi_ex_id(0xa, 00, 0x37)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Double Hit")};
-    midi_ex_[midi_ex_id(0xa, 00, 0x5f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Celestial Pd")};
-    midi_ex_[midi_ex_id(0xa, 00, 0x70)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Gamelan Gong")};
-    midi_ex_[midi_ex_id(0xb, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Choir Str.")};
-    midi_ex_[midi_ex_id(0xb, 00, 0x70)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("St.Gamelan")};
-    midi_ex_[midi_ex_id(0x10, 00, 0xc)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Barafon")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x12)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rotary Org.S")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Power Guitar")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x1f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Ac.Gt.Harmonx")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x26)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Reso SH Bass")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("St.Strings")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x37)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Lo Fi Rave")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x3c)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Horn Orch")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x3d)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Brass Fall")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Waspy Synth")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Choral Bells")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x68)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Tamboura")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x69)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Gopichant")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x6b)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Kanoon")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x6f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Hichiriki")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x70)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("RAMA Cymbal")};
-    midi_ex_[midi_ex_id(0x10, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rev.Kick 1")};
-    midi_ex_[midi_ex_id(0x11, 00, 0xc)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Barafon 2")};
-    midi_ex_[midi_ex_id(0x11, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("60's Organ 2")};
-    midi_ex_[midi_ex_id(0x11, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Power Gt.2")};
-    midi_ex_[midi_ex_id(0x11, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("SH101 Bass 1")};
-    midi_ex_[midi_ex_id(0x11, 00, 0x3f)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Velo Brass 2")};
-    midi_ex_[midi_ex_id(0x11, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Air Bells")};
-    midi_ex_[midi_ex_id(0x11, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rev.ConBD")};
-    midi_ex_[midi_ex_id(0x12, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("60's Organ 3")};
-    midi_ex_[midi_ex_id(0x12, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("5th Dist.")};
-    midi_ex_[midi_ex_id(0x12, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("SH101 Bass 2")};
-    midi_ex_[midi_ex_id(0x12, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Bell Harp")};
-    midi_ex_[midi_ex_id(0x13, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Smooth Bass")};
-    midi_ex_[midi_ex_id(0x13, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Gamelimba")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x5)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Hard FM EP")};
-    midi_ex_[midi_ex_id(0x18, 00, 0xc)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Log Drum")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Cheese Organ")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x12)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rotary Org.F")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x13)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Organ Flute")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x18)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Velo Harmnix")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rock Rhythm")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Velo Strings")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x38)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Bright Tp.")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x69)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Oud")};
-    midi_ex_[midi_ex_id(0x18, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rev.Tom 1")};
-    midi_ex_[midi_ex_id(0x19, 00, 0x4)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Hard Rhodes")};
-    midi_ex_[midi_ex_id(0x19, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rock Rhythm2")};
-    midi_ex_[midi_ex_id(0x19, 00, 0x38)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Warm Tp.")};
-    midi_ex_[midi_ex_id(0x19, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Rev.Tom 2")};
-    midi_ex_[midi_ex_id(0x1a, 00, 0x4)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("MellowRhodes")};
-    midi_ex_[midi_ex_id(0x20, 00, 0x13)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Trem.Flute")};
-    midi_ex_[midi_ex_id(0x20, 00, 0x19)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Steel Gt.2")};
-    midi_ex_[midi_ex_id(0x21, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Even Bar")};
-    midi_ex_[midi_ex_id(0x28, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Organ Bass")};
-    midi_ex_[midi_ex_id(0x28, 00, 0x18)] = Midi_Program_Ex{Midi_Spec::SC88, _EX("Lequint Gt.")};
-    midi_ex_[midi_ex_id(0x7f, 00, 00)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Acou Piano 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Acou Piano 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Acou Piano 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Piano 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Piano 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Piano 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Piano 4")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Honkytonk")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x8)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Org 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x9)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Org 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0xa)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Org 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0xb)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Org 4")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0xc)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Pipe Org 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0xd)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Pipe Org 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0xe)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Pipe Org 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0xf)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Accordion")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x10)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harpsi 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x11)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harpsi 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x12)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harpsi 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x13)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Clavi 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x14)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Clavi 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x15)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Clavi 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x16)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Celesta 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x17)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Celesta 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x18)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Brass 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x19)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Brass 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Brass 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Brass 4")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Bass 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Bass 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Bass 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x1f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Bass 4")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x20)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Fantasy")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x21)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harmo Pan")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x22)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Chorale")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x23)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Glasses")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x24)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Soundtrack")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x25)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Atmosphere")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x26)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Warm Bell")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x27)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Funny Vox")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x28)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Echo Bell")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x29)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Ice Rain")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Oboe 2001")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Echo Pan")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Doctor Solo")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("School Daze")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Bellsinger")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x2f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Square Wave")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x30)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Str Sect 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x31)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Str Sect 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x32)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Str Sect 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x33)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Pizzicato")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x34)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Violin 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x35)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Violin 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x36)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Cello 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x37)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Cello 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x38)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Contrabass")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x39)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harp 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harp 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Guitar 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Guitar 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Gtr 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elect Gtr 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x3f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Sitar")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x40)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Acou Bass 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x41)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Acou Bass 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x42)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Bass 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x43)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Bass 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x44)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Slap Bass 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x45)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Slap Bass 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x46)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Fretless 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x47)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Fretless 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x48)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Flute 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x49)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Flute 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Piccolo 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Piccolo 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Recorder")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Pan Pipes")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Sax 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x4f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Sax 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x50)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Sax 3")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x51)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Sax 4")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x52)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Clarinet 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x53)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Clarinet 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x54)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Oboe")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x55)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Engl Horn")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x56)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Bassoon")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x57)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Harmonica")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x58)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Trumpet 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x59)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Trumpet 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Trombone 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Trombone 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Fr Horn 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Fr Horn 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Tuba")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x5f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Brs Sect 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x60)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Brs Sect 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x61)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Vibe 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x62)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Vibe 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x63)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Syn Mallet")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x64)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Windbell")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x65)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Glock")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x66)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Tube Bell")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x67)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Xylophone")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x68)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Marimba")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x69)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Koto")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Sho")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Shakuhachi")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Whistle 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Whistle 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Bottleblow")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x6f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Breathpipe")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x70)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Timpani")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x71)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Melodic Tom")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x72)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Deep Snare")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x73)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Perc 1")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x74)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Elec Perc 2")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x75)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Taiko")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x76)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Taiko Rim")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x77)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Cymbal")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x78)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Castanets")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x79)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Triangle")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7a)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Orche Hit")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7b)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Telephone")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7c)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Bird Tweet")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7d)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("One Note Jam")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7e)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Water Bell")};
-    midi_ex_[midi_ex_id(0x7f, 00, 0x7f)] = Midi_Program_Ex{Midi_Spec::MT32, _EX("Jungle Tune")};
-    midi_ex_[midi_ex_id(00, 0x1, 00)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Grand PianoK")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x1)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Bright Piano K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x2)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Electric Grand Piano K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x3)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Honky Tonk K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x4)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Electric Piano 1K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Electric Piano2 K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x6)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Harpsichord K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0x7)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Clavinet K")};
-    midi_ex_[midi_ex_id(00, 0x1, 0xb)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VibesK")};
-    midi_ex_[midi_ex_id(00, 0x1, 0xc)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Marimba K")};
-    midi_ex_[midi_ex_id(00, 0x3, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("S.Strngs")};
-    midi_ex_[midi_ex_id(00, 0x3, 0x31)] = Midi_Program_Ex{Midi_Spec::XG, _EX("S.SlwStr")};
-    midi_ex_[midi_ex_id(00, 0x3, 0x34)] = Midi_Program_Ex{Midi_Spec::XG, _EX("S.Choir")};
-    midi_ex_[midi_ex_id(00, 0x6, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MelloSB1")};
-    midi_ex_[midi_ex_id(00, 0x6, 0x3c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FrHrSolo")};
-    midi_ex_[midi_ex_id(00, 0x6, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Square 2")};
-    midi_ex_[midi_ex_id(00, 0x6, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Saw 2")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x28)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SlowVln")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x2c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SlowTrStr")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SlowStr")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x31)] = Midi_Program_Ex{Midi_Spec::XG, _EX("LegatoSt")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("LMSquare")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ThickSaw")};
-    midi_ex_[midi_ex_id(00, 0x8, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("EchoPad2")};
-    midi_ex_[midi_ex_id(00, 0xc, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Seq Bass")};
-    midi_ex_[midi_ex_id(00, 0xc, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("QuackBr")};
-    midi_ex_[midi_ex_id(00, 0xc, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynDrCmp")};
-    midi_ex_[midi_ex_id(00, 0xe, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Popcorn")};
-    midi_ex_[midi_ex_id(00, 0xe, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Echo Pan")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x18)] = Midi_Program_Ex{Midi_Spec::XG, _EX("NylonGt2")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x19)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SteelGt2")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x34)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ch.Aahs2")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x38)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Trumpet2")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x3a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Tuba 2")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x57)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Big&Low")};
-    midi_ex_[midi_ex_id(00, 0x10, 0x59)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ThickPad")};
-    midi_ex_[midi_ex_id(00, 0x11, 0x38)] = Midi_Program_Ex{Midi_Spec::XG, _EX("BriteTrp")};
-    midi_ex_[midi_ex_id(00, 0x11, 0x59)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Soft Pad")};
-    midi_ex_[midi_ex_id(00, 0x12, 00)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MelloGrP")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x4)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MelloEP1")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x1a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MelloGtr")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x21)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FingrDrk")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynBa1Dk")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynBa1Dk")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x28)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ClkSynBa")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x39)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Trmbone2")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x3f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Soft Brs")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Hollow")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DynaSaw")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x59)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SinePad")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("TinyBell")};
-    midi_ex_[midi_ex_id(00, 0x12, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("WarmAtms")};
-    midi_ex_[midi_ex_id(00, 0x13, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynBa2Dk")};
-    midi_ex_[midi_ex_id(00, 0x13, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Shmoog")};
-    midi_ex_[midi_ex_id(00, 0x13, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DigiSaw")};
-    midi_ex_[midi_ex_id(00, 0x13, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HollwRls")};
-    midi_ex_[midi_ex_id(00, 0x14, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FastResB")};
-    midi_ex_[midi_ex_id(00, 0x14, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("RezSynBr")};
-    midi_ex_[midi_ex_id(00, 0x14, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Big Lead")};
-    midi_ex_[midi_ex_id(00, 0x14, 0x5f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Shwimmer")};
-    midi_ex_[midi_ex_id(00, 0x18, 0x11)] = Midi_Program_Ex{Midi_Spec::XG, _EX("70sPcOr1")};
-    midi_ex_[midi_ex_id(00, 0x18, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AcidBass")};
-    midi_ex_[midi_ex_id(00, 0x18, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ArcoStr")};
-    midi_ex_[midi_ex_id(00, 0x18, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PolyBrss")};
-    midi_ex_[midi_ex_id(00, 0x18, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HeavySyn")};
-    midi_ex_[midi_ex_id(00, 0x18, 0x55)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynthAah")};
-    midi_ex_[midi_ex_id(00, 0x19, 0x6)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Harpsi.2")};
-    midi_ex_[midi_ex_id(00, 0x19, 0x18)] = Midi_Program_Ex{Midi_Spec::XG, _EX("NylonGt3")};
-    midi_ex_[midi_ex_id(00, 0x19, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("WaspySyn")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x7)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ClaviWah")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x21)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FlangeBa")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x24)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ResoSlap")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x32)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ResoStr")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynBras3")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x5f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Converge")};
-    midi_ex_[midi_ex_id(00, 0x1b, 0x61)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Prologue")};
-    midi_ex_[midi_ex_id(00, 0x1c, 0x22)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MutePkBa")};
-    midi_ex_[midi_ex_id(00, 0x1c, 0x69)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MuteBnjo")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x2)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Det.CP80")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x4)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Chor.EP1")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Chor.EP2")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DetDrwOr")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x11)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DetPrcOr")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x13)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ChurOrg3")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x15)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AccordIt")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x16)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Harmo 2")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x1a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("JazzAmp")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x1b)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ChorusGt")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x23)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Fretles2")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x24)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PunchThm")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SmthBa 2")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x34)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MelChoir")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x38)] = Midi_Program_Ex{Midi_Spec::XG, _EX("WarmTrp")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x3c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FrHorn2")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("JumpBrss")};
-    midi_ex_[midi_ex_id(00, 0x20, 0x68)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DetSitar")};
-    midi_ex_[midi_ex_id(00, 0x21, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DX Hard")};
-    midi_ex_[midi_ex_id(00, 0x21, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("60sDrOr1")};
-    midi_ex_[midi_ex_id(00, 0x21, 0x11)] = Midi_Program_Ex{Midi_Spec::XG, _EX("LiteOrg")};
-    midi_ex_[midi_ex_id(00, 0x21, 0x23)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Fretles3")};
-    midi_ex_[midi_ex_id(00, 0x22, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DXLegend")};
-    midi_ex_[midi_ex_id(00, 0x22, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("60sDrOr2")};
-    midi_ex_[midi_ex_id(00, 0x22, 0x23)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Fretles4")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x6)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Harpsi.3")};
-    midi_ex_[midi_ex_id(00, 0x23, 0xf)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Dulcimr2")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("70sDrOr1")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x13)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ChurOrg2")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x19)] = Midi_Program_Ex{Midi_Spec::XG, _EX("12StrGtr")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Clv Bass")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("60sStrng")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x37)] = Midi_Program_Ex{Midi_Spec::XG, _EX("OrchHit2")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x3d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Tp&TbSec")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x56)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Big Five")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("RndGlock")};
-    midi_ex_[midi_ex_id(00, 0x23, 0x68)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Sitar 2")};
-    midi_ex_[midi_ex_id(00, 0x24, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DrawOrg2")};
-    midi_ex_[midi_ex_id(00, 0x25, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("60sDrOr3")};
-    midi_ex_[midi_ex_id(00, 0x25, 0x11)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PercOrg2")};
-    midi_ex_[midi_ex_id(00, 0x25, 0x3c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HornOrch")};
-    midi_ex_[midi_ex_id(00, 0x26, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("EvenBar")};
-    midi_ex_[midi_ex_id(00, 0x28, 00)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PianoStr")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x2)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ElGrPno1")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x4)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HardEl.P")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DX Phase")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("16+2\"2/3")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x13)] = Midi_Program_Ex{Midi_Spec::XG, _EX("NotreDam")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x14)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Puff Org")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x19)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Nyln&Stl")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x1c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FunkGtr1")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x1e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FeedbkGt")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x20)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Jazz Rhythm")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x21)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ba&DstEG")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Techno Bass")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Modular Bass")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x2c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Susp Str")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x2e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Yang Chin")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Orchestra")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x31)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Warm Str")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x34)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ChoirStr")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x36)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynVox2")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x3d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("BrassSec2")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x3f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynBras4")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x41)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Sax Sect")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x42)] = Midi_Program_Ex{Midi_Spec::XG, _EX("BrthTnSx")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Pulse Saw")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("GlockChi")};
-    midi_ex_[midi_ex_id(00, 0x28, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("NylonEP")};
-    midi_ex_[midi_ex_id(00, 0x29, 00)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Dream")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x2)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ElGrPno2")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DX+Analg")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x19)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Stl&Body")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x1c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MuteStlG")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x1e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FeedbGt2")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DX Bass")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Orchstr2")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x31)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Kingdom")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x36)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Choral")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x3d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HiBrass")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x3f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ChorBrss")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x42)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SoftTenr")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Dr. Lead")};
-    midi_ex_[midi_ex_id(00, 0x29, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ClearBel")};
-    midi_ex_[midi_ex_id(00, 0x2a, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DXKotoEP")};
-    midi_ex_[midi_ex_id(00, 0x2a, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("TremOrch")};
-    midi_ex_[midi_ex_id(00, 0x2a, 0x3d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("MelloBrs")};
-    midi_ex_[midi_ex_id(00, 0x2a, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ChorBell")};
-    midi_ex_[midi_ex_id(00, 0x2b, 0x18)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VelGtHrm")};
-    midi_ex_[midi_ex_id(00, 0x2b, 0x1c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FunkGtr2")};
-    midi_ex_[midi_ex_id(00, 0x2b, 0x1d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Gt.Pinch")};
-    midi_ex_[midi_ex_id(00, 0x2b, 0x21)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FngrSlap")};
-    midi_ex_[midi_ex_id(00, 0x2b, 0x25)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VeloSlap")};
-    midi_ex_[midi_ex_id(00, 0x2b, 0x41)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HyprAlto")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x4)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VX El.P1")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x5)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VX El.P2")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0xb)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HardVibe")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x1c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Jazz Man")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x20)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VX Upright")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x21)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FngBass2")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x30)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VeloStr")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AnaVelBr")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x3f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VelBras2")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VeloLead")};
-    midi_ex_[midi_ex_id(00, 0x2d, 0x60)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ClaviPad")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x4)] = Midi_Program_Ex{Midi_Spec::XG, _EX("60sEl.P")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x7)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PulseClv")};
-    midi_ex_[midi_ex_id(00, 0x40, 0xa)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Orgel")};
-    midi_ex_[midi_ex_id(00, 0x40, 0xc)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SineMrmb")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Organ Ba")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x12)] = Midi_Program_Ex{Midi_Spec::XG, _EX("RotaryOr")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x13)] = Midi_Program_Ex{Midi_Spec::XG, _EX("OrgFlute")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x17)] = Midi_Program_Ex{Midi_Spec::XG, _EX("TngoAcd2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Oscar")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x27)] = Midi_Program_Ex{Midi_Spec::XG, _EX("X WireBa")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x31)] = Midi_Program_Ex{Midi_Spec::XG, _EX("70s Str")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x32)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Syn Str4")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x36)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AnaVoice")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x37)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Impact")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x3e)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AnaBrss1")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x3f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AnaBras2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x42)] = Midi_Program_Ex{Midi_Spec::XG, _EX("TnrSax 2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Mellow")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x53)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Rubby")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x54)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DistLead")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x55)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VoxLead")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x57)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Fat&Prky")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x58)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Fantasy2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x59)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Horn Pad")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x5a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PolyPd80")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x5b)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Heaven2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x5c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Glacier")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x5d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Tine Pad")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x5f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PolarPad")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x60)] = Midi_Program_Ex{Midi_Spec::XG, _EX("HrmoRain")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x61)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ancestrl")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynMalet")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("NylnHarp")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x64)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FantaBel")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("GobSyn")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("EchoBell")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x67)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Starz")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x6f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Shanai2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x75)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Mel Tom2")};
-    midi_ex_[midi_ex_id(00, 0x40, 0x76)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ana Tom")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x7)] = Midi_Program_Ex{Midi_Spec::XG, _EX("PierceCl")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("70sDrOr2")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x12)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SlwRotar")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x13)] = Midi_Program_Ex{Midi_Spec::XG, _EX("TrmOrgFl")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x1f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("GtFeedbk")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x21)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ModAlem")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SqrBass")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x32)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SS Str")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SoloSine")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x52)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Pure Pad")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x54)] = Midi_Program_Ex{Midi_Spec::XG, _EX("WireLead")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x57)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SoftWurl")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x59)] = Midi_Program_Ex{Midi_Spec::XG, _EX("RotarStr")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x5a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ClickPad")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x5c)] = Midi_Program_Ex{Midi_Spec::XG, _EX("GlassPad")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x5d)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Pan Pad")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x60)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AfrcnWod")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SftCryst")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Harp Vox")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("50sSciFi")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Big Pan")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x75)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Real Tom")};
-    midi_ex_[midi_ex_id(00, 0x41, 0x76)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ElecPerc")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("CheezOrg")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x12)] = Midi_Program_Ex{Midi_Spec::XG, _EX("FstRotar")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x1f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("GtrHrmo2")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("RubberBa")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x50)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SineLead")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x5a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ana Pad")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x5b)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Itopia")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x5f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Celstial")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x60)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Caribean")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("LoudGlok")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AtmosPad")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ring Pad")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynPiano")};
-    midi_ex_[midi_ex_id(00, 0x42, 0x75)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Rock Tom")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x10)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DrawOrg3")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x5a)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SquarPad")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x5b)] = Midi_Program_Ex{Midi_Spec::XG, _EX("CC Pad")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("XmasBell")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x63)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Planet")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ritual")};
-    midi_ex_[midi_ex_id(00, 0x43, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Creation")};
-    midi_ex_[midi_ex_id(00, 0x44, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("VibeBell")};
-    midi_ex_[midi_ex_id(00, 0x44, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ToHeaven")};
-    midi_ex_[midi_ex_id(00, 0x44, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Stardust")};
-    midi_ex_[midi_ex_id(00, 0x45, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("DigiBell")};
-    midi_ex_[midi_ex_id(00, 0x45, 0x66)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Reso Pan")};
-    midi_ex_[midi_ex_id(00, 0x46, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AirBells")};
-    midi_ex_[midi_ex_id(00, 0x46, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Night")};
-    midi_ex_[midi_ex_id(00, 0x47, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("BellHarp")};
-    midi_ex_[midi_ex_id(00, 0x47, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Glisten")};
-    midi_ex_[midi_ex_id(00, 0x48, 0x62)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Gamelmba")};
-    midi_ex_[midi_ex_id(00, 0x60, 0xe)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Church Bell")};
-    midi_ex_[midi_ex_id(00, 0x60, 0xf)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Cimbalom")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x18)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Ukelele")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x19)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Mandolin")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x23)] = Midi_Program_Ex{Midi_Spec::XG, _EX("SynFretl")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x26)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Hammer")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x51)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Seq Ana")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x64)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Smokey")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x65)] = Midi_Program_Ex{Midi_Spec::XG, _EX("BelChoir")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x68)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Tambra")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x69)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Rabab")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x6b)] = Midi_Program_Ex{Midi_Spec::XG, _EX("T.Koto")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x6f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Pungi")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x70)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Bonang")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x73)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Castanets")};
-    midi_ex_[midi_ex_id(00, 0x60, 0x74)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Gr.Cassa")};
-    midi_ex_[midi_ex_id(00, 0x61, 0xc)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Balafon2")};
-    midi_ex_[midi_ex_id(00, 0x61, 0xe)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Carillon")};
-    midi_ex_[midi_ex_id(00, 0x61, 0xf)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Santur")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x23)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Smooth")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x68)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Tamboura")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x69)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Gopichnt")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x6b)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Kanoon")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x6f)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Hichriki")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x70)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Gender")};
-    midi_ex_[midi_ex_id(00, 0x61, 0x72)] = Midi_Program_Ex{Midi_Spec::XG, _EX("GlasPerc")};
-    midi_ex_[midi_ex_id(00, 0x62, 0xc)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Log Drum")};
-    midi_ex_[midi_ex_id(00, 0x62, 0x69)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Oud")};
-    midi_ex_[midi_ex_id(00, 0x62, 0x70)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Gamelan")};
-    midi_ex_[midi_ex_id(00, 0x62, 0x72)] = Midi_Program_Ex{Midi_Spec::XG, _EX("ThaiBell")};
-    midi_ex_[midi_ex_id(00, 0x63, 0x70)] = Midi_Program_Ex{Midi_Spec::XG, _EX("S.Gamlan")};
-    midi_ex_[midi_ex_id(00, 0x64, 0x70)] = Midi_Program_Ex{Midi_Spec::XG, _EX("Rama Cym")};
-    midi_ex_[midi_ex_id(00, 0x65, 0x70)] = Midi_Program_Ex{Midi_Spec::XG, _EX("AsianBel")};
+    Midi_Program_Ex &ex = midi_perc_translated[id7 & 127];
+    if (!ex.name) {
+        const Midi_Program_Ex &orig = midi_perc_names[id7 & 127];
+        ex = Midi_Program_Ex(orig.spec, _PERC(orig.name));
+    }
+    return ex;
 }
 
 const Midi_Program_Ex *Midi_Db::find_ex(
     unsigned msb, unsigned lsb, unsigned pgm)
 {
-    auto it = midi_ex_.find(midi_ex_id(msb, lsb, pgm));
-    return (it != midi_ex_.end()) ? &it->second : nullptr;
+    unsigned id = midi_ex_id(msb, lsb, pgm);
+
+    // lower bound, with a conditional move rather than a branch per step
+    const Midi_Ex_Entry *base = midi_ex_names;
+    for (size_t n = midi_ex_count; n > 1;) {
+        size_t half = n / 2;
+        base = (base[half].id <= id) ? (base + half) : base;
+        n -= half;
+    }
+    if (base->id != id)
+        return nullptr;
+
+    Midi_Program_Ex &ex = midi_ex_translated[base - midi_ex_names];
+    if (!ex.name)
+        ex = Midi_Program_Ex(base->ex.spec, _EX(base->ex.name));
+    return &ex;
 }
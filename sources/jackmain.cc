@@ -8,6 +8,8 @@
 #include "insnames.h"
 #include "i18n.h"
 #include "common.h"
+#include "rt_setup.h"
+#include <algorithm>
 #include <atomic>
 #include <system_error>
 #include <stdlib.h>
@@ -21,21 +23,116 @@ static std::string program_title = "ADLjack";
 static int process(jack_nframes_t nframes, void *user_data)
 {
     const Audio_Context &ctx = *(Audio_Context *)user_data;
+    rt_setup_audio_thread();
+    Audio_Cycle_Guard cycle;
 
     void *midi = jack_port_get_buffer(ctx.midiport, nframes);
     float *left = (float *)jack_port_get_buffer(ctx.outport[0], nframes);
     float *right = (float *)jack_port_get_buffer(ctx.outport[1], nframes);
 
-    for (jack_nframes_t i = 0; i < nframes; ++i) {
-        jack_midi_event_t event;
-        if (jack_midi_event_get(&event, midi, i) == 0)
-            play_midi(event.buffer, event.size);
+    jack_nframes_t event_count = jack_midi_get_event_count(midi);
+    jack_nframes_t ievent = 0;
+
+    // maximum interval between midi processing cycles
+    constexpr jack_nframes_t midi_interval_max = 256;
+
+    // in freewheel, the segments are cut at the events only
+    bool bulk = bulk_mode();
+
+    for (jack_nframes_t iframe = 0; iframe != nframes;) {
+        jack_nframes_t segment_nframes = std::min(nframes - iframe, midi_interval_max);
+        if (bulk) {
+            segment_nframes = nframes - iframe;
+            for (jack_nframes_t i = ievent; i < event_count; ++i) {
+                jack_midi_event_t event;
+                if (jack_midi_event_get(&event, midi, i) != 0 || event.time <= iframe)
+                    continue;
+                segment_nframes = std::min(nframes, event.time) - iframe;
+                break;
+            }
+        }
+
+        // play the events at the start of the segment which contains them
+        Midi_Event events[midi_events_max];
+        unsigned nevents = 0;
+        for (; ievent < event_count; ++ievent) {
+            jack_midi_event_t event;
+            if (jack_midi_event_get(&event, midi, ievent) != 0)
+                continue;
+            if (event.time >= iframe + segment_nframes)
+                break;
+            if (nevents == midi_events_max) {
+                play_midi_events(events, nevents);
+                nevents = 0;
+            }
+            Midi_Event &ev = events[nevents++];
+            ev.time = event.time;
+            ev.size = event.size;
+            ev.data = event.buffer;
+        }
+        play_midi_events(events, nevents);
+
+        generate_outputs(left + iframe, right + iframe, segment_nframes, 1);
+        iframe += segment_nframes;
     }
 
-    generate_outputs(left, right, nframes, 1);
     return 0;
 }
 
+static int sample_rate_changed(jack_nframes_t nframes, void *user_data)
+{
+    // players are created again by the interface thread
+    notify_sample_rate_change(nframes);
+    return 0;
+}
+
+static int buffer_size_changed(jack_nframes_t nframes, void *user_data)
+{
+    // the processing is in segments of fixed maximum size, which are
+    // independent of the buffer size; just let it be known
+    char text[64];
+    int len = snprintf(text, sizeof(text), _("Buffer size changed to %u"), (unsigned)nframes);
+    notify(Notify_Status, (const uint8_t *)text, std::min<unsigned>(len, sizeof(text) - 1));
+    return 0;
+}
+
+static void freewheel_changed(int starting, void *user_data)
+{
+    set_bulk_mode(starting != 0);
+}
+
+static void latency_changed(jack_latency_callback_mode_t mode, void *user_data)
+{
+    const Audio_Context &ctx = *(Audio_Context *)user_data;
+    jack_nframes_t latency = output_latency();
+    jack_latency_range_t range;
+
+    // the output is late on the MIDI input by the resampler delay
+    if (mode == JackCaptureLatency) {
+        jack_port_get_latency_range(ctx.midiport, mode, &range);
+        range.min += latency;
+        range.max += latency;
+        for (jack_port_t *port : ctx.outport)
+            jack_port_set_latency_range(port, mode, &range);
+    }
+    else if (mode == JackPlaybackLatency) {
+        jack_latency_range_t out_range;
+        jack_port_get_latency_range(ctx.outport[0], mode, &range);
+        jack_port_get_latency_range(ctx.outport[1], mode, &out_range);
+        range.min = std::min(range.min, out_range.min) + latency;
+        range.max = std::max(range.max, out_range.max) + latency;
+        jack_port_set_latency_range(ctx.midiport, mode, &range);
+    }
+}
+
+static jack_client_t *latency_client = nullptr;
+
+static void recompute_latency()
+{
+    if (jack_client_t *client = ::latency_client)
+        jack_recompute_total_latencies(client);
+}
+
 static int setup_audio(const char *client_name, Audio_Context &ctx, bool quiet = false)
 {
     jack_client_t *client(jack_client_open(client_name, JackNoStartServer, nullptr));
@@ -65,6 +162,12 @@ static int setup_audio(const char *client_name, Audio_Context &ctx, bool quiet =
         return 1;
 
     jack_set_process_callback(client, process, &ctx);
+    jack_set_sample_rate_callback(client, sample_rate_changed, &ctx);
+    jack_set_buffer_size_callback(client, buffer_size_changed, &ctx);
+    jack_set_freewheel_callback(client, freewheel_changed, &ctx);
+    jack_set_latency_callback(client, latency_changed, &ctx);
+    ::latency_client = client;
+    ::output_latency_changed = &recompute_latency;
     return 0;
 }
 
@@ -377,7 +480,6 @@ std::string get_program_title()
 int main(int argc, char *argv[])
 {
     i18n_setup();
-    midi_db.init();
 
     for (int c; (c = generic_getopt(argc, argv, "", usage)) != -1;) {
         switch (c) {
@@ -0,0 +1,613 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "journal.h"
+#include "common.h"
+#include "bank_cache.h"
+#include <ring_buffer/ring_buffer.h>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+namespace stc = std::chrono;
+
+static const char journal_magic[8] = {'A', 'D', 'L', 'J', 'R', 'N', 'L', '2'};
+
+// capacity of the FIFO, and of the record which is being assembled
+static constexpr size_t journal_fifo_size = 1024 * 1024;
+static constexpr size_t journal_record_max = 256 * 1024;
+// the control records, written apart from the FIFO, may carry a bank of any
+// size; the limit only guards the reader against a corrupt length
+static constexpr size_t journal_control_max = 256 * 1024 * 1024;
+// how often the thread writes out the records
+static constexpr unsigned journal_drain_interval_ms = 20;
+
+enum : uint8_t {
+    Tag_Header = 'H',
+    Tag_Events = 'M',
+    Tag_Render = 'R',
+    Tag_Silence = 'S',
+    Tag_Sync = 'C',
+    Tag_Control = 'K',
+    Tag_End = 'E',
+};
+
+//------------------------------------------------------------------------------
+// a buffer of fixed capacity, which records an overflow instead of growing
+class Record_Writer {
+public:
+    Record_Writer(uint8_t *data, size_t capacity)
+        : data_(data), capacity_(capacity) {}
+
+    void byte(uint8_t x)
+    {
+        if (size_ < capacity_)
+            data_[size_] = x;
+        ++size_;
+    }
+    void uint(uint64_t x)
+    {
+        for (; x >= 0x80; x >>= 7)
+            byte((x & 0x7f) | 0x80);
+        byte(x);
+    }
+    void sint(int64_t x)
+    {
+        uint(((uint64_t)x << 1) ^ (uint64_t)(x >> 63));
+    }
+    void bytes(const void *src, size_t size)
+    {
+        uint(size);
+        if (size_ + size <= capacity_)
+            memcpy(data_ + size_, src, size);
+        size_ += size;
+    }
+
+    const uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool overflow() const { return size_ > capacity_; }
+
+private:
+    uint8_t *data_ = nullptr;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+};
+
+//------------------------------------------------------------------------------
+class Journal {
+public:
+    ~Journal() { stop(); }
+
+    bool start(const std::string &path, unsigned sample_rate, const Journal_Settings &settings);
+    void stop();
+    bool active() const { return active_.load(std::memory_order_acquire); }
+
+    void events(const Midi_Event *events, size_t count);
+    void render(unsigned nframes, int volume);
+    void silence(unsigned nframes);
+    void control(Journal_Control control, int64_t value, const void *data, size_t size);
+
+private:
+    void sync();
+    Record_Writer begin_record()
+        { return Record_Writer(record_.get(), journal_record_max); }
+    void commit_record(const Record_Writer &writer);
+    void run();
+    bool write_out();
+
+private:
+    std::atomic<bool> active_{false};
+    std::atomic<bool> lost_{false};
+    std::unique_ptr<Ring_Buffer> fifo_;
+    // owned by the audio thread
+    std::unique_ptr<uint8_t[]> record_;
+    uint64_t frame_ = 0;
+    uint64_t event_frame_ = 0;
+    unsigned serial_ = 0;
+    // the records of the control actions
+    std::mutex control_mutex_;
+    std::vector<uint8_t> controls_;
+    //
+    FILE_u file_;
+    std::string path_;
+    std::thread thread_;
+    std::atomic<bool> quit_{false};
+};
+
+static Journal journal;
+
+bool Journal::start(const std::string &path, unsigned sample_rate, const Journal_Settings &settings)
+{
+    stop();
+
+    FILE_u file(fopen(path.c_str(), "wb"));
+    if (!file) {
+        debug_printf("Cannot open the journal file '%s'.\n", path.c_str());
+        return false;
+    }
+
+    if (!fifo_)
+        fifo_.reset(new Ring_Buffer(journal_fifo_size));
+    if (!record_)
+        record_.reset(new uint8_t[journal_record_max]);
+    fifo_->discard(fifo_->size_used());
+
+    std::vector<uint8_t> header(journal_record_max);
+    Record_Writer writer(header.data(), header.size());
+    writer.byte(Tag_Header);
+    writer.uint(sample_rate);
+    writer.uint(settings.size());
+    for (const std::pair<std::string, std::string> &setting : settings) {
+        writer.bytes(setting.first.data(), setting.first.size());
+        writer.bytes(setting.second.data(), setting.second.size());
+    }
+    if (writer.overflow() ||
+        fwrite(journal_magic, 1, sizeof(journal_magic), file.get()) != sizeof(journal_magic) ||
+        fwrite(writer.data(), 1, writer.size(), file.get()) != writer.size()) {
+        debug_printf("Cannot write the journal file '%s'.\n", path.c_str());
+        return false;
+    }
+
+    file_ = std::move(file);
+    path_ = path;
+    frame_ = 0;
+    event_frame_ = 0;
+    serial_ = Player::change_serial();
+    controls_.clear();
+    lost_.store(false);
+
+    quit_.store(false);
+    thread_ = std::thread([this]() { run(); });
+    active_.store(true, std::memory_order_release);
+    return true;
+}
+
+void Journal::stop()
+{
+    if (!thread_.joinable())
+        return;
+
+    active_.store(false, std::memory_order_release);
+    quit_.store(true);
+    thread_.join();
+
+    bool lost = lost_.load();
+    uint8_t end[2] = {Tag_End, (uint8_t)lost};
+    fwrite(end, 1, sizeof(end), file_.get());
+    file_.reset();
+
+    if (lost)
+        debug_printf("The journal '%s' is incomplete, records were lost.\n", path_.c_str());
+}
+
+void Journal::sync()
+{
+    unsigned serial = Player::change_serial();
+    if (serial == serial_)
+        return;
+    serial_ = serial;
+    Record_Writer writer = begin_record();
+    writer.byte(Tag_Sync);
+    writer.uint(serial);
+    commit_record(writer);
+}
+
+void Journal::commit_record(const Record_Writer &writer)
+{
+    // once a record is lost, the ones which follow would not replay
+    if (lost_.load(std::memory_order_relaxed))
+        return;
+    if (writer.overflow() || !fifo_->put(writer.data(), writer.size()))
+        lost_.store(true, std::memory_order_relaxed);
+}
+
+void Journal::events(const Midi_Event *events, size_t count)
+{
+    if (!active() || count == 0)
+        return;
+    sync();
+
+    Record_Writer writer = begin_record();
+    writer.byte(Tag_Events);
+    writer.uint(frame_ - event_frame_);
+    writer.uint(count);
+    for (size_t i = 0; i < count; ++i)
+        writer.bytes(events[i].data, events[i].size);
+    commit_record(writer);
+    event_frame_ = frame_;
+}
+
+void Journal::render(unsigned nframes, int volume)
+{
+    if (!active())
+        return;
+    sync();
+
+    Record_Writer writer = begin_record();
+    writer.byte(Tag_Render);
+    writer.uint(nframes);
+    writer.sint(volume);
+    commit_record(writer);
+    frame_ += nframes;
+}
+
+void Journal::silence(unsigned nframes)
+{
+    if (!active())
+        return;
+
+    Record_Writer writer = begin_record();
+    writer.byte(Tag_Silence);
+    writer.uint(nframes);
+    commit_record(writer);
+    frame_ += nframes;
+}
+
+void Journal::control(Journal_Control control, int64_t value, const void *data, size_t size)
+{
+    if (!active())
+        return;
+
+    std::vector<uint8_t> record(32 + size);
+    Record_Writer writer(record.data(), record.size());
+    writer.byte(Tag_Control);
+    writer.uint(Player::change_serial());
+    writer.byte((uint8_t)control);
+    writer.sint(value);
+    writer.bytes(data, size);
+
+    std::lock_guard<std::mutex> lock(control_mutex_);
+    controls_.insert(controls_.end(), writer.data(), writer.data() + writer.size());
+}
+
+void Journal::run()
+{
+    for (bool quit = false; !quit;) {
+        quit = quit_.load();
+        if (!write_out()) {
+            debug_printf("Write error on the journal file '%s'.\n", path_.c_str());
+            lost_.store(true);
+            return;
+        }
+        if (!quit)
+            std::this_thread::sleep_for(stc::milliseconds(journal_drain_interval_ms));
+    }
+}
+
+bool Journal::write_out()
+{
+    // the records of the FIFO are whole, put at once by the audio thread
+    Ring_Buffer &fifo = *fifo_;
+    uint8_t buffer[8192];
+    for (size_t avail = fifo.size_used(); avail > 0;) {
+        size_t count = std::min(avail, sizeof(buffer));
+        fifo.get(buffer, count);
+        if (fwrite(buffer, 1, count, file_.get()) != count)
+            return false;
+        avail -= count;
+    }
+
+    std::vector<uint8_t> controls;
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        controls.swap(controls_);
+    }
+    if (!controls.empty() &&
+        fwrite(controls.data(), 1, controls.size(), file_.get()) != controls.size())
+        return false;
+
+    return fflush(file_.get()) == 0;
+}
+
+//------------------------------------------------------------------------------
+bool journal_start(const std::string &path, unsigned sample_rate, const Journal_Settings &settings)
+{
+    return ::journal.start(path, sample_rate, settings);
+}
+
+void journal_stop()
+{
+    ::journal.stop();
+}
+
+bool journal_active()
+{
+    return ::journal.active();
+}
+
+void journal_events(const Midi_Event *events, size_t count)
+{
+    ::journal.events(events, count);
+}
+
+void journal_render(unsigned nframes, int volume)
+{
+    ::journal.render(nframes, volume);
+}
+
+void journal_silence(unsigned nframes)
+{
+    ::journal.silence(nframes);
+}
+
+void journal_control(Journal_Control control, int64_t value, const void *data, size_t size)
+{
+    ::journal.control(control, value, data, size);
+}
+
+void journal_bank_control(Journal_Control control, int64_t value, const std::string &path, const Bank_Image *image)
+{
+    if (!::journal.active())
+        return;
+    std::vector<uint8_t> data(path.begin(), path.end());
+    data.push_back(0);
+    if (image)
+        data.insert(data.end(), image->bank_data(), image->bank_data() + image->bank_size());
+    ::journal.control(control, value, data.data(), data.size());
+}
+
+bool journal_unpack_bank(const std::vector<uint8_t> &data, std::string &path, std::vector<uint8_t> &bank)
+{
+    std::vector<uint8_t>::const_iterator sep = std::find(data.begin(), data.end(), 0);
+    if (sep == data.end())
+        return false;
+    path.assign(data.begin(), sep);
+    bank.assign(sep + 1, data.end());
+    return true;
+}
+
+std::string journal_bank_hash(const Bank_Image *image)
+{
+    if (!image)
+        return std::string();
+    // FNV-1a of the contents
+    uint64_t hash = 0xcbf29ce484222325u;
+    const uint8_t *data = image->bank_data();
+    for (size_t i = 0, n = image->bank_size(); i < n; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3u;
+    }
+    char text[32];
+    sprintf(text, "%016llx", (unsigned long long)hash);
+    return text;
+}
+
+int64_t journal_pack_instrument(bool percussive, unsigned msb, unsigned lsb, unsigned program)
+{
+    return ((int64_t)percussive << 24) | ((msb & 0xff) << 16) | ((lsb & 0xff) << 8) | (program & 0xff);
+}
+
+void journal_unpack_instrument(int64_t value, bool &percussive, unsigned &msb, unsigned &lsb, unsigned &program)
+{
+    percussive = (value >> 24) & 1;
+    msb = (value >> 16) & 0xff;
+    lsb = (value >> 8) & 0xff;
+    program = value & 0xff;
+}
+
+//------------------------------------------------------------------------------
+struct Journal_Reader::Impl
+{
+    FILE_u file_;
+    unsigned sample_rate_ = 0;
+    Journal_Settings settings_;
+    std::string error_;
+    uint64_t frame_ = 0;
+    uint64_t event_frame_ = 0;
+    bool end_ = false;
+
+    bool byte(uint8_t &x);
+    bool uint(uint64_t &x);
+    bool sint(int64_t &x);
+    bool bytes(std::vector<uint8_t> &x, size_t max = journal_record_max);
+    bool string(std::string &x);
+    bool fail(const char *text);
+};
+
+Journal_Reader::Journal_Reader()
+    : P(new Impl)
+{
+}
+
+Journal_Reader::~Journal_Reader()
+{
+}
+
+bool Journal_Reader::open(const std::string &path)
+{
+    P.reset(new Impl);
+
+    P->file_.reset(fopen(path.c_str(), "rb"));
+    if (!P->file_)
+        return P->fail("cannot open the file");
+
+    char magic[sizeof(journal_magic)];
+    if (fread(magic, 1, sizeof(magic), P->file_.get()) != sizeof(magic) ||
+        memcmp(magic, journal_magic, sizeof(magic)) != 0)
+        return P->fail("not a journal of this version");
+
+    uint8_t tag;
+    uint64_t sample_rate;
+    uint64_t count;
+    if (!P->byte(tag) || tag != Tag_Header ||
+        !P->uint(sample_rate) || !P->uint(count))
+        return P->fail("bad header");
+    P->sample_rate_ = sample_rate;
+    for (uint64_t i = 0; i < count; ++i) {
+        std::pair<std::string, std::string> setting;
+        if (!P->string(setting.first) || !P->string(setting.second))
+            return P->fail("bad header");
+        P->settings_.push_back(std::move(setting));
+    }
+
+    return true;
+}
+
+unsigned Journal_Reader::sample_rate() const
+{
+    return P->sample_rate_;
+}
+
+const Journal_Settings &Journal_Reader::settings() const
+{
+    return P->settings_;
+}
+
+const std::string &Journal_Reader::error() const
+{
+    return P->error_;
+}
+
+bool Journal_Reader::next(Journal_Record &record)
+{
+    if (!P->file_ || P->end_)
+        return false;
+
+    uint8_t tag;
+    if (!P->byte(tag)) {
+        // a journal not closed properly ends at the last whole record
+        P->end_ = true;
+        return false;
+    }
+
+    record.frame = P->frame_;
+    record.data.clear();
+    record.sizes.clear();
+
+    switch (tag) {
+    default:
+        return P->fail("unknown record");
+    case Tag_Events: {
+        uint64_t delta;
+        uint64_t count;
+        if (!P->uint(delta) || !P->uint(count))
+            return P->fail("truncated record");
+        if (P->event_frame_ + delta != P->frame_)
+            return P->fail("inconsistent frame position");
+        P->event_frame_ = P->frame_;
+        for (uint64_t i = 0; i < count; ++i) {
+            std::vector<uint8_t> message;
+            if (!P->bytes(message))
+                return P->fail("truncated record");
+            record.sizes.push_back(message.size());
+            record.data.insert(record.data.end(), message.begin(), message.end());
+        }
+        record.type = Journal_Record::Events;
+        break;
+    }
+    case Tag_Render: {
+        uint64_t nframes;
+        int64_t volume;
+        if (!P->uint(nframes) || !P->sint(volume))
+            return P->fail("truncated record");
+        record.type = Journal_Record::Render;
+        record.nframes = nframes;
+        record.volume = volume;
+        P->frame_ += nframes;
+        break;
+    }
+    case Tag_Silence: {
+        uint64_t nframes;
+        if (!P->uint(nframes))
+            return P->fail("truncated record");
+        record.type = Journal_Record::Silence;
+        record.nframes = nframes;
+        P->frame_ += nframes;
+        break;
+    }
+    case Tag_Sync: {
+        uint64_t serial;
+        if (!P->uint(serial))
+            return P->fail("truncated record");
+        record.type = Journal_Record::Sync;
+        record.serial = serial;
+        break;
+    }
+    case Tag_Control: {
+        uint64_t serial;
+        uint8_t control;
+        int64_t value;
+        if (!P->uint(serial) || !P->byte(control) || !P->sint(value) ||
+            !P->bytes(record.data, journal_control_max))
+            return P->fail("truncated record");
+        record.type = Journal_Record::Control;
+        record.serial = serial;
+        record.control = (Journal_Control)control;
+        record.value = value;
+        break;
+    }
+    case Tag_End: {
+        uint8_t lost;
+        if (!P->byte(lost))
+            return P->fail("truncated record");
+        record.type = Journal_Record::End;
+        record.lost = lost != 0;
+        P->end_ = true;
+        break;
+    }
+    }
+
+    return true;
+}
+
+bool Journal_Reader::Impl::byte(uint8_t &x)
+{
+    int c = fgetc(file_.get());
+    if (c == EOF)
+        return false;
+    x = c;
+    return true;
+}
+
+bool Journal_Reader::Impl::uint(uint64_t &x)
+{
+    x = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        uint8_t b;
+        if (!byte(b))
+            return false;
+        x |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
+
+bool Journal_Reader::Impl::sint(int64_t &x)
+{
+    uint64_t u;
+    if (!uint(u))
+        return false;
+    x = (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+    return true;
+}
+
+bool Journal_Reader::Impl::bytes(std::vector<uint8_t> &x, size_t max)
+{
+    uint64_t size;
+    if (!uint(size) || size > max)
+        return false;
+    x.resize(size);
+    return fread(x.data(), 1, size, file_.get()) == size;
+}
+
+bool Journal_Reader::Impl::string(std::string &x)
+{
+    std::vector<uint8_t> data;
+    if (!bytes(data))
+        return false;
+    x.assign(data.begin(), data.end());
+    return true;
+}
+
+bool Journal_Reader::Impl::fail(const char *text)
+{
+    error_ = text;
+    file_.reset();
+    return false;
+}
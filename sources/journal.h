@@ -0,0 +1,107 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <stdint.h>
+#include <stddef.h>
+
+struct Midi_Event;
+struct Bank_Image;
+
+// The journal records the input of the engine from its start: the blocks of
+// MIDI events played, the blocks rendered, and the control actions, such
+// that a replay through the same engine renders the same audio.
+//
+// The audio thread writes its records without locks into a FIFO, which a
+// thread writes out to the file. The control actions made under the player
+// lock are placed by the serial of the player changes: the audio thread
+// records the serial when it sees it change, and the control records carry
+// the serial which follows them.
+
+enum class Journal_Control : uint8_t {
+    Emulator = 1,       // value: the index of the emulator id
+    Chip_Count,         // value: the count of chips
+    Load_Bank,          // data: the bank, see journal_bank_control
+    Update_Bank,        // data: the bank, see journal_bank_control
+    Embedded_Bank,      // value: the embedded bank, data: the bank file, see journal_bank_control
+    Panic,
+    Channel_Alloc,      // value: the mode
+    Instrument,         // value: the packed instrument id, data: the record
+    Sample_Rate,        // value: the rate
+};
+
+typedef std::vector<std::pair<std::string, std::string>> Journal_Settings;
+
+// starts a journal, with the settings which the replay gives the engine
+bool journal_start(const std::string &path, unsigned sample_rate, const Journal_Settings &settings);
+// writes out the remaining records and closes the file
+void journal_stop();
+bool journal_active();
+
+// from the audio thread under the player lock, never blocking
+void journal_events(const Midi_Event *events, size_t count);
+void journal_render(unsigned nframes, int volume);
+// a block not rendered, for the player lock was busy
+void journal_silence(unsigned nframes);
+
+// from the interface thread, after the action
+void journal_control(Journal_Control control, int64_t value, const void *data = nullptr, size_t size = 0);
+
+// a control of the bank, whose data is the path of the bank, a null byte, then
+// the contents of the bank, so the replay does not depend on the file
+void journal_bank_control(Journal_Control control, int64_t value, const std::string &path, const Bank_Image *image);
+bool journal_unpack_bank(const std::vector<uint8_t> &data, std::string &path, std::vector<uint8_t> &bank);
+// the hash which identifies the contents of a bank in the settings
+std::string journal_bank_hash(const Bank_Image *image);
+
+// instrument ids packed into a control value
+int64_t journal_pack_instrument(bool percussive, unsigned msb, unsigned lsb, unsigned program);
+void journal_unpack_instrument(int64_t value, bool &percussive, unsigned &msb, unsigned &lsb, unsigned &program);
+
+//------------------------------------------------------------------------------
+struct Journal_Record {
+    enum Type {
+        Events,     // the MIDI messages of a block, one after another in data
+        Render,     // nframes rendered with volume
+        Silence,    // nframes of silence
+        Sync,       // the player changes reached serial
+        Control,    // a control action, which follows serial
+        End,        // the end, with lost set if records were dropped
+    };
+    Type type = End;
+    uint64_t frame = 0;
+    unsigned nframes = 0;
+    int volume = 0;
+    unsigned serial = 0;
+    Journal_Control control = Journal_Control::Panic;
+    int64_t value = 0;
+    bool lost = false;
+    std::vector<uint8_t> data;
+    // the size of each message of the events
+    std::vector<unsigned> sizes;
+};
+
+class Journal_Reader {
+public:
+    Journal_Reader();
+    ~Journal_Reader();
+
+    bool open(const std::string &path);
+    unsigned sample_rate() const;
+    const Journal_Settings &settings() const;
+
+    // reads the next record, returning false at the end of the file or on
+    // an error, which is then described by error()
+    bool next(Journal_Record &record);
+    const std::string &error() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
@@ -0,0 +1,248 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "log_queue.h"
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <syslog.h>
+#endif
+namespace stc = std::chrono;
+
+struct Log_Record {
+    unsigned size = 0;
+    char text[log_record_size];
+};
+
+// bounded queue for many producers, where each cell carries a sequence
+// number telling whether it is free for the producer of a given position
+// or ready for the consumer
+class Log_Queue {
+public:
+    Log_Queue();
+    ~Log_Queue();
+
+    bool push(const char *text, unsigned size);
+    bool pop(Log_Record &record);
+
+    void start(const std::string &output);
+    void stop();
+    void write_out(const Log_Record &record);
+
+    void note_dropped()
+        { dropped_.fetch_add(1, std::memory_order_relaxed); }
+    unsigned long dropped() const
+        { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Log_Record record;
+    };
+    static constexpr size_t mask_ = log_queue_capacity - 1;
+    static_assert((log_queue_capacity & mask_) == 0, "the capacity must be a power of 2");
+    Cell cells_[log_queue_capacity];
+    std::atomic<size_t> enqueue_pos_{0};
+    std::atomic<size_t> dequeue_pos_{0};
+
+    std::mutex output_mutex_;
+    std::string output_ = "syslog";
+    FILE *file_ = nullptr;
+    std::thread thread_;
+    std::atomic<bool> quit_{false};
+    std::atomic<unsigned long> dropped_{0};
+    unsigned long reported_drops_ = 0;
+};
+
+// how often the thread looks for new records
+static constexpr unsigned log_drain_interval_ms = 50;
+
+static Log_Queue log_queue;
+
+Log_Queue::Log_Queue()
+{
+    for (size_t i = 0; i < log_queue_capacity; ++i)
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+Log_Queue::~Log_Queue()
+{
+    stop();
+}
+
+bool Log_Queue::push(const char *text, unsigned size)
+{
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (dif < 0)
+            return false;
+        else
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+    cell->record.size = size;
+    memcpy(cell->record.text, text, size);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool Log_Queue::pop(Log_Record &record)
+{
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (dif == 0) {
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (dif < 0)
+            return false;
+        else
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+    record.size = cell->record.size;
+    memcpy(record.text, cell->record.text, record.size);
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+void Log_Queue::start(const std::string &output)
+{
+    stop();
+
+    {
+        std::lock_guard<std::mutex> lock(output_mutex_);
+        output_ = output;
+        if (output != "syslog" && output != "stderr") {
+            file_ = fopen(output.c_str(), "a");
+            if (!file_)
+                output_ = "syslog";
+        }
+    }
+
+    quit_.store(false);
+    thread_ = std::thread([this]() { run(); });
+}
+
+void Log_Queue::stop()
+{
+    if (thread_.joinable()) {
+        quit_.store(true);
+        thread_.join();
+    }
+
+    // what is left, if the thread was not running
+    Log_Record record;
+    while (pop(record))
+        write_out(record);
+
+    std::lock_guard<std::mutex> lock(output_mutex_);
+    if (file_) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+void Log_Queue::run()
+{
+    Log_Record record;
+    for (bool quit = false; !quit;) {
+        quit = quit_.load();
+        while (pop(record))
+            write_out(record);
+
+        unsigned long drops = dropped();
+        if (drops != reported_drops_) {
+            record.size = snprintf(record.text, log_record_size,
+                                   "%lu log records dropped\n", drops - reported_drops_);
+            reported_drops_ = drops;
+            write_out(record);
+        }
+
+        if (!quit)
+            std::this_thread::sleep_for(stc::milliseconds(log_drain_interval_ms));
+    }
+}
+
+void Log_Queue::write_out(const Log_Record &record)
+{
+    std::lock_guard<std::mutex> lock(output_mutex_);
+    bool newline = record.size > 0 && record.text[record.size - 1] == '\n';
+    if (file_) {
+        fwrite(record.text, 1, record.size, file_);
+        if (!newline)
+            fputc('\n', file_);
+        fflush(file_);
+    }
+    else if (output_ == "stderr") {
+        fwrite(record.text, 1, record.size, stderr);
+        if (!newline)
+            fputc('\n', stderr);
+    }
+    else {
+        char text[log_record_size + 1];
+        memcpy(text, record.text, record.size);
+        text[record.size] = '\0';
+#if defined(_WIN32)
+        OutputDebugStringA(text);
+#else
+        syslog(LOG_INFO, "%s", text);
+#endif
+    }
+}
+
+void log_start(const std::string &output)
+{
+    ::log_queue.start(output);
+}
+
+void log_stop()
+{
+    ::log_queue.stop();
+}
+
+void log_printf(const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    log_vprintf(fmt, ap);
+    va_end(ap);
+}
+
+void log_vprintf(const char *fmt, va_list ap)
+{
+    char text[log_record_size];
+    int size = vsnprintf(text, log_record_size, fmt, ap);
+    if (size < 0)
+        return;
+    if ((unsigned)size >= log_record_size)
+        size = log_record_size - 1;
+    if (!::log_queue.push(text, size))
+        ::log_queue.note_dropped();
+}
+
+unsigned long log_dropped_count()
+{
+    return ::log_queue.dropped();
+}
@@ -0,0 +1,27 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <stdarg.h>
+
+// Log messages are formatted by the thread which emits them into records of
+// fixed size, queued without locks or allocation, so any thread may log,
+// the audio thread included. A background thread writes them out; when the
+// queue is full, the records are dropped and counted.
+
+static constexpr unsigned log_record_size = 256;
+static constexpr unsigned log_queue_capacity = 256;
+
+// starts writing the records out to "syslog", "stderr" or a file path
+void log_start(const std::string &output);
+// writes out the remaining records and stops the thread
+void log_stop();
+
+// queues a message, never blocking; long messages are truncated
+void log_printf(const char *fmt, ...);
+void log_vprintf(const char *fmt, va_list ap);
+
+unsigned long log_dropped_count();
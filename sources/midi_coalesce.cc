@@ -0,0 +1,110 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "midi_coalesce.h"
+#include <algorithm>
+
+Midi_Coalescer::Midi_Coalescer()
+    : event_count_(0), merged_count_(0)
+{
+}
+
+bool Midi_Coalescer::is_continuous_controller(unsigned cc)
+{
+    switch (cc) {
+    case 1:   // modulation
+    case 2:   // breath
+    case 4:   // foot
+    case 7:   // volume
+    case 8:   // balance
+    case 10:  // pan
+    case 11:  // expression
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t Midi_Coalescer::process(Midi_Event *events, size_t count)
+{
+    if (count <= 1) {
+        event_count_.fetch_add(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    // slots of another generation are free, no need to clear them each time
+    if (++generation_ == 0) {
+        for (unsigned channel = 0; channel < 16; ++channel)
+            std::fill(slots_[channel], slots_[channel] + slot_count, Slot());
+        generation_ = 1;
+    }
+    std::fill(epoch_, epoch_ + 16, 0);
+
+    unsigned generation = generation_;
+    unsigned merged = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const Midi_Event &ev = events[i];
+        const uint8_t *msg = ev.data;
+        unsigned len = ev.size;
+        if (len <= 0)
+            continue;
+
+        uint8_t status = msg[0];
+        if (status >= 0xf0) {
+            // system messages are barriers for every channel
+            for (unsigned channel = 0; channel < 16; ++channel)
+                ++epoch_[channel];
+            continue;
+        }
+
+        unsigned channel = status & 0x0f;
+        int slot = -1;
+        switch (status >> 4) {
+        case 0b1010:
+            if (len >= 3)
+                slot = slot_note_aftertouch + (msg[1] & 0x7f);
+            break;
+        case 0b1011:
+            if (len >= 3 && is_continuous_controller(msg[1] & 0x7f))
+                slot = slot_controller + (msg[1] & 0x7f);
+            break;
+        case 0b1101:
+            if (len >= 2)
+                slot = slot_channel_aftertouch;
+            break;
+        case 0b1110:
+            if (len >= 3)
+                slot = slot_pitchbend;
+            break;
+        }
+
+        if (slot == -1) {
+            ++epoch_[channel];
+            continue;
+        }
+
+        Slot &s = slots_[channel][slot];
+        if (s.generation == generation && s.epoch == epoch_[channel]) {
+            events[s.index].size = 0;
+            ++merged;
+        }
+        s.generation = generation;
+        s.epoch = epoch_[channel];
+        s.index = i;
+    }
+
+    size_t remaining = count;
+    if (merged > 0) {
+        Midi_Event *end = std::remove_if(
+            events, events + count,
+            [](const Midi_Event &ev) -> bool { return ev.size == 0; });
+        remaining = end - events;
+    }
+
+    event_count_.fetch_add(count, std::memory_order_relaxed);
+    merged_count_.fetch_add(merged, std::memory_order_relaxed);
+    return remaining;
+}
@@ -0,0 +1,48 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include "player.h"
+#include <atomic>
+
+// Merges the continuous controller events of a block: of several values of
+// the same controller on a channel, only the last one is played. A value is
+// kept whenever another kind of event of the channel comes between, so the
+// order against notes, programs and RPN/NRPN sequences is unchanged.
+class Midi_Coalescer {
+public:
+    Midi_Coalescer();
+
+    // removes the superseded events, and returns the count of those left
+    size_t process(Midi_Event *events, size_t count);
+
+    unsigned long event_count() const
+        { return event_count_.load(std::memory_order_relaxed); }
+    unsigned long merged_count() const
+        { return merged_count_.load(std::memory_order_relaxed); }
+
+    static bool is_continuous_controller(unsigned cc);
+
+private:
+    enum {
+        slot_controller = 0,
+        slot_note_aftertouch = 128,
+        slot_pitchbend = 256,
+        slot_channel_aftertouch = 257,
+        slot_count = 258,
+    };
+
+    struct Slot {
+        unsigned generation = 0;
+        unsigned epoch = 0;
+        unsigned index = 0;
+    };
+
+    Slot slots_[16][slot_count];
+    unsigned epoch_[16] = {};
+    unsigned generation_ = 0;
+    std::atomic<unsigned long> event_count_;
+    std::atomic<unsigned long> merged_count_;
+};
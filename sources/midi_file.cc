@@ -0,0 +1,445 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "midi_file.h"
+#include "player.h"
+#include "common.h"
+#include <algorithm>
+#include <vector>
+#include <atomic>
+#include <cmath>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(_WIN32)
+#    include <sys/mman.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+Midi_File_Source midi_file_source;
+
+struct Midi_File_Source::Impl
+{
+#if !defined(_WIN32)
+    void *addr_ = MAP_FAILED;
+    size_t length_ = 0;
+#else
+    std::vector<uint8_t> contents_;
+#endif
+    //
+    struct Event {
+        double time;
+        const uint8_t *data;
+        unsigned size;
+    };
+    std::vector<Event> events_;
+    // the messages which are not whole in the file: running status, sysex
+    std::vector<uint8_t> pool_;
+    double duration_ = 0;
+    //
+    std::atomic<bool> active_{false};
+    std::atomic<unsigned> sample_rate_{0};
+    double speed_ = 1;
+    bool loop_ = false;
+    size_t index_ = 0;
+    double position_ = 0;
+    std::atomic<double> shown_position_{0};
+    std::atomic<unsigned> loop_count_{0};
+    //
+    bool map(const char *path, const uint8_t *&base, size_t &length);
+    void unmap();
+    bool parse(const uint8_t *base, size_t length);
+    void play_all_off();
+};
+
+Midi_File_Source::Midi_File_Source()
+    : P(new Impl)
+{
+}
+
+Midi_File_Source::~Midi_File_Source()
+{
+    close();
+}
+
+bool Midi_File_Source::open(const std::string &path)
+{
+    close();
+
+    const uint8_t *base;
+    size_t length;
+    if (!P->map(path.c_str(), base, length)) {
+        debug_printf("Cannot open the MIDI file '%s'.\n", path.c_str());
+        return false;
+    }
+
+    if (!P->parse(base, length)) {
+        debug_printf("Invalid MIDI file '%s'.\n", path.c_str());
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void Midi_File_Source::close()
+{
+    stop();
+    P->events_.clear();
+    P->pool_.clear();
+    P->duration_ = 0;
+    P->unmap();
+}
+
+double Midi_File_Source::duration() const
+{
+    return P->duration_;
+}
+
+void Midi_File_Source::start(unsigned sample_rate, double speed, bool loop)
+{
+    stop();
+    if (P->events_.empty())
+        return;
+
+    P->sample_rate_.store(sample_rate);
+    P->speed_ = (speed > 0) ? speed : 1;
+    // a file without length is played once
+    P->loop_ = loop && P->duration_ > 0;
+    P->index_ = 0;
+    P->position_ = 0;
+    P->shown_position_.store(0);
+    P->loop_count_.store(0);
+    P->active_.store(true, std::memory_order_release);
+}
+
+void Midi_File_Source::stop()
+{
+    P->active_.store(false, std::memory_order_release);
+}
+
+bool Midi_File_Source::active() const
+{
+    return P->active_.load(std::memory_order_acquire);
+}
+
+void Midi_File_Source::set_sample_rate(unsigned sample_rate)
+{
+    P->sample_rate_.store(sample_rate);
+}
+
+unsigned Midi_File_Source::play(unsigned max_frames)
+{
+    if (max_frames <= 0)
+        return 0;
+
+    Impl &I = *P;
+    if (!I.active_.load(std::memory_order_acquire))
+        return max_frames;
+
+    const std::vector<Impl::Event> &events = I.events_;
+    size_t count = events.size();
+    double step = I.speed_ / I.sample_rate_.load(std::memory_order_relaxed);
+
+    Midi_Event batch[midi_events_max];
+    for (;;) {
+        unsigned nbatch = 0;
+        for (; I.index_ < count && events[I.index_].time <= I.position_; ++I.index_) {
+            if (nbatch == midi_events_max) {
+                play_midi_events(batch, nbatch);
+                nbatch = 0;
+            }
+            const Impl::Event &event = events[I.index_];
+            Midi_Event &ev = batch[nbatch++];
+            ev = Midi_Event();
+            ev.size = event.size;
+            ev.data = event.data;
+        }
+        play_midi_events(batch, nbatch);
+
+        if (I.index_ < count || I.position_ < I.duration_)
+            break;
+
+        // at the end, start again or finish
+        I.play_all_off();
+        if (!I.loop_) {
+            I.active_.store(false, std::memory_order_release);
+            return max_frames;
+        }
+        I.index_ = 0;
+        I.position_ -= I.duration_;
+        I.loop_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    double next = (I.index_ < count) ? events[I.index_].time : I.duration_;
+    double frames = std::ceil((next - I.position_) / step);
+    unsigned advance = (unsigned)std::max(1.0, std::min(frames, (double)max_frames));
+    I.position_ += advance * step;
+    I.shown_position_.store(I.position_, std::memory_order_relaxed);
+    return advance;
+}
+
+double Midi_File_Source::position() const
+{
+    return P->shown_position_.load(std::memory_order_relaxed);
+}
+
+unsigned Midi_File_Source::loop_count() const
+{
+    return P->loop_count_.load(std::memory_order_relaxed);
+}
+
+bool Midi_File_Source::Impl::map(const char *path, const uint8_t *&base, size_t &length)
+{
+#if !defined(_WIN32)
+    int fd = ::open(path, O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    length = st.st_size;
+    void *addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED)
+        return false;
+
+    addr_ = addr;
+    length_ = length;
+    base = (const uint8_t *)addr;
+#else
+    FILE *stream = fopen(path, "rb");
+    if (!stream)
+        return false;
+    struct stat st;
+    bool ok = fstat(fileno(stream), &st) == 0 && st.st_size > 0;
+    if (ok) {
+        length = st.st_size;
+        contents_.resize(length);
+        ok = fread(contents_.data(), 1, length, stream) == length;
+    }
+    fclose(stream);
+    if (!ok) {
+        contents_.clear();
+        return false;
+    }
+    base = contents_.data();
+#endif
+    return true;
+}
+
+void Midi_File_Source::Impl::unmap()
+{
+#if !defined(_WIN32)
+    if (addr_ != MAP_FAILED) {
+        munmap(addr_, length_);
+        addr_ = MAP_FAILED;
+        length_ = 0;
+    }
+#else
+    contents_.clear();
+#endif
+}
+
+static bool read_varlen(const uint8_t *&p, const uint8_t *end, uint32_t &value)
+{
+    value = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+        if (p == end)
+            return false;
+        uint8_t byte = *p++;
+        value = (value << 7) | (byte & 0x7f);
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+static uint32_t get_be(const uint8_t *p, unsigned size)
+{
+    uint32_t value = 0;
+    for (unsigned i = 0; i < size; ++i)
+        value = (value << 8) | p[i];
+    return value;
+}
+
+bool Midi_File_Source::Impl::parse(const uint8_t *base, size_t length)
+{
+    const uint8_t *end = base + length;
+    if (length < 14 || memcmp(base, "MThd", 4))
+        return false;
+    size_t header_size = get_be(base + 4, 4);
+    if (header_size < 6 || header_size > length - 8)
+        return false;
+
+    unsigned format = get_be(base + 8, 2);
+    unsigned division = get_be(base + 12, 2);
+    if (format > 2 || division == 0)
+        return false;
+
+    // the messages as found in the tracks, placed in the pool when they are
+    // not whole in the file
+    struct Track_Event {
+        uint64_t tick;
+        bool pooled;
+        size_t offset;
+        unsigned size;
+    };
+    std::vector<Track_Event> track_events;
+    std::vector<std::pair<uint64_t, uint32_t>> tempos;
+    uint64_t end_tick = 0;
+
+    const uint8_t *chunk = base + 8 + header_size;
+    while (end - chunk >= 8) {
+        size_t chunk_size = get_be(chunk + 4, 4);
+        const uint8_t *p = chunk + 8;
+        const uint8_t *track_end = p + std::min<size_t>(chunk_size, end - p);
+        bool is_track = !memcmp(chunk, "MTrk", 4);
+        chunk = track_end;
+        if (!is_track)
+            continue;
+
+        uint64_t tick = 0;
+        uint8_t status = 0;
+        while (p < track_end) {
+            uint32_t delta;
+            if (!read_varlen(p, track_end, delta) || p == track_end)
+                return false;
+            tick += delta;
+
+            uint8_t byte = *p;
+            if (byte == 0xff) {
+                if (track_end - p < 2)
+                    return false;
+                unsigned type = p[1];
+                p += 2;
+                uint32_t size;
+                if (!read_varlen(p, track_end, size) || (size_t)(track_end - p) < size)
+                    return false;
+                if (type == 0x51 && size == 3)
+                    tempos.emplace_back(tick, get_be(p, 3));
+                p += size;
+                if (type == 0x2f)
+                    break;
+            }
+            else if (byte == 0xf0 || byte == 0xf7) {
+                ++p;
+                uint32_t size;
+                if (!read_varlen(p, track_end, size) || (size_t)(track_end - p) < size)
+                    return false;
+                // a sysex gets its F0 back, an escape is sent as it is
+                if (byte == 0xf0) {
+                    track_events.push_back(Track_Event{tick, true, pool_.size(), size + 1});
+                    pool_.push_back(0xf0);
+                    pool_.insert(pool_.end(), p, p + size);
+                }
+                else if (size > 0)
+                    track_events.push_back(Track_Event{tick, false, (size_t)(p - base), size});
+                p += size;
+                status = 0;
+            }
+            else {
+                bool running = !(byte & 0x80);
+                if (!running)
+                    status = *p++;
+                else if (status == 0)
+                    return false;
+                unsigned size = ((status & 0xe0) == 0xc0) ? 1 : 2;
+                if ((size_t)(track_end - p) < size)
+                    return false;
+                if (!running)
+                    track_events.push_back(Track_Event{tick, false, (size_t)(p - 1 - base), size + 1});
+                else {
+                    track_events.push_back(Track_Event{tick, true, pool_.size(), size + 1});
+                    pool_.push_back(status);
+                    pool_.insert(pool_.end(), p, p + size);
+                }
+                p += size;
+            }
+        }
+        end_tick = std::max(end_tick, tick);
+    }
+
+    // the tracks are merged, keeping the order of the file at the same tick
+    std::stable_sort(
+        track_events.begin(), track_events.end(),
+        [](const Track_Event &a, const Track_Event &b) -> bool { return a.tick < b.tick; });
+    std::stable_sort(
+        tempos.begin(), tempos.end(),
+        [](const std::pair<uint64_t, uint32_t> &a, const std::pair<uint64_t, uint32_t> &b) -> bool { return a.first < b.first; });
+
+    // the tempo map, as the time and duration of a tick from each change
+    struct Tempo_Point {
+        uint64_t tick;
+        double time;
+        double tick_duration;
+    };
+    std::vector<Tempo_Point> tempo_map;
+    if (division & 0x8000) {
+        // SMPTE: frames per second, and ticks per frame
+        int fps = -(int8_t)(division >> 8);
+        double rate = (fps == 29) ? 29.97 : fps;
+        unsigned ticks = division & 0xff;
+        if (fps <= 0 || ticks == 0)
+            return false;
+        tempo_map.push_back(Tempo_Point{0, 0, 1.0 / (rate * ticks)});
+    }
+    else {
+        double tick_duration = 500000e-6 / division;
+        tempo_map.push_back(Tempo_Point{0, 0, tick_duration});
+        for (const std::pair<uint64_t, uint32_t> &tempo : tempos) {
+            const Tempo_Point &last = tempo_map.back();
+            double time = last.time + (tempo.first - last.tick) * last.tick_duration;
+            tick_duration = tempo.second * 1e-6 / division;
+            if (tempo.first == last.tick)
+                tempo_map.back().tick_duration = tick_duration;
+            else
+                tempo_map.push_back(Tempo_Point{tempo.first, time, tick_duration});
+        }
+    }
+
+    size_t itempo = 0;
+    auto time_of_tick = [&](uint64_t tick) -> double {
+        while (itempo + 1 < tempo_map.size() && tempo_map[itempo + 1].tick <= tick)
+            ++itempo;
+        const Tempo_Point &point = tempo_map[itempo];
+        return point.time + (tick - point.tick) * point.tick_duration;
+    };
+
+    events_.reserve(track_events.size());
+    for (const Track_Event &te : track_events) {
+        const uint8_t *data = (te.pooled ? pool_.data() : base) + te.offset;
+        events_.push_back(Event{time_of_tick(te.tick), data, te.size});
+    }
+    duration_ = time_of_tick(end_tick);
+
+    return !events_.empty();
+}
+
+void Midi_File_Source::Impl::play_all_off()
+{
+    // all notes off and reset of the controllers, on every channel
+    uint8_t messages[2 * 16][3];
+    Midi_Event batch[2 * 16];
+    for (unsigned channel = 0; channel < 16; ++channel) {
+        for (unsigned i = 0; i < 2; ++i) {
+            uint8_t *msg = messages[2 * channel + i];
+            msg[0] = 0xb0 | channel;
+            msg[1] = i ? 121 : 123;
+            msg[2] = 0;
+            Midi_Event &ev = batch[2 * channel + i];
+            ev = Midi_Event();
+            ev.size = 3;
+            ev.data = msg;
+        }
+    }
+    play_midi_events(batch, 2 * 16);
+}
@@ -0,0 +1,45 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <memory>
+
+// Player of a Standard MIDI File as a source of input, next to the live
+// one. The file is mapped in memory and its tracks are merged in advance
+// into one list of messages timed in seconds, through the tempo map. The
+// audio thread plays the messages at their frame, by the same path as the
+// live events.
+class Midi_File_Source {
+public:
+    Midi_File_Source();
+    ~Midi_File_Source();
+
+    bool open(const std::string &path);
+    void close();
+    // the length of the file in seconds
+    double duration() const;
+
+    // starts from the beginning; speed multiplies the tempo
+    void start(unsigned sample_rate, double speed, bool loop);
+    void stop();
+    bool active() const;
+    void set_sample_rate(unsigned sample_rate);
+
+    // from the audio thread: plays the messages which are due, then
+    // advances to the next message, at most by max_frames, and returns the
+    // frames advanced
+    unsigned play(unsigned max_frames);
+
+    // the position in the file in seconds, and the count of loops done
+    double position() const;
+    unsigned loop_count() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+extern Midi_File_Source midi_file_source;
@@ -4,10 +4,17 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include "player.h"
+#include "bank_cache.h"
+#include "bank_format.h"
+#include "cache_file.h"
+#include <list>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
+std::atomic<unsigned> Player::change_serial_{0};
+
 Player *Player::create(Player_Type pt, unsigned sample_rate)
 {
     std::unique_ptr<Player> instance;
@@ -67,14 +74,58 @@ double Player::output_gain(Player_Type pt)
     }
 }
 
-auto Player::enumerate_emulators(Player_Type pt) -> std::vector<Emulator>
+unsigned Player::native_sample_rate(Player_Type pt)
 {
-    std::vector<Emulator> emus;
+    switch (pt) {
+    default: assert(false); abort();
+    #define PLAYER_CASE(x)                                                  \
+        case Player_Type::x: return Player_Traits<Player_Type::x>::native_sample_rate;
+    EACH_PLAYER_TYPE(PLAYER_CASE);
+    #undef PLAYER_CASE
+    }
+}
+
+// the emulators of each player type, probed once per run, or loaded from
+// the disk cache of a previous run with the same library version
+struct Emulator_Catalog {
+    std::mutex mutex;
+    bool valid[player_type_count] = {};
+    std::vector<Player::Emulator> emulators[player_type_count];
+    unsigned default_id[player_type_count] = {};
+    // storage of the names, which have stable addresses in the list
+    std::list<std::string> names;
+    const char *intern(const std::string &name);
+    void probe(Player_Type pt);
+};
+
+static Emulator_Catalog &emulator_catalog()
+{
+    static Emulator_Catalog catalog;
+    return catalog;
+}
+
+static const char emulator_catalog_magic[] = "adljack-emulators 1";
+
+const char *Emulator_Catalog::intern(const std::string &name)
+{
+    for (const std::string &x : names)
+        if (x == name)
+            return x.c_str();
+    names.push_back(name);
+    return names.back().c_str();
+}
+
+void Emulator_Catalog::probe(Player_Type pt)
+{
+    std::vector<Player::Emulator> &emus = emulators[(unsigned)pt];
+    emus.clear();
     emus.reserve(32);
 
-    std::unique_ptr<Player> player(create(pt, 44100));
+    std::unique_ptr<Player> player(Player::create(pt, 44100));
 
     player->set_chip_count(1);
+    std::string default_name = player->emulator_name();
+    default_id[(unsigned)pt] = (unsigned)-1;
 
     for (unsigned i = 0; i < 32; ++i) {
         if (pt == Player_Type::OPN2 && i == OPNMIDI_VGM_DUMPER) {
@@ -82,14 +133,38 @@ auto Player::enumerate_emulators(Player_Type pt) -> std::vector<Emulator>
         }
 
         if (player->set_emulator(i)) {
-            Emulator emu;
+            Player::Emulator emu;
             emu.id = i;
-            emu.name = player->emulator_name();
+            emu.name = intern(player->emulator_name());
             emus.push_back(emu);
+            if (default_id[(unsigned)pt] == (unsigned)-1 && default_name == emu.name)
+                default_id[(unsigned)pt] = i;
         }
     }
 
-    return emus;
+    valid[(unsigned)pt] = true;
+}
+
+auto Player::enumerate_emulators(Player_Type pt) -> std::vector<Emulator>
+{
+    Emulator_Catalog &catalog = emulator_catalog();
+    std::lock_guard<std::mutex> lock(catalog.mutex);
+    if (!catalog.valid[(unsigned)pt])
+        catalog.probe(pt);
+    return catalog.emulators[(unsigned)pt];
+}
+
+auto Player::default_emulator(Player_Type pt) -> Emulator
+{
+    Emulator_Catalog &catalog = emulator_catalog();
+    std::lock_guard<std::mutex> lock(catalog.mutex);
+    if (!catalog.valid[(unsigned)pt])
+        catalog.probe(pt);
+    unsigned id = catalog.default_id[(unsigned)pt];
+    for (const Emulator &emu : catalog.emulators[(unsigned)pt])
+        if (emu.id == id)
+            return emu;
+    return Emulator();
 }
 
 unsigned Player::emulator_by_name(Player_Type pt, const char *name)
@@ -97,10 +172,84 @@ unsigned Player::emulator_by_name(Player_Type pt, const char *name)
     std::vector<Emulator> emus = enumerate_emulators(pt);
     for (unsigned i = 0, n = emus.size(); i < n; ++i)
         if (!strcmp(emus[i].name, name))
-            return i;
+            return emus[i].id;
     return (unsigned)-1;
 }
 
+bool Player::load_emulator_catalog(const char *path)
+{
+    Emulator_Catalog &catalog = emulator_catalog();
+    std::lock_guard<std::mutex> lock(catalog.mutex);
+
+    std::vector<Emulator> emus[player_type_count];
+    unsigned default_id[player_type_count];
+    bool found[player_type_count] = {};
+    Player_Type current = Player_Type::INVALID;
+
+    bool read = read_cache_file(path, emulator_catalog_magic, [&](const std::vector<std::string> &fields) -> bool {
+        if (fields[0] == "T" && fields.size() == 4) {
+            // the entries are valid only for the same library version
+            current = type_by_name(fields[1].c_str());
+            if (current != Player_Type::INVALID && fields[2] != version(current))
+                current = Player_Type::INVALID;
+            if (current != Player_Type::INVALID) {
+                found[(unsigned)current] = true;
+                default_id[(unsigned)current] = strtoul(fields[3].c_str(), nullptr, 10);
+            }
+        }
+        else if (fields[0] == "E" && fields.size() == 3) {
+            if (current == Player_Type::INVALID)
+                return true;
+            Emulator emu;
+            emu.id = strtoul(fields[1].c_str(), nullptr, 10);
+            emu.name = catalog.intern(fields[2]);
+            emus[(unsigned)current].push_back(emu);
+        }
+        return true;
+    });
+    if (!read)
+        return false;
+
+    bool complete = true;
+    for (unsigned i = 0; i < player_type_count; ++i) {
+        if (!found[i] || emus[i].empty()) {
+            complete = false;
+            continue;
+        }
+        if (catalog.valid[i])
+            continue;
+        catalog.emulators[i] = std::move(emus[i]);
+        catalog.default_id[i] = default_id[i];
+        catalog.valid[i] = true;
+    }
+
+    return complete;
+}
+
+bool Player::save_emulator_catalog(const char *path)
+{
+    for (Player_Type pt : all_player_types)
+        enumerate_emulators(pt);
+
+    FILE *stream = fopen(path, "wb");
+    if (!stream)
+        return false;
+
+    Emulator_Catalog &catalog = emulator_catalog();
+    std::lock_guard<std::mutex> lock(catalog.mutex);
+
+    fprintf(stream, "%s\n", emulator_catalog_magic);
+    for (Player_Type pt : all_player_types) {
+        fprintf(stream, "T\t%s\t%s\t%u\n", name(pt), version(pt),
+                catalog.default_id[(unsigned)pt]);
+        for (const Emulator &emu : catalog.emulators[(unsigned)pt])
+            fprintf(stream, "E\t%u\t%s\n", emu.id, emu.name);
+    }
+
+    bool ok = !ferror(stream);
+    return fclose(stream) == 0 && ok;
+}
+
 Player_Type Player::type_by_name(const char *nam)
 {
     for (Player_Type pt : all_player_types) {
@@ -112,12 +261,140 @@ Player_Type Player::type_by_name(const char *nam)
     return Player_Type::INVALID;
 }
 
-bool Player::dynamic_set_chip_count(unsigned nchip)
+bool Player::dynamic_set_chip_count(unsigned nchip, const Midi_Tracking &tracking)
 {
-    auto lock = take_lock();
-    auto lock2 = setBusy();
-    panic();
-    return set_chip_count(nchip);
+    if (nchip == chip_count())
+        return true;
+    return dynamic_rebuild(sample_rate_, nchip, tracking);
+}
+
+bool Player::dynamic_set_sample_rate(unsigned sample_rate, const Midi_Tracking &tracking)
+{
+    if (sample_rate == sample_rate_)
+        return true;
+    return dynamic_rebuild(sample_rate, chip_count(), tracking);
+}
+
+bool Player::dynamic_rebuild(unsigned sample_rate, unsigned nchip, const Midi_Tracking &tracking)
+{
+    // initialize the new chips out of the lock, with the same settings
+    std::unique_ptr<Player> fresh(create(type(), sample_rate));
+    if (!fresh)
+        return false;
+    if (strcmp(fresh->emulator_name(), emulator_name()) != 0 &&
+        !fresh->set_emulator(emulator_))
+        return false;
+    fresh->set_soft_pan_enabled(soft_pan_);
+    if (!fresh->set_chip_count(nchip))
+        return false;
+    if (bank_image_) {
+        if (!fresh->load_bank_data(bank_image_->bank_data(), bank_image_->bank_size()))
+            return false;
+    }
+    else if (embedded_bank_ >= 0) {
+        if (!fresh->set_embedded_bank(embedded_bank_))
+            return false;
+    }
+    // the instruments set since the bank, as SysEx may set them meanwhile
+    std::vector<Instrument_Override> overrides;
+    {
+        auto lock = take_lock();
+        overrides = instrument_overrides_;
+    }
+    if (!overrides.empty()) {
+        std::unique_ptr<Player> source(create(type(), sample_rate));
+        if (!source)
+            return false;
+        for (const Instrument_Override &ov : overrides) {
+            if (!source->load_bank_data(ov.data.data(), ov.data.size()) ||
+                !fresh->copy_instrument(*source, ov.id))
+                return false;
+        }
+    }
+    fresh->set_channel_alloc_mode(chanalloc_);
+
+    {
+        auto lock = take_lock();
+        auto lock2 = setBusy();
+        // the held notes start again on the new chips, and those which do
+        // not fit anymore are dropped by the voice allocation
+        fresh->replay_channel_state(tracking);
+        if (!swap_synth(*fresh))
+            return false;
+        sample_rate_ = sample_rate;
+    }
+
+    // fresh has the old synthesizer now, which is deleted out of the lock
+    return true;
+}
+
+void Player::replay_channel_state(const Midi_Tracking &tk)
+{
+    // the mode first, for it resets the channels
+    if (*tk.mode_sysex_size > 0)
+        rt_system_exclusive(tk.mode_sysex, *tk.mode_sysex_size);
+
+    for (unsigned channel = 0; channel < 16; ++channel) {
+        const Program &program = tk.program[channel];
+        rt_bank_change_msb(channel, program.bank_msb);
+        rt_bank_change_lsb(channel, program.bank_lsb);
+        rt_program_change(channel, program.gm);
+
+        const uint8_t *controller = tk.controller[channel];
+        for (unsigned cc = 0; cc < 120; ++cc) {
+            switch (cc) {
+            case 0: case 32:  // bank select, done
+            case 6: case 38: case 96: case 97:  // data entry
+            case 98: case 99: case 100: case 101:  // RPN/NRPN select
+                continue;
+            }
+            if (controller[cc] != 0xff)
+                rt_controller_change(channel, cc, controller[cc]);
+        }
+
+        unsigned sensitivity = tk.bend_sensitivity[channel];
+        if (sensitivity != (unsigned)-1) {
+            rt_controller_change(channel, 101, 0);
+            rt_controller_change(channel, 100, 0);
+            rt_controller_change(channel, 6, sensitivity >> 7);
+            rt_controller_change(channel, 38, sensitivity & 0x7f);
+        }
+        unsigned rpn = tk.rpn[channel];
+        rt_controller_change(channel, 101, rpn >> 7);
+        rt_controller_change(channel, 100, rpn & 0x7f);
+
+        rt_pitchbend(channel, tk.pitchbend[channel]);
+
+        const std::bitset<128> &active = tk.note_active[channel];
+        for (unsigned note = 0; note < 128; ++note) {
+            if (active[note])
+                rt_note_on(channel, note, tk.note_velocity[channel][note]);
+        }
+        // the pedal is down again, so the notes it held are released under it
+        const std::bitset<128> &sustained = tk.note_sustained[channel];
+        for (unsigned note = 0; note < 128; ++note) {
+            if (sustained[note]) {
+                rt_note_on(channel, note, tk.note_velocity[channel][note]);
+                rt_note_off(channel, note);
+            }
+        }
+    }
+}
+
+bool is_mode_sysex(const uint8_t *msg, unsigned len)
+{
+    // F0 7E <dev> 09 01|02|03 F7: GM on, GM off, GM2 on
+    if (len == 6 && msg[1] == 0x7e && msg[3] == 0x09 && msg[4] >= 0x01 && msg[4] <= 0x03)
+        return true;
+    // F0 41 <dev> 42 12 40 00 7F <mode> <sum> F7: GS reset
+    if (len == 11 && msg[1] == 0x41 && msg[3] == 0x42 && msg[4] == 0x12 &&
+        msg[5] == 0x40 && msg[6] == 0x00 && msg[7] == 0x7f)
+        return true;
+    // F0 43 1n 4C 00 00 7E 00 F7: XG system on
+    if (len == 9 && msg[1] == 0x43 && (msg[2] & 0xf0) == 0x10 && msg[3] == 0x4c &&
+        msg[4] == 0x00 && msg[5] == 0x00 && msg[6] == 0x7e && msg[7] == 0x00)
+        return true;
+    return false;
 }
 
 bool Player::dynamic_set_emulator(unsigned emulator)
@@ -130,20 +407,120 @@ bool Player::dynamic_set_emulator(unsigned emulator)
 
 bool Player::dynamic_set_embedded_bank(const char *curBankFile, int bank)
 {
+    if (bank < 0)
+        return dynamic_load_bank(curBankFile);
     auto lock = take_lock();
     auto lock2 = setBusy();
     panic();
-    bool ret = bank >= 0 ? set_embedded_bank(bank) : load_bank_file(curBankFile);
-    return ret;
+    bank_image_.reset();
+    instrument_overrides_.clear();
+    return set_embedded_bank(bank);
 }
 
 bool Player::dynamic_load_bank(const char *bankfile)
+{
+    // read or fetch the image before taking the lock
+    Bank_Image_Ptr image = bank_cache.load(bankfile);
+    if (!image)
+        return false;
+    return dynamic_load_bank(image);
+}
+
+bool Player::dynamic_load_bank(Bank_Image_Ptr image)
 {
     auto lock = take_lock();
     auto lock2 = setBusy();
     panic();
-    if (!load_bank_file(bankfile))
+    if (!load_bank_data(image->bank_data(), image->bank_size()))
+        return false;
+    bank_image_ = image;
+    instrument_overrides_.clear();
+    return true;
+}
+
+bool Player::dynamic_update_bank(const char *bankfile)
+{
+    Bank_Image_Ptr new_image = bank_cache.load(bankfile);
+    if (!new_image)
+        return false;
+    return dynamic_update_bank(new_image);
+}
+
+bool Player::dynamic_update_bank(Bank_Image_Ptr new_image)
+{
+    Bank_Image_Ptr old_image = bank_image_;
+
+    std::vector<Bank_Instrument_Id> changed;
+    if (!old_image || old_image->path != new_image->path ||
+        !diff_bank_data(old_image->bank_data(), old_image->bank_size(),
+                        new_image->bank_data(), new_image->bank_size(), changed))
+        return dynamic_load_bank(new_image);
+
+    if (!changed.empty() &&
+        !dynamic_update_instruments(new_image->bank_data(), new_image->bank_size(), changed))
+        return dynamic_load_bank(new_image);
+
+    auto lock = take_lock();
+    bank_image_ = new_image;
+    // the instruments changed in the file replace those set since
+    for (const Bank_Instrument_Id &id : changed)
+        remove_instrument_override(id);
+    return true;
+}
+
+bool Player::dynamic_update_instruments(const void *data, size_t size, const std::vector<Bank_Instrument_Id> &ids)
+{
+    // decode the instruments with a separate player, out of the lock
+    std::unique_ptr<Player> source(create(type(), sample_rate_));
+    if (!source || !source->load_bank_data(data, size))
+        return false;
+
+    // the instruments change between two audio blocks, the voices which use
+    // them keep their current setting until the next note
+    auto lock = take_lock();
+    auto lock2 = setBusy();
+    for (const Bank_Instrument_Id &id : ids) {
+        if (!copy_instrument(*source, id))
+            return false;
+    }
+    return true;
+}
+
+bool Player::dynamic_set_instrument(const Bank_Instrument_Id &id, const uint8_t *record, size_t size)
+{
+    std::vector<uint8_t> data;
+    if (!make_instrument_bank(type(), id, record, size, data))
+        return false;
+    if (!dynamic_update_instruments(data.data(), data.size(), std::vector<Bank_Instrument_Id>{id}))
+        return false;
+
+    // kept to be set again, if the synth is rebuilt
+    auto lock = take_lock();
+    remove_instrument_override(id);
+    instrument_overrides_.push_back(Instrument_Override{id, std::move(data)});
+    return true;
+}
+
+void Player::remove_instrument_override(const Bank_Instrument_Id &id)
+{
+    auto same = [&id](const Instrument_Override &ov) -> bool {
+        return ov.id.percussive == id.percussive && ov.id.msb == id.msb &&
+            ov.id.lsb == id.lsb && ov.id.program == id.program;
+    };
+    instrument_overrides_.erase(
+        std::remove_if(instrument_overrides_.begin(), instrument_overrides_.end(), same),
+        instrument_overrides_.end());
+}
+
+bool Player::load_bank(const char *bankfile)
+{
+    Bank_Image_Ptr image = bank_cache.load(bankfile);
+    if (!image)
+        return false;
+    if (!load_bank_data(image->bank_data(), image->bank_size()))
         return false;
+    bank_image_ = image;
+    instrument_overrides_.clear();
     return true;
 }
 
@@ -10,6 +10,67 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <bitset>
+#include <algorithm>
+#include <stdint.h>
+
+struct Program {
+    unsigned gm = 0;
+    unsigned bank_msb = 0;
+    unsigned bank_lsb = 0;
+};
+
+struct Sysex_Block;
+struct Bank_Image;
+
+struct Bank_Instrument_Id {
+    bool percussive = false;
+    unsigned msb = 0;
+    unsigned lsb = 0;
+    unsigned program = 0;
+};
+
+// a complete MIDI message, at a frame offset from the start of the block
+struct Midi_Event {
+    unsigned time = 0;
+    unsigned size = 0;
+    const uint8_t *data = nullptr;
+    // the pool block holding the data, for a message passed by reference
+    Sysex_Block *block = nullptr;
+};
+
+// the longest system exclusive which sets the mode of the device
+static constexpr unsigned midi_mode_sysex_max = 16;
+// tells if a system exclusive resets the device or sets its mode: GM, GS or XG
+bool is_mode_sysex(const uint8_t *msg, unsigned len);
+
+// the channel state which is kept up to date while events are dispatched;
+// each array has one element per MIDI channel
+struct Midi_Tracking {
+    unsigned *note_count = nullptr;
+    std::bitset<128> *note_active = nullptr;
+    // the notes released, but held by the sustain pedal
+    std::bitset<128> *note_sustained = nullptr;
+    unsigned *last_note_p1 = nullptr;
+    Program *program = nullptr;
+    uint8_t (*note_velocity)[128] = nullptr;
+    // last value of each controller, or 0xff if none since the reset
+    uint8_t (*controller)[128] = nullptr;
+    unsigned *pitchbend = nullptr;
+    // the selected RPN, and the pitch bend sensitivity (RPN 0) if set,
+    // otherwise -1; both as 14-bit values
+    unsigned *rpn = nullptr;
+    unsigned *bend_sensitivity = nullptr;
+    // the system exclusive messages not addressed to this device are ignored
+    unsigned sysex_device_id = 0x7f;
+    // the last system exclusive which set the mode, of midi_mode_sysex_max
+    // bytes at most
+    uint8_t *mode_sysex = nullptr;
+    unsigned *mode_sysex_size = nullptr;
+    // receives the system exclusive messages other than universal, after
+    // the player, for the processing which is not time-critical
+    void (*other_sysex)(const Midi_Event &event) = nullptr;
+};
 
 class Player {
 protected:
@@ -27,6 +88,8 @@ public:
     static const char *version(Player_Type pt);
     static const char *chip_name(Player_Type pt);
     static double output_gain(Player_Type pt);
+    // the rate at which the chip generates samples
+    static unsigned native_sample_rate(Player_Type pt);
 
     struct Emulator {
         unsigned id = (unsigned)-1;
@@ -34,8 +97,14 @@ public:
         operator bool() const { return id != (unsigned)-1; }
     };
 
+    // the emulators are probed once, the results are kept for later calls
     static std::vector<Emulator> enumerate_emulators(Player_Type pt);
+    static Emulator default_emulator(Player_Type pt);
     static unsigned emulator_by_name(Player_Type pt, const char *name);
+    // saves and restores the probed emulators across runs; those recorded
+    // for another library version are ignored
+    static bool load_emulator_catalog(const char *path);
+    static bool save_emulator_catalog(const char *path);
 
     const char *name() const
         { return name(type()); }
@@ -62,8 +131,14 @@ public:
     unsigned emulator() const { return emulator_; }
     virtual unsigned chip_count() const = 0;
     virtual bool set_chip_count(unsigned count) = 0;
+    int embedded_bank() const { return embedded_bank_; }
+    bool soft_pan_enabled() const { return soft_pan_; }
     virtual bool load_bank_file(const char *file) = 0;
     virtual bool load_bank_data(const void *data, size_t size) = 0;
+    // loads a WOPL/WOPN file or a compiled image, through the bank cache
+    bool load_bank(const char *file);
+    // the bank file which is loaded, if any
+    std::shared_ptr<const Bank_Image> bank_image() const { return bank_image_; }
     virtual void set_channel_alloc_mode(int chanalloc) = 0;
     virtual int get_channel_alloc_mode() = 0;
     virtual void generate(unsigned nframes, void *left, void *right, const Audio_Format &format) = 0;
@@ -78,11 +153,30 @@ public:
     virtual void rt_bank_change_msb(unsigned chan, unsigned value) = 0;
     virtual void rt_bank_change_lsb(unsigned chan, unsigned value) = 0;
     virtual void rt_system_exclusive(const uint8_t *msg, size_t length) = 0;
+    // plays a sequence of events in a single pass, updating the tracking
+    virtual void rt_events(const Midi_Event *events, size_t count, const Midi_Tracking &tracking) = 0;
 
-    bool dynamic_set_chip_count(unsigned nchip);
+    // changes the chip count keeping the notes held: the synthesizer with
+    // the new chips is prepared aside, then takes over at a block boundary
+    // with the state of the channels replayed
+    bool dynamic_set_chip_count(unsigned nchip, const Midi_Tracking &tracking);
+    // changes the sample rate the same way, when the host rate changes
+    bool dynamic_set_sample_rate(unsigned sample_rate, const Midi_Tracking &tracking);
+    // sends the events which restore the state of the channels, held notes
+    // included, to a freshly reset player
+    void replay_channel_state(const Midi_Tracking &tracking);
     bool dynamic_set_emulator(unsigned emulator);
     bool dynamic_set_embedded_bank(const char *curBankFile, int bank);
     bool dynamic_load_bank(const char *bankfile);
+    bool dynamic_load_bank(std::shared_ptr<const Bank_Image> image);
+    // reloads a modified bank file; if possible, only the instruments which
+    // changed are replaced, and the notes keep playing
+    bool dynamic_update_bank(const char *bankfile);
+    bool dynamic_update_bank(std::shared_ptr<const Bank_Image> image);
+    // replaces the given instruments with those of the bank data
+    bool dynamic_update_instruments(const void *data, size_t size, const std::vector<Bank_Instrument_Id> &ids);
+    // replaces an instrument with a WOPL/WOPN record, of the latest version
+    bool dynamic_set_instrument(const Bank_Instrument_Id &id, const uint8_t *record, size_t size);
     void dynamic_panic();
     void dynamic_set_channel_alloc(int chanalloc);
     const char *get_channel_alloc_mode_name() const;
@@ -100,6 +194,7 @@ public:
         explicit BusyHolder(Player *p) : m_p(p)
         {
             m_p->is_busy = true;
+            change_serial_.fetch_add(1, std::memory_order_relaxed);
         }
 
         ~BusyHolder()
@@ -111,12 +206,39 @@ public:
     BusyHolder setBusy() { return BusyHolder(this); }
     bool isBusy() const { return is_busy; };
 
+    // counts the changes made under the lock while busy, by all players;
+    // read under the lock, it tells which changes precede a block
+    static unsigned change_serial()
+        { return change_serial_.load(std::memory_order_relaxed); }
+
+protected:
+    // copies an instrument from another player of the same type
+    virtual bool copy_instrument(Player &from, const Bank_Instrument_Id &id) = 0;
+    // exchanges the synthesizers with another player of the same type
+    virtual bool swap_synth(Player &other) = 0;
+
+private:
+    // prepares a synthesizer with the new settings, and swaps it in
+    bool dynamic_rebuild(unsigned sample_rate, unsigned nchip, const Midi_Tracking &tracking);
+
 protected:
     unsigned sample_rate_ = 0;
     unsigned emulator_ = 0;
     int chanalloc_ = 0;
+    int embedded_bank_ = -1;
+    bool soft_pan_ = false;
     std::mutex mutex_;
     std::atomic<bool> is_busy;
+    static std::atomic<unsigned> change_serial_;
+    // the bank file which is loaded, if any
+    std::shared_ptr<const Bank_Image> bank_image_;
+    // the instruments set since, each as a bank which holds it alone
+    struct Instrument_Override {
+        Bank_Instrument_Id id;
+        std::vector<uint8_t> data;
+    };
+    std::vector<Instrument_Override> instrument_overrides_;
+    void remove_instrument_override(const Bank_Instrument_Id &id);
 };
 
 template <Player_Type Pt>
@@ -159,13 +281,31 @@ public:
             return Traits::set_num_chips(player_.get(), count) >= 0 && chip_count() == count;
         }
     bool set_embedded_bank(int bank) override
-        { return Traits::set_bank(player_.get(), bank) >= 0; }
+        {
+            bool success = Traits::set_bank(player_.get(), bank) >= 0;
+            if (success)
+                embedded_bank_ = bank;
+            return success;
+        }
     void set_soft_pan_enabled(bool sp) override
-        { return Traits::set_soft_pan_enabled(player_.get(), sp); }
+        {
+            Traits::set_soft_pan_enabled(player_.get(), sp);
+            soft_pan_ = sp;
+        }
     bool load_bank_file(const char *file) override
-        { return Traits::open_bank_file(player_.get(), file) >= 0; }
+        {
+            bool success = Traits::open_bank_file(player_.get(), file) >= 0;
+            if (success)
+                embedded_bank_ = -1;
+            return success;
+        }
     bool load_bank_data(const void *data, size_t size) override
-        { return Traits::open_bank_data(player_.get(), data, size) >= 0; }
+        {
+            bool success = Traits::open_bank_data(player_.get(), data, size) >= 0;
+            if (success)
+                embedded_bank_ = -1;
+            return success;
+        }
     void set_channel_alloc_mode(int chanalloc) override
         {
             Traits::set_channel_alloc_mode(player_.get(), chanalloc);
@@ -197,4 +337,170 @@ public:
         { Traits::rt_bank_change_lsb(player_.get(), chan, value); }
     void rt_system_exclusive(const uint8_t *msg, size_t length) override
         { Traits::rt_system_exclusive(player_.get(), msg, length); }
+    void rt_events(const Midi_Event *events, size_t count, const Midi_Tracking &tracking) override;
+
+protected:
+    bool copy_instrument(Player &from, const Bank_Instrument_Id &id) override;
+    bool swap_synth(Player &other) override
+        {
+            if (other.type() != Pt)
+                return false;
+            player_.swap(static_cast<Generic_Player<Pt> &>(other).player_);
+            return true;
+        }
 };
+
+template <Player_Type Pt>
+bool Generic_Player<Pt>::copy_instrument(Player &from, const Bank_Instrument_Id &id)
+{
+    if (from.type() != Pt)
+        return false;
+    player_t *src = static_cast<Generic_Player<Pt> &>(from).player_.get();
+    player_t *dst = player_.get();
+
+    typename Traits::bank_id bank_id;
+    bank_id.percussive = id.percussive;
+    bank_id.msb = id.msb;
+    bank_id.lsb = id.lsb;
+
+    typename Traits::bank src_bank, dst_bank;
+    typename Traits::instrument ins;
+    return Traits::get_bank(src, &bank_id, 0, &src_bank) >= 0 &&
+        Traits::get_instrument(src, &src_bank, id.program, &ins) >= 0 &&
+        Traits::get_bank(dst, &bank_id, Traits::bank_create, &dst_bank) >= 0 &&
+        Traits::set_instrument(dst, &dst_bank, id.program, &ins) >= 0;
+}
+
+template <Player_Type Pt>
+void Generic_Player<Pt>::rt_events(const Midi_Event *events, size_t count, const Midi_Tracking &tk)
+{
+    player_t *player = player_.get();
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t *msg = events[i].data;
+        unsigned len = events[i].size;
+        if (len <= 0)
+            continue;
+
+        uint8_t status = msg[0];
+        if (status == 0xf0) {
+            if (len < 4 || msg[len - 1] != 0xf7 ||
+                (msg[2] != tk.sysex_device_id && msg[2] != 0x7f /* broadcast */))
+                continue;
+            Traits::rt_system_exclusive(player, msg, len);
+            if (len <= midi_mode_sysex_max && is_mode_sysex(msg, len)) {
+                std::copy(msg, msg + len, tk.mode_sysex);
+                *tk.mode_sysex_size = len;
+            }
+            if (msg[1] != 0x7f /* universal realtime */ && tk.other_sysex)
+                tk.other_sysex(events[i]);
+            continue;
+        }
+
+        uint8_t channel = status & 0x0f;
+        switch (status >> 4) {
+        case 0b1001: {
+            if (len < 3) break;
+            unsigned vel = msg[2] & 0x7f;
+            if (vel != 0) {
+                unsigned note = msg[1] & 0x7f;
+                Traits::rt_note_on(player, channel, note, vel);
+                tk.note_velocity[channel][note] = vel;
+                tk.note_sustained[channel][note] = false;
+                if (!tk.note_active[channel][note]) {
+                    ++tk.note_count[channel];
+                    tk.note_active[channel][note] = true;
+                }
+                tk.last_note_p1[channel] = note + 1;
+                break;
+            }
+        }
+        case 0b1000: {
+            if (len < 3) break;
+            unsigned note = msg[1] & 0x7f;
+            Traits::rt_note_off(player, channel, note);
+            if (tk.note_active[channel][note]) {
+                --tk.note_count[channel];
+                tk.note_active[channel][note] = false;
+                unsigned sustain = tk.controller[channel][64];
+                if (sustain != 0xff && sustain >= 64)
+                    tk.note_sustained[channel][note] = true;
+            }
+            break;
+        }
+        case 0b1010:
+            if (len < 3) break;
+            Traits::rt_note_aftertouch(player, channel, msg[1] & 0x7f, msg[2] & 0x7f);
+            break;
+        case 0b1101:
+            if (len < 2) break;
+            Traits::rt_channel_aftertouch(player, channel, msg[1] & 0x7f);
+            break;
+        case 0b1011: {
+            if (len < 3) break;
+            unsigned cc = msg[1] & 0x7f;
+            unsigned val = msg[2] & 0x7f;
+            Traits::rt_controller_change(player, channel, cc, val);
+            tk.controller[channel][cc] = val;
+            switch (cc) {
+            case 120: case 123:
+                tk.note_count[channel] = 0;
+                tk.note_active[channel].reset();
+                tk.note_sustained[channel].reset();
+                break;
+            case 64:
+                if (val < 64)
+                    tk.note_sustained[channel].reset();
+                break;
+            case 121:
+                tk.note_sustained[channel].reset();
+                std::fill(tk.controller[channel], tk.controller[channel] + 128, 0xff);
+                tk.pitchbend[channel] = 8192;
+                tk.rpn[channel] = 0x3fff;
+                break;
+            case 0:
+                tk.program[channel].bank_msb = val;
+                break;
+            case 32:
+                tk.program[channel].bank_lsb = val;
+                break;
+            case 101:
+                tk.rpn[channel] = (tk.rpn[channel] & 0x7f) | (val << 7);
+                break;
+            case 100:
+                tk.rpn[channel] = (tk.rpn[channel] & ~0x7fu) | val;
+                break;
+            case 99: case 98:  // NRPN
+                tk.rpn[channel] = 0x3fff;
+                break;
+            case 6:
+                if (tk.rpn[channel] == 0) {
+                    unsigned lsb = (tk.bend_sensitivity[channel] != (unsigned)-1) ?
+                        (tk.bend_sensitivity[channel] & 0x7f) : 0;
+                    tk.bend_sensitivity[channel] = (val << 7) | lsb;
+                }
+                break;
+            case 38:
+                if (tk.rpn[channel] == 0 && tk.bend_sensitivity[channel] != (unsigned)-1)
+                    tk.bend_sensitivity[channel] = (tk.bend_sensitivity[channel] & ~0x7fu) | val;
+                break;
+            }
+            break;
+        }
+        case 0b1100: {
+            if (len < 2) break;
+            unsigned pgm = msg[1] & 0x7f;
+            Traits::rt_program_change(player, channel, pgm);
+            tk.program[channel].gm = pgm;
+            break;
+        }
+        case 0b1110: {
+            if (len < 3) break;
+            unsigned value = (msg[1] & 0x7f) | ((msg[2] & 0x7f) << 7);
+            Traits::rt_pitchbend(player, channel, value);
+            tk.pitchbend[channel] = value;
+            break;
+        }
+        }
+    }
+}
@@ -9,6 +9,10 @@
 
 const double Player_Traits<Player_Type::OPL3>::output_gain = pow(10.0, 3.0 / 20.0);
 
+// The embedded bank stays as WOPN data, not as a bank image: the array is
+// static, so it is neither read nor copied, and libOPNMIDI decodes any bank
+// into its own instruments, an image as well, so the decoding on each call
+// would remain the same.
 int player_opnmidi_set_bank(struct OPN2_MIDIPlayer *pl, int bank)
 {
 #pragma message("Using my own bank embed for OPN2. Remove this in the future.")
@@ -45,6 +45,8 @@ struct Player_Traits<Player_Type::OPL3>
     static const char *chip_name() { return "YMF262"; }
 
     static constexpr unsigned channels_per_chip = 23;
+    // 14.31818 MHz / 288
+    static constexpr unsigned native_sample_rate = 49716;
 
     static const double output_gain;
 
@@ -76,6 +78,14 @@ struct Player_Traits<Player_Type::OPL3>
     static constexpr auto &rt_bank_change_msb = adl_rt_bankChangeMSB;
     static constexpr auto &rt_bank_change_lsb = adl_rt_bankChangeLSB;
     static constexpr auto &rt_system_exclusive = adl_rt_systemExclusive;
+
+    typedef ADL_Bank bank;
+    typedef ADL_BankId bank_id;
+    typedef ADL_Instrument instrument;
+    static constexpr int bank_create = ADLMIDI_Bank_Create;
+    static constexpr auto &get_bank = adl_getBank;
+    static constexpr auto &get_instrument = adl_getInstrument;
+    static constexpr auto &set_instrument = adl_setInstrument;
 };
 
 #include <opnmidi.h>
@@ -95,6 +105,8 @@ struct Player_Traits<Player_Type::OPN2>
     static const char *chip_name() { return "YM2612"; }
 
     static constexpr unsigned channels_per_chip = 6;
+    // 7.670453 MHz / 144
+    static constexpr unsigned native_sample_rate = 53267;
 
     static constexpr double output_gain = 1.0;
 
@@ -126,4 +138,12 @@ struct Player_Traits<Player_Type::OPN2>
     static constexpr auto &rt_bank_change_msb = opn2_rt_bankChangeMSB;
     static constexpr auto &rt_bank_change_lsb = opn2_rt_bankChangeLSB;
     static constexpr auto &rt_system_exclusive = opn2_rt_systemExclusive;
+
+    typedef OPN2_Bank bank;
+    typedef OPN2_BankId bank_id;
+    typedef OPN2_Instrument instrument;
+    static constexpr int bank_create = OPNMIDI_Bank_Create;
+    static constexpr auto &get_bank = opn2_getBank;
+    static constexpr auto &get_instrument = opn2_getInstrument;
+    static constexpr auto &set_instrument = opn2_setInstrument;
 };
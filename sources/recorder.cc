@@ -0,0 +1,357 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "recorder.h"
+#include "common.h"
+#include <ring_buffer/ring_buffer.h>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+namespace stc = std::chrono;
+
+Recorder recorder;
+
+// capacity of the FIFO, about 5 seconds at 48 kHz
+static constexpr size_t record_fifo_size = 2 * 1024 * 1024;
+// size of the writes to the file, and their alignment in memory
+static constexpr size_t record_write_size = 64 * 1024;
+static constexpr size_t record_write_align = 4096;
+// frames interleaved at once by the audio thread
+static constexpr unsigned record_block_frames = 256;
+static constexpr unsigned record_channels = 2;
+static constexpr unsigned record_frame_size = record_channels * sizeof(float);
+
+// the WAV sizes are 32-bit
+static constexpr uint64_t wav_size_max = 0xffffffffu - 4096;
+
+Record_Format record_format_by_name(const char *name, Record_Format def)
+{
+    if (!strcmp(name, "wav"))
+        return Record_Format::WAV;
+    if (!strcmp(name, "w64"))
+        return Record_Format::W64;
+    return def;
+}
+
+const char *record_format_name(Record_Format format)
+{
+    switch (format) {
+    default:
+    case Record_Format::WAV: return "wav";
+    case Record_Format::W64: return "w64";
+    }
+}
+
+const char *record_format_extension(Record_Format format)
+{
+    switch (format) {
+    default:
+    case Record_Format::WAV: return ".wav";
+    case Record_Format::W64: return ".w64";
+    }
+}
+
+struct Recorder::Impl
+{
+    std::atomic<bool> active_{false};
+    std::unique_ptr<Ring_Buffer> fifo_;
+    std::atomic<unsigned long> overruns_{0};
+    std::atomic<uint64_t> frames_written_{0};
+    //
+    std::string path_;
+    unsigned sample_rate_ = 0;
+    Record_Format format_ = Record_Format::WAV;
+    uint64_t max_size_ = 0;
+    std::thread thread_;
+    std::atomic<bool> quit_{false};
+    //
+    mutable std::mutex file_mutex_;
+    std::string file_name_;
+    FILE_u file_;
+    unsigned file_index_ = 0;
+    uint64_t file_data_size_ = 0;
+    std::unique_ptr<uint8_t[]> write_memory_;
+    uint8_t *write_buffer_ = nullptr;
+    size_t write_fill_ = 0;
+    //
+    void run();
+    bool open_file();
+    void close_file();
+    bool flush_buffer();
+    void write_header(uint64_t data_size);
+};
+
+Recorder::Recorder()
+    : P(new Impl)
+{
+}
+
+Recorder::~Recorder()
+{
+    stop();
+}
+
+bool Recorder::start(const std::string &path, unsigned sample_rate, Record_Format format, uint64_t max_size)
+{
+    stop();
+
+    if (!P->fifo_)
+        P->fifo_.reset(new Ring_Buffer(record_fifo_size));
+    if (!P->write_memory_) {
+        P->write_memory_.reset(new uint8_t[record_write_size + record_write_align]);
+        uintptr_t address = (uintptr_t)P->write_memory_.get();
+        address = (address + record_write_align - 1) & ~(uintptr_t)(record_write_align - 1);
+        P->write_buffer_ = (uint8_t *)address;
+    }
+
+    // anything which the audio thread put after the last stop
+    Ring_Buffer &fifo = *P->fifo_;
+    fifo.discard(fifo.size_used());
+
+    P->path_ = path;
+    P->sample_rate_ = sample_rate;
+    P->format_ = format;
+    P->max_size_ = max_size;
+    P->file_index_ = 0;
+    P->write_fill_ = 0;
+    P->overruns_.store(0);
+    P->frames_written_.store(0);
+
+    if (!P->open_file())
+        return false;
+
+    P->quit_.store(false);
+    P->thread_ = std::thread([this]() { P->run(); });
+    P->active_.store(true, std::memory_order_release);
+    return true;
+}
+
+void Recorder::stop()
+{
+    if (!P->thread_.joinable())
+        return;
+
+    P->active_.store(false, std::memory_order_release);
+    P->quit_.store(true);
+    P->thread_.join();
+
+    P->close_file();
+
+    unsigned long overruns = P->overruns_.load();
+    if (overruns > 0)
+        debug_printf("Recording lost %lu blocks for lack of room in the FIFO.\n", overruns);
+}
+
+bool Recorder::active() const
+{
+    return P->active_.load(std::memory_order_acquire);
+}
+
+void Recorder::write(const float *left, const float *right, unsigned nframes, unsigned stride)
+{
+    if (!P->active_.load(std::memory_order_acquire))
+        return;
+
+    Ring_Buffer &fifo = *P->fifo_;
+    float block[record_channels * record_block_frames];
+
+    for (unsigned i = 0; i < nframes;) {
+        unsigned count = std::min(nframes - i, record_block_frames);
+        for (unsigned j = 0; j < count; ++j) {
+            block[2 * j] = left[(i + j) * stride];
+            block[2 * j + 1] = right[(i + j) * stride];
+        }
+        if (!fifo.put(block, record_channels * count))
+            P->overruns_.fetch_add(1, std::memory_order_relaxed);
+        i += count;
+    }
+}
+
+std::string Recorder::current_file() const
+{
+    std::lock_guard<std::mutex> lock(P->file_mutex_);
+    return P->file_name_;
+}
+
+double Recorder::seconds_written() const
+{
+    unsigned sample_rate = P->sample_rate_;
+    return sample_rate ? ((double)P->frames_written_.load() / sample_rate) : 0.0;
+}
+
+unsigned long Recorder::overrun_count() const
+{
+    return P->overruns_.load(std::memory_order_relaxed);
+}
+
+void Recorder::Impl::run()
+{
+    Ring_Buffer &fifo = *fifo_;
+
+    for (bool quit = false; !quit;) {
+        quit = quit_.load();
+
+        // fill the write buffer, writing it out each time it is full
+        size_t avail = fifo.size_used();
+        avail -= avail % record_frame_size;
+        while (avail > 0) {
+            size_t count = std::min(avail, record_write_size - write_fill_);
+            fifo.get(write_buffer_ + write_fill_, count);
+            write_fill_ += count;
+            avail -= count;
+            frames_written_.fetch_add(count / record_frame_size);
+            if (write_fill_ == record_write_size && !flush_buffer()) {
+                active_.store(false, std::memory_order_release);
+                return;
+            }
+        }
+
+        if (!quit)
+            std::this_thread::sleep_for(stc::milliseconds(20));
+    }
+
+    flush_buffer();
+}
+
+bool Recorder::Impl::open_file()
+{
+    std::string name = path_;
+    if (file_index_ > 0) {
+        char suffix[16];
+        sprintf(suffix, "-%03u", file_index_ + 1);
+        name += suffix;
+    }
+    name += record_format_extension(format_);
+
+    FILE_u file(fopen(name.c_str(), "wb"));
+    if (!file) {
+        debug_printf("Cannot open the recording file '%s'.\n", name.c_str());
+        return false;
+    }
+    setvbuf(file.get(), nullptr, _IONBF, 0);
+
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    file_ = std::move(file);
+    file_name_ = name;
+    file_data_size_ = 0;
+    write_header(0);
+    return true;
+}
+
+void Recorder::Impl::close_file()
+{
+    if (!file_)
+        return;
+    write_header(file_data_size_);
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    file_.reset();
+}
+
+bool Recorder::Impl::flush_buffer()
+{
+    if (write_fill_ == 0)
+        return true;
+
+    uint64_t limit = max_size_;
+    if (format_ == Record_Format::WAV && (limit == 0 || limit > wav_size_max))
+        limit = wav_size_max;
+
+    // continue in the next file when this one is full
+    if (limit > 0 && file_data_size_ > 0 && file_data_size_ + write_fill_ > limit) {
+        close_file();
+        ++file_index_;
+        if (!open_file())
+            return false;
+    }
+
+    if (fwrite(write_buffer_, 1, write_fill_, file_.get()) != write_fill_) {
+        debug_printf("Write error on the recording file '%s'.\n", file_name_.c_str());
+        return false;
+    }
+    file_data_size_ += write_fill_;
+    write_fill_ = 0;
+    return true;
+}
+
+static void put_u16(uint8_t *p, uint16_t x)
+{
+    p[0] = x & 0xff;
+    p[1] = x >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t x)
+{
+    put_u16(p, x & 0xffff);
+    put_u16(p + 2, x >> 16);
+}
+
+static void put_u64(uint8_t *p, uint64_t x)
+{
+    put_u32(p, x & 0xffffffff);
+    put_u32(p + 4, x >> 32);
+}
+
+// WAVEFORMATEX of 32-bit float stereo
+static void put_wave_format(uint8_t *p, unsigned sample_rate)
+{
+    put_u16(p, 3);  // WAVE_FORMAT_IEEE_FLOAT
+    put_u16(p + 2, record_channels);
+    put_u32(p + 4, sample_rate);
+    put_u32(p + 8, sample_rate * record_frame_size);
+    put_u16(p + 12, record_frame_size);
+    put_u16(p + 14, 32);
+}
+
+bool write_record_header(FILE *stream, Record_Format format, unsigned sample_rate, uint64_t data_size)
+{
+    uint8_t header[128] = {};
+    size_t size;
+
+    if (format == Record_Format::WAV) {
+        size = 58;
+        memcpy(header, "RIFF", 4);
+        put_u32(header + 4, (uint32_t)(size - 8 + data_size));
+        memcpy(header + 8, "WAVE", 4);
+        memcpy(header + 12, "fmt ", 4);
+        put_u32(header + 16, 18);
+        put_wave_format(header + 20, sample_rate);
+        put_u16(header + 36, 0);  // cbSize
+        memcpy(header + 38, "fact", 4);
+        put_u32(header + 42, 4);
+        put_u32(header + 46, (uint32_t)(data_size / record_frame_size));
+        memcpy(header + 50, "data", 4);
+        put_u32(header + 54, (uint32_t)data_size);
+    }
+    else {
+        static const uint8_t guid_riff[16] = {'r','i','f','f', 0x2e,0x91,0xcf,0x11,0xa5,0xd6,0x28,0xdb,0x04,0xc1,0x00,0x00};
+        static const uint8_t guid_wave[16] = {'w','a','v','e', 0xf3,0xac,0xd3,0x11,0x8c,0xd1,0x00,0xc0,0x4f,0x8e,0xdb,0x8a};
+        static const uint8_t guid_fmt[16] = {'f','m','t',' ', 0xf3,0xac,0xd3,0x11,0x8c,0xd1,0x00,0xc0,0x4f,0x8e,0xdb,0x8a};
+        static const uint8_t guid_data[16] = {'d','a','t','a', 0xf3,0xac,0xd3,0x11,0x8c,0xd1,0x00,0xc0,0x4f,0x8e,0xdb,0x8a};
+        // the chunk sizes count their 24-byte headers
+        size = 104;
+        memcpy(header, guid_riff, 16);
+        put_u64(header + 16, size + data_size);
+        memcpy(header + 24, guid_wave, 16);
+        memcpy(header + 40, guid_fmt, 16);
+        put_u64(header + 56, 24 + 16);
+        put_wave_format(header + 64, sample_rate);
+        memcpy(header + 80, guid_data, 16);
+        put_u64(header + 96, 24 + data_size);
+    }
+
+    return fwrite(header, 1, size, stream) == size;
+}
+
+void Recorder::Impl::write_header(uint64_t data_size)
+{
+    FILE *stream = file_.get();
+    fseeko(stream, 0, SEEK_SET);
+    write_record_header(stream, format_, sample_rate_, data_size);
+    fseeko(stream, 0, SEEK_END);
+}
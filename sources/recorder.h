@@ -0,0 +1,55 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <memory>
+#include <stdio.h>
+#include <stdint.h>
+
+enum class Record_Format {
+    WAV,
+    // Sony Wave64, without the 4 GiB limit
+    W64,
+};
+
+Record_Format record_format_by_name(const char *name, Record_Format def);
+const char *record_format_name(Record_Format format);
+const char *record_format_extension(Record_Format format);
+// writes the header of a file of 32-bit float stereo, at the current position
+bool write_record_header(FILE *stream, Record_Format format, unsigned sample_rate, uint64_t data_size);
+
+// Capture of the output into files of 32-bit float samples. The audio thread
+// copies its blocks into a FIFO allocated in advance, and a writer thread
+// streams them to disk in large writes. When a file reaches its maximum
+// size, the recording continues in a new file with a numbered name.
+class Recorder {
+public:
+    Recorder();
+    ~Recorder();
+
+    // opens the file and starts the writer; max_size is in bytes, 0 for the
+    // limit of the format
+    bool start(const std::string &path, unsigned sample_rate, Record_Format format, uint64_t max_size);
+    // writes out what is left, and closes the file
+    void stop();
+    bool active() const;
+
+    // from the audio thread, never blocking nor allocating; the blocks which
+    // do not fit in the FIFO are dropped and counted
+    void write(const float *left, const float *right, unsigned nframes, unsigned stride);
+
+    // the file being written, and the duration recorded overall
+    std::string current_file() const;
+    double seconds_written() const;
+    // count of the blocks dropped
+    unsigned long overrun_count() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+extern Recorder recorder;
@@ -0,0 +1,554 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Journal replay: renders a journal of the input offline through the engine,
+// and reports the timing of the blocks and a hash of the audio
+
+#include "journal.h"
+#include "recorder.h"
+#include "i18n.h"
+#include "common.h"
+#include "bank_cache.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+namespace stc = std::chrono;
+
+std::string get_program_title()
+{
+    return "ADLreplay";
+}
+
+static void usage()
+{
+    fprintf(stderr, "Usage:\n    adlreplay [-o output.wav|output.w64] [-r reference.wav [-t tolerance]]\n"
+                    "              [-p player] [-e emulator] [-B block-size] [-q] journal\n");
+}
+
+static bool read_controls(const char *path, std::vector<Journal_Record> &controls)
+{
+    Journal_Reader reader;
+    if (!reader.open(path)) {
+        fprintf(stderr, "Cannot read the journal '%s': %s.\n", path, reader.error().c_str());
+        return false;
+    }
+
+    Journal_Record record;
+    while (reader.next(record)) {
+        if (record.type == Journal_Record::Control)
+            controls.push_back(record);
+        else if (record.type == Journal_Record::End && record.lost)
+            fprintf(stderr, "The journal is incomplete, the replay stops where records were lost.\n");
+    }
+    if (!reader.error().empty()) {
+        fprintf(stderr, "Error in the journal '%s': %s.\n", path, reader.error().c_str());
+        return false;
+    }
+
+    // in order of the changes which they follow
+    std::stable_sort(
+        controls.begin(), controls.end(),
+        [](const Journal_Record &a, const Journal_Record &b) -> bool { return a.serial < b.serial; });
+    return true;
+}
+
+// gives the settings of the journal to the engine, by a configuration file
+static bool write_settings(const std::string &path, const Journal_Settings &settings)
+{
+    FILE_u stream(fopen(path.c_str(), "w"));
+    if (!stream)
+        return false;
+    fprintf(stream.get(), "[synth]\n");
+    for (const std::pair<std::string, std::string> &setting : settings)
+        fprintf(stream.get(), "%s=%s\n", setting.first.c_str(), setting.second.c_str());
+    fprintf(stream.get(), "log-output=stderr\n");
+    fprintf(stream.get(), "lock-memory=none\n");
+    return fflush(stream.get()) == 0;
+}
+
+static const char *setting_value(const Journal_Settings &settings, const char *key, const char *def)
+{
+    for (const std::pair<std::string, std::string> &setting : settings) {
+        if (setting.first == key)
+            return setting.second.c_str();
+    }
+    return def;
+}
+
+// the bank of a control, as it was when journaled; null if there was none
+static Bank_Image_Ptr unpack_bank(const Journal_Record &record, std::string &path)
+{
+    std::vector<uint8_t> data;
+    if (!journal_unpack_bank(record.data, path, data) || data.empty())
+        return nullptr;
+    std::shared_ptr<Bank_Image> image(new Bank_Image);
+    image->path = path;
+    image->size = data.size();
+    image->data = std::move(data);
+    return image;
+}
+
+static bool apply_control(const Journal_Record &record)
+{
+    Player &player = active_player();
+
+    switch (record.control) {
+    case Journal_Control::Emulator:
+        dynamic_switch_emulator_id(record.value);
+        break;
+    case Journal_Control::Chip_Count:
+        player.dynamic_set_chip_count(record.value, ::midi_tracking);
+        break;
+    case Journal_Control::Load_Bank: {
+        std::string path;
+        Bank_Image_Ptr image = unpack_bank(record, path);
+        if (!image || !player.dynamic_load_bank(image)) {
+            fprintf(stderr, "Cannot load the bank '%s' of the journal.\n", path.c_str());
+            return false;
+        }
+        active_bank_file() = path;
+        break;
+    }
+    case Journal_Control::Update_Bank: {
+        // without a bank, the update had nothing to replace
+        std::string path;
+        Bank_Image_Ptr image = unpack_bank(record, path);
+        if (image && !player.dynamic_update_bank(image)) {
+            fprintf(stderr, "Cannot update the bank '%s' of the journal.\n", path.c_str());
+            return false;
+        }
+        break;
+    }
+    case Journal_Control::Embedded_Bank: {
+        std::string path;
+        Bank_Image_Ptr image = unpack_bank(record, path);
+        ::player_opl_embedded_bank_id = record.value;
+        if (record.value >= 0)
+            player.dynamic_set_embedded_bank(path.c_str(), record.value);
+        else if (image && !player.dynamic_load_bank(image)) {
+            fprintf(stderr, "Cannot load the bank '%s' of the journal.\n", path.c_str());
+            return false;
+        }
+        break;
+    }
+    case Journal_Control::Panic:
+        player.dynamic_panic();
+        break;
+    case Journal_Control::Channel_Alloc:
+        player.dynamic_set_channel_alloc(record.value);
+        break;
+    case Journal_Control::Instrument: {
+        Bank_Instrument_Id id;
+        journal_unpack_instrument(record.value, id.percussive, id.msb, id.lsb, id.program);
+        player.dynamic_set_instrument(id, record.data.data(), record.data.size());
+        break;
+    }
+    case Journal_Control::Sample_Rate:
+        notify_sample_rate_change(record.value);
+        handle_sample_rate_change();
+        fprintf(stderr, "The sample rate changes to %u Hz, the output keeps the first rate.\n",
+                (unsigned)record.value);
+        break;
+    }
+    return true;
+}
+
+// the bank files of the start, which the journal identifies by their hash
+static bool check_bank_files(const Journal_Settings &settings)
+{
+    for (unsigned i = 0; i < player_type_count; ++i) {
+        std::string index = std::to_string(i);
+        std::string hash = setting_value(settings, ("bankhash-" + index).c_str(), "");
+        if (hash.empty())
+            continue;
+        std::string path = setting_value(settings, ("bankfile-" + index).c_str(), "");
+        Bank_Image_Ptr image = ::bank_cache.load(path.c_str());
+        if (journal_bank_hash(image.get()) != hash) {
+            fprintf(stderr, "The bank file '%s' differs from the one of the journal.\n", path.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// finds the samples of a 32-bit float stereo file, as written by the replay
+static bool open_reference(FILE *stream, uint64_t &data_size)
+{
+    uint8_t header[40];
+    if (fread(header, 1, 12, stream) != 12)
+        return false;
+
+    auto get_u16 = [](const uint8_t *p) -> unsigned { return p[0] | (p[1] << 8); };
+    auto get_u32 = [](const uint8_t *p) -> uint32_t { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); };
+    auto get_u64 = [&](const uint8_t *p) -> uint64_t { return get_u32(p) | ((uint64_t)get_u32(p + 4) << 32); };
+    auto check_format = [&](const uint8_t *p) -> bool { return get_u16(p) == 3 && get_u16(p + 2) == 2 && get_u16(p + 14) == 32; };
+
+    bool w64 = !memcmp(header, "riff", 4);
+    if (!w64 && (memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)))
+        return false;
+    if (w64 && fread(header + 12, 1, 28, stream) != 28)
+        return false;
+
+    size_t header_size = w64 ? 24 : 8;
+    bool have_format = false;
+    while (fread(header, 1, header_size, stream) == header_size) {
+        uint64_t size = w64 ? (get_u64(header + 16) - 24) : get_u32(header + 4);
+        uint64_t padded = w64 ? ((size + 7) & ~(uint64_t)7) : (size + (size & 1));
+        if (!memcmp(header, "data", 4)) {
+            data_size = size;
+            return have_format;
+        }
+        if (!memcmp(header, "fmt ", 4) && size >= 16) {
+            uint8_t format[16];
+            if (fread(format, 1, 16, stream) != 16)
+                return false;
+            have_format = check_format(format);
+            padded -= 16;
+        }
+        if (fseeko(stream, padded, SEEK_CUR) != 0)
+            return false;
+    }
+    return false;
+}
+
+struct Output_Sink {
+    // FNV-1a of the bits of the samples
+    uint64_t hash = 0xcbf29ce484222325u;
+    uint64_t frames = 0;
+    //
+    FILE_u file;
+    Record_Format format = Record_Format::WAV;
+    uint64_t data_size = 0;
+    //
+    FILE_u reference;
+    uint64_t reference_left = 0;
+    double max_difference = 0;
+    uint64_t first_difference = (uint64_t)-1;
+    bool reference_short = false;
+
+    bool write(const float *samples, unsigned nframes);
+};
+
+bool Output_Sink::write(const float *samples, unsigned nframes)
+{
+    const uint8_t *data = (const uint8_t *)samples;
+    size_t size = 2 * nframes * sizeof(float);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3u;
+    }
+
+    if (file) {
+        if (fwrite(samples, 1, size, file.get()) != size)
+            return false;
+        data_size += size;
+    }
+
+    if (reference) {
+        float other[2];
+        for (unsigned i = 0; i < nframes && !reference_short; ++i) {
+            if (reference_left < sizeof(other) || fread(other, 1, sizeof(other), reference.get()) != sizeof(other)) {
+                reference_short = true;
+                break;
+            }
+            reference_left -= sizeof(other);
+            for (unsigned c = 0; c < 2; ++c) {
+                double difference = std::fabs((double)samples[2 * i + c] - other[c]);
+                if (difference > 0 && first_difference == (uint64_t)-1)
+                    first_difference = frames + i;
+                max_difference = std::max(max_difference, difference);
+            }
+        }
+    }
+
+    frames += nframes;
+    return true;
+}
+
+struct Render_Stats {
+    std::vector<double> block_loads;
+    double render_time = 0;
+    double max_load = 0;
+    uint64_t max_load_frame = 0;
+    uint64_t silent_frames = 0;
+};
+
+// renders in blocks of the given size at most, or of the whole count if 0
+static bool render(unsigned nframes, unsigned block_size, unsigned sample_rate, Output_Sink &sink, Render_Stats &stats)
+{
+    static std::vector<float> left, right, interleaved;
+
+    for (unsigned i = 0; i < nframes;) {
+        unsigned count = block_size ? std::min(block_size, nframes - i) : nframes;
+        left.resize(count);
+        right.resize(count);
+
+        stc::steady_clock::time_point t1 = stc::steady_clock::now();
+        generate_outputs(left.data(), right.data(), count, 1);
+        stc::steady_clock::time_point t2 = stc::steady_clock::now();
+
+        double d = stc::duration<double>(t2 - t1).count();
+        double load = d / ((double)count / sample_rate);
+        stats.render_time += d;
+        stats.block_loads.push_back(load);
+        if (load > stats.max_load) {
+            stats.max_load = load;
+            stats.max_load_frame = sink.frames;
+        }
+
+        interleaved.resize(2 * count);
+        for (unsigned j = 0; j < count; ++j) {
+            interleaved[2 * j] = left[j];
+            interleaved[2 * j + 1] = right[j];
+        }
+        if (!sink.write(interleaved.data(), count))
+            return false;
+        i += count;
+    }
+    return true;
+}
+
+static bool render_silence(unsigned nframes, Output_Sink &sink, Render_Stats &stats)
+{
+    std::vector<float> silence(2 * nframes, 0.0f);
+    stats.silent_frames += nframes;
+    return sink.write(silence.data(), nframes);
+}
+
+int main(int argc, char *argv[])
+{
+    i18n_setup();
+
+    const char *output_path = nullptr;
+    const char *reference_path = nullptr;
+    double tolerance = 0;
+    Player_Type player_override = Player_Type::INVALID;
+    int emulator_override = -1;
+    unsigned block_size = 0;
+    bool quiet = false;
+
+    for (int c; (c = getopt(argc, argv, "ho:r:t:p:e:B:q")) != -1;) {
+        switch (c) {
+        case 'o':
+            output_path = optarg;
+            break;
+        case 'r':
+            reference_path = optarg;
+            break;
+        case 't':
+            tolerance = std::atof(optarg);
+            break;
+        case 'p':
+            player_override = Player::type_by_name(optarg);
+            if (player_override == Player_Type::INVALID) {
+                fprintf(stderr, "Invalid player name.\n");
+                return 1;
+            }
+            break;
+        case 'e':
+            emulator_override = std::atoi(optarg);
+            break;
+        case 'B':
+            block_size = std::atoi(optarg);
+            break;
+        case 'q':
+            quiet = true;
+            break;
+        case 'h':
+            usage();
+            return 0;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    if (argc - optind != 1) {
+        usage();
+        return 1;
+    }
+
+    const char *journal_path = argv[optind];
+    std::vector<Journal_Record> controls;
+    if (!read_controls(journal_path, controls))
+        return 1;
+
+    Journal_Reader reader;
+    if (!reader.open(journal_path)) {
+        fprintf(stderr, "Cannot read the journal '%s': %s.\n", journal_path, reader.error().c_str());
+        return 1;
+    }
+
+    Journal_Settings settings = reader.settings();
+    if (player_override != Player_Type::INVALID || emulator_override != -1) {
+        for (std::pair<std::string, std::string> &setting : settings) {
+            if (setting.first == "pt" && player_override != Player_Type::INVALID)
+                setting.second = std::to_string((unsigned)player_override);
+            else if (setting.first == "emulator" && emulator_override != -1)
+                setting.second = std::to_string(emulator_override);
+        }
+        // the emulator is fixed, the switches are for the original setup
+        controls.erase(
+            std::remove_if(
+                controls.begin(), controls.end(),
+                [](const Journal_Record &r) -> bool { return r.control == Journal_Control::Emulator; }),
+            controls.end());
+    }
+
+    std::string settings_path = cache_file_path("replay.ini");
+    if (settings_path.empty() || !write_settings(settings_path, settings)) {
+        fprintf(stderr, "Cannot write the settings of the replay.\n");
+        return 1;
+    }
+    ::arg_config_file = settings_path;
+    load_config();
+
+    unsigned sample_rate = reader.sample_rate();
+    Player_Type pt = (Player_Type)std::atoi(setting_value(settings, "pt", "0"));
+    unsigned nchip = std::atoi(setting_value(settings, "nchip", "1"));
+    unsigned emulator = std::atoi(setting_value(settings, "emulator", "0"));
+    if (!check_bank_files(settings) ||
+        !initialize_player(pt, sample_rate, nchip, nullptr, emulator, quiet))
+        return 1;
+    // the locks are always taken, as by the real time thread when it could
+    set_bulk_mode(true);
+
+    Output_Sink sink;
+    if (output_path) {
+        const char *ext = strrchr(output_path, '.');
+        if (ext && !strcmp(ext, record_format_extension(Record_Format::W64)))
+            sink.format = Record_Format::W64;
+        sink.file.reset(fopen(output_path, "wb"));
+        if (!sink.file || !write_record_header(sink.file.get(), sink.format, sample_rate, 0)) {
+            fprintf(stderr, "Cannot write the output file '%s'.\n", output_path);
+            return 1;
+        }
+    }
+    if (reference_path) {
+        sink.reference.reset(fopen(reference_path, "rb"));
+        if (!sink.reference || !open_reference(sink.reference.get(), sink.reference_left)) {
+            fprintf(stderr, "Cannot read the reference file '%s'.\n", reference_path);
+            return 1;
+        }
+    }
+
+    Render_Stats stats;
+    std::vector<Midi_Event> events;
+    size_t next_control = 0;
+    // with a block size, the blocks of the journal are joined up to the
+    // next event or change, then rendered in blocks of this size
+    unsigned pending_frames = 0;
+    int pending_volume = 0;
+    bool write_ok = true;
+    bool control_ok = true;
+
+    Journal_Record record;
+    while (write_ok && control_ok && reader.next(record)) {
+        if (pending_frames > 0 &&
+            (record.type != Journal_Record::Render || record.volume != pending_volume)) {
+            write_ok = render(pending_frames, block_size, sample_rate, sink, stats);
+            pending_frames = 0;
+        }
+
+        switch (record.type) {
+        default:
+            break;
+        case Journal_Record::Sync:
+            while (control_ok && next_control < controls.size() && controls[next_control].serial <= record.serial)
+                control_ok = apply_control(controls[next_control++]);
+            break;
+        case Journal_Record::Events: {
+            events.resize(record.sizes.size());
+            const uint8_t *data = record.data.data();
+            for (size_t i = 0; i < events.size(); ++i) {
+                Midi_Event &ev = events[i];
+                ev = Midi_Event();
+                ev.size = record.sizes[i];
+                ev.data = data;
+                data += ev.size;
+            }
+            play_midi_events(events.data(), events.size());
+            break;
+        }
+        case Journal_Record::Render:
+            ::player_volume = record.volume;
+            if (block_size == 0)
+                write_ok = render(record.nframes, 0, sample_rate, sink, stats);
+            else {
+                pending_frames += record.nframes;
+                pending_volume = record.volume;
+            }
+            break;
+        case Journal_Record::Silence:
+            write_ok = render_silence(record.nframes, sink, stats);
+            break;
+        }
+    }
+    if (!control_ok)
+        return 1;
+    if (write_ok && pending_frames > 0)
+        write_ok = render(pending_frames, block_size, sample_rate, sink, stats);
+
+    if (!write_ok) {
+        fprintf(stderr, "Cannot write the output file '%s'.\n", output_path);
+        return 1;
+    }
+    if (!reader.error().empty()) {
+        fprintf(stderr, "Error in the journal '%s': %s.\n", journal_path, reader.error().c_str());
+        return 1;
+    }
+
+    if (sink.file) {
+        fseeko(sink.file.get(), 0, SEEK_SET);
+        write_record_header(sink.file.get(), sink.format, sample_rate, sink.data_size);
+        sink.file.reset();
+    }
+
+    double duration = (double)sink.frames / sample_rate;
+    fprintf(stderr, "Replayed %.3f s of audio, %.3f s of it silent for the lock was busy\n",
+            duration, (double)stats.silent_frames / sample_rate);
+    std::vector<double> &block_loads = stats.block_loads;
+    if (!block_loads.empty()) {
+        double mean_load = 0;
+        unsigned overruns = 0;
+        for (double load : block_loads) {
+            mean_load += load;
+            overruns += load >= 1.0;
+        }
+        mean_load /= block_loads.size();
+        size_t p99 = (block_loads.size() - 1) * 99 / 100;
+        std::nth_element(block_loads.begin(), block_loads.begin() + p99, block_loads.end());
+        fprintf(stderr, "Rendering took %.3f s, %.1f times real time\n",
+                stats.render_time, (stats.render_time > 0) ? (duration / stats.render_time) : 0.0);
+        fprintf(stderr, "Block load: mean %.1f%%, 99th percentile %.1f%%, maximum %.1f%% at %.3f s\n",
+                100 * mean_load, 100 * block_loads[p99], 100 * stats.max_load,
+                (double)stats.max_load_frame / sample_rate);
+        fprintf(stderr, "Blocks over their real time budget: %u of %zu\n", overruns, block_loads.size());
+    }
+    printf("%016llx\n", (unsigned long long)sink.hash);
+
+    // the comparison fails on a difference above the tolerance, or on a
+    // difference of length
+    if (sink.reference) {
+        bool length_differs = sink.reference_short || sink.reference_left > 0;
+        if (length_differs)
+            fprintf(stderr, "The reference has a different length.\n");
+        if (sink.first_difference != (uint64_t)-1)
+            fprintf(stderr, "The output differs from the reference from %.6f s, by %g at most\n",
+                    (double)sink.first_difference / sample_rate, sink.max_difference);
+        else
+            fprintf(stderr, "The output is identical to the reference\n");
+        if (length_differs || sink.max_difference > tolerance)
+            return 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "resampler.h"
+#include <algorithm>
+#include <string.h>
+#include <math.h>
+
+// width of the vector operations of the filter loop
+static constexpr unsigned lanes = 8;
+
+struct Resampler_Preset {
+    const char *name;
+    unsigned taps;
+    unsigned phases;
+    double kaiser_beta;
+    double rolloff;  // fraction of the Nyquist frequency, at most, which passes
+};
+
+static const Resampler_Preset resampler_presets[] = {
+    {"low", 8, 64, 5.0, 0.80},
+    {"medium", 16, 128, 7.0, 0.88},
+    {"high", 32, 256, 9.0, 0.92},
+};
+
+Resampler_Quality resampler_quality_by_name(const char *name)
+{
+    for (unsigned i = 0; i < sizeof(resampler_presets) / sizeof(*resampler_presets); ++i) {
+        if (!strcmp(name, resampler_presets[i].name))
+            return (Resampler_Quality)i;
+    }
+    return Resampler_Quality::Medium;
+}
+
+const char *resampler_quality_name(Resampler_Quality q)
+{
+    return resampler_presets[(unsigned)q].name;
+}
+
+static double bessel_i0(double x)
+{
+    double sum = 1, term = 1;
+    for (unsigned k = 1; k < 50; ++k) {
+        double t = x / (2 * k);
+        term *= t * t;
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+    return sum;
+}
+
+Resampler::Resampler()
+{
+}
+
+Resampler::~Resampler()
+{
+}
+
+void Resampler::setup(double in_rate, double out_rate, Resampler_Quality q, unsigned max_out_frames)
+{
+    const Resampler_Preset &preset = resampler_presets[(unsigned)q];
+    unsigned taps = preset.taps;
+    unsigned phases = preset.phases;
+
+    in_rate_ = in_rate;
+    out_rate_ = out_rate;
+    step_ = in_rate / out_rate;
+    taps_ = taps;
+    phases_ = phases;
+    max_out_ = max_out_frames;
+
+    // cutoff relative to the input rate: the stop band of the window, by
+    // the estimate of Kaiser, starts at the lower Nyquist frequency
+    double nyquist = std::min(1.0, out_rate / in_rate);
+    double attenuation = preset.kaiser_beta / 0.1102 + 8.7;
+    double transition = (attenuation - 7.95) / (14.36 * taps);
+    double cutoff = std::min(preset.rolloff * nyquist, nyquist - transition);
+    double i0_beta = bessel_i0(preset.kaiser_beta);
+    double half = 0.5 * taps;
+
+    filters_.reset(new float[(phases + 1) * taps]);
+    for (unsigned p = 0; p <= phases; ++p) {
+        float *filter = &filters_[p * taps];
+        double sum = 0;
+        for (unsigned j = 0; j < taps; ++j) {
+            // distance of the tap to the interpolated point
+            double x = (half - 1) + (double)p / phases - j;
+            double sinc = (x == 0) ? 1.0 : sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+            double r = x / half;
+            double window = (r * r < 1) ? bessel_i0(preset.kaiser_beta * sqrt(1 - r * r)) / i0_beta : 0;
+            double h = sinc * window;
+            filter[j] = h;
+            sum += h;
+        }
+        // unity gain at DC for every phase
+        for (unsigned j = 0; j < taps; ++j)
+            filter[j] /= sum;
+    }
+
+    unsigned max_in = (unsigned)ceil(max_out_frames * step_) + taps + 2;
+    for (std::vector<float> &buffer : buffer_)
+        buffer.assign(max_in, 0.0f);
+
+    reset();
+}
+
+void Resampler::reset()
+{
+    // start with a silent history, so the output is aligned with the filter
+    fill_ = taps_ - 1;
+    position_ = 0;
+    for (std::vector<float> &buffer : buffer_)
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+}
+
+double Resampler::latency() const
+{
+    return (0.5 * taps_) / step_;
+}
+
+unsigned Resampler::input_needed(unsigned nframes) const
+{
+    if (nframes == 0)
+        return 0;
+    size_t last = (size_t)(position_ + (nframes - 1) * step_);
+    size_t required = last + taps_;
+    return (required > fill_) ? (unsigned)(required - fill_) : 0;
+}
+
+float *Resampler::input_buffer(unsigned channel)
+{
+    return buffer_[channel].data() + fill_;
+}
+
+void Resampler::process(unsigned nframes_in, float *left, float *right, unsigned nframes_out, unsigned stride)
+{
+    fill_ += nframes_in;
+
+    process_channel(buffer_[0].data(), left, nframes_out, stride);
+    process_channel(buffer_[1].data(), right, nframes_out, stride);
+
+    // drop the input which is not needed anymore
+    double position = position_ + nframes_out * step_;
+    unsigned consumed = std::min((unsigned)position, fill_);
+    for (std::vector<float> &buffer : buffer_)
+        std::copy(buffer.begin() + consumed, buffer.begin() + fill_, buffer.begin());
+    fill_ -= consumed;
+    position_ = position - consumed;
+}
+
+void Resampler::process_channel(const float *in, float *out, unsigned nframes, unsigned stride) const
+{
+    const unsigned taps = taps_;
+    const unsigned phases = phases_;
+    const float *filters = filters_.get();
+    double position = position_;
+    const double step = step_;
+
+    for (unsigned i = 0; i < nframes; ++i, position += step) {
+        size_t index = (size_t)position;
+        double fphase = (position - index) * phases;
+        unsigned phase = (unsigned)fphase;
+        float mu = (float)(fphase - phase);
+
+        const float *x = in + index;
+        const float *h0 = filters + phase * taps;
+        const float *h1 = h0 + taps;
+
+        // independent partial sums, so the compiler can vectorize without
+        // reassociating; the tap counts are multiples of the lane count
+        float acc0[lanes] = {}, acc1[lanes] = {};
+        for (unsigned j = 0; j < taps; j += lanes) {
+            for (unsigned k = 0; k < lanes; ++k) {
+                acc0[k] += x[j + k] * h0[j + k];
+                acc1[k] += x[j + k] * h1[j + k];
+            }
+        }
+        float y0 = 0, y1 = 0;
+        for (unsigned k = 0; k < lanes; ++k) {
+            y0 += acc0[k];
+            y1 += acc1[k];
+        }
+        out[i * stride] = y0 + mu * (y1 - y0);
+    }
+}
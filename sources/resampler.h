@@ -0,0 +1,68 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <vector>
+#include <memory>
+
+enum class Resampler_Quality {
+    Low,
+    Medium,
+    High,
+};
+
+Resampler_Quality resampler_quality_by_name(const char *name);
+const char *resampler_quality_name(Resampler_Quality q);
+
+// Stereo polyphase resampler, with windowed sinc filters interpolated
+// between neighbouring phases. The source is pulled in by blocks: the caller
+// renders input_needed() frames into the input buffers, then processes.
+class Resampler {
+public:
+    Resampler();
+    ~Resampler();
+
+    // allocates everything, so the other calls can be made in real time
+    void setup(double in_rate, double out_rate, Resampler_Quality q, unsigned max_out_frames);
+    void reset();
+
+    double in_rate() const { return in_rate_; }
+    double out_rate() const { return out_rate_; }
+    // delay of the filter, in output frames
+    double latency() const;
+
+    // the count of input frames to provide for the next nframes outputs,
+    // at most the size of the input buffers
+    unsigned input_needed(unsigned nframes) const;
+    float *input_buffer(unsigned channel);
+    // takes the input frames written in the buffers, and produces the output
+    void process(unsigned nframes_in, float *left, float *right, unsigned nframes_out, unsigned stride);
+
+    unsigned max_out_frames() const { return max_out_; }
+
+    // calls fn(data, size) on each of the buffers, for memory locking
+    template <class Fn> void for_each_buffer(Fn fn) const
+    {
+        fn(filters_.get(), (size_t)(phases_ + 1) * taps_ * sizeof(float));
+        for (const std::vector<float> &buffer : buffer_)
+            fn(buffer.data(), buffer.size() * sizeof(float));
+    }
+
+private:
+    void process_channel(const float *in, float *out, unsigned nframes, unsigned stride) const;
+
+    double in_rate_ = 0;
+    double out_rate_ = 0;
+    double step_ = 1;
+    unsigned taps_ = 0;
+    unsigned phases_ = 0;
+    unsigned max_out_ = 0;
+    // (phases + 1) filters of taps coefficients
+    std::unique_ptr<float[]> filters_;
+    // history followed by the new input, per channel
+    std::vector<float> buffer_[2];
+    unsigned fill_ = 0;
+    double position_ = 0;
+};
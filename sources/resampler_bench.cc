@@ -0,0 +1,133 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the cost and the quality of the resampler at each setting,
+// for the rate conversions of the chip native rates.
+
+#include "resampler.h"
+#include <chrono>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+namespace stc = std::chrono;
+
+static constexpr unsigned block_size = 256;
+
+// resamples a sine of the given frequency, returns the left channel
+static std::vector<float> resample_sine(Resampler &rs, double freq, unsigned nframes)
+{
+    rs.reset();
+    std::vector<float> out(2 * nframes);
+    double phase = 0;
+    double dphase = 2 * M_PI * freq / rs.in_rate();
+    for (unsigned i = 0; i < nframes; i += block_size) {
+        unsigned n = std::min(block_size, nframes - i);
+        unsigned nin = rs.input_needed(n);
+        float *left = rs.input_buffer(0);
+        float *right = rs.input_buffer(1);
+        for (unsigned j = 0; j < nin; ++j, phase += dphase)
+            left[j] = right[j] = sin(phase);
+        rs.process(nin, &out[2 * i], &out[2 * i + 1], n, 2);
+    }
+    std::vector<float> left(nframes);
+    for (unsigned i = 0; i < nframes; ++i)
+        left[i] = out[2 * i];
+    return left;
+}
+
+// time to resample the given duration of noise, in nanoseconds per frame
+static double time_resampling(Resampler &rs, double seconds)
+{
+    rs.reset();
+    unsigned nframes = (unsigned)(seconds * rs.out_rate());
+    std::vector<float> noise(8192);
+    for (float &x : noise)
+        x = (float)rand() / RAND_MAX * 2 - 1;
+    std::vector<float> out(2 * block_size);
+
+    stc::steady_clock::time_point t1 = stc::steady_clock::now();
+    for (unsigned i = 0, k = 0; i < nframes; i += block_size) {
+        unsigned n = std::min(block_size, nframes - i);
+        unsigned nin = rs.input_needed(n);
+        float *left = rs.input_buffer(0);
+        float *right = rs.input_buffer(1);
+        for (unsigned j = 0; j < nin; ++j, k = (k + 1) % noise.size())
+            left[j] = right[j] = noise[k];
+        rs.process(nin, &out[0], &out[1], n, 2);
+    }
+    stc::steady_clock::time_point t2 = stc::steady_clock::now();
+    return stc::duration<double, std::nano>(t2 - t1).count() / nframes;
+}
+
+// amplitude in dB of a frequency of the signal, by the Goertzel algorithm,
+// after the filter has settled
+static double amplitude_db(const std::vector<float> &x, double freq, double rate)
+{
+    const unsigned skip = 1024;
+    unsigned n = x.size() - skip;
+    double w = 2 * M_PI * freq / rate;
+    double coeff = 2 * cos(w);
+    double s1 = 0, s2 = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        // Hann window, against the leak of the other frequencies
+        double win = 0.5 - 0.5 * cos(2 * M_PI * i / (n - 1));
+        double s0 = x[skip + i] * win + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    double power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+    double amplitude = 2 * sqrt(power) / (0.5 * n);
+    return 20 * log10(amplitude + 1e-20);
+}
+
+int main()
+{
+    struct Conversion { double in_rate, out_rate; };
+    const Conversion conversions[] = {
+        {49716, 44100}, {49716, 48000}, {49716, 96000}, {49716, 192000},
+        {53267, 44100}, {53267, 48000}, {53267, 96000}, {22050, 48000},
+    };
+    const Resampler_Quality qualities[] = {
+        Resampler_Quality::Low, Resampler_Quality::Medium, Resampler_Quality::High,
+    };
+
+    printf("%8s %8s %-7s %10s %9s %9s %9s\n",
+           "in", "out", "quality", "ns/frame", "1k dB", "15k dB", "alias dB");
+
+    const unsigned nframes = 32768;
+
+    for (const Conversion &conv : conversions) {
+        for (Resampler_Quality q : qualities) {
+            Resampler rs;
+            rs.setup(conv.in_rate, conv.out_rate, q, block_size);
+
+            double ns = time_resampling(rs, 10.0);
+
+            double pass1 = amplitude_db(resample_sine(rs, 1000, nframes), 1000, conv.out_rate);
+            double pass2 = amplitude_db(resample_sine(rs, 15000, nframes), 15000, conv.out_rate);
+
+            // a tone which should be rejected: near the input Nyquist
+            // frequency, folded below the output one when reducing the rate;
+            // its image above the input Nyquist frequency when increasing
+            double alias;
+            if (conv.out_rate < conv.in_rate) {
+                double f = 0.49 * conv.in_rate;
+                double folded = (f > 0.5 * conv.out_rate) ? conv.out_rate - f : f;
+                alias = amplitude_db(resample_sine(rs, f, nframes), folded, conv.out_rate);
+            }
+            else {
+                double f = 0.3 * conv.in_rate;
+                alias = amplitude_db(resample_sine(rs, f, nframes), conv.in_rate - f, conv.out_rate);
+            }
+
+            printf("%8.0f %8.0f %-7s %10.1f %9.2f %9.2f %9.1f\n",
+                   conv.in_rate, conv.out_rate, resampler_quality_name(q),
+                   ns, pass1, pass2, alias);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "rt_setup.h"
+#include "common.h"
+#include "i18n.h"
+#include <algorithm>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if !defined(_WIN32)
+#    include <pthread.h>
+#    include <sched.h>
+#    include <unistd.h>
+#endif
+#if defined(ADLJACK_HAVE_MLOCKALL)
+#    include <sys/mman.h>
+#endif
+namespace stc = std::chrono;
+
+static Rt_Settings rt_current_settings;
+static std::vector<unsigned> rt_audio_cpus;
+static std::vector<unsigned> rt_worker_cpus;
+
+// what was obtained, written by the threads which set themselves up
+static std::atomic<bool> rt_audio_ready{false};
+static std::atomic<int> rt_audio_policy{-1};
+static std::atomic<int> rt_audio_priority{0};
+static std::atomic<int> rt_priority_error{-1};
+static std::atomic<int> rt_affinity_error{-1};
+static std::atomic<int> rt_worker_affinity_error{-1};
+static std::atomic<size_t> rt_locked_bytes{0};
+static std::atomic<unsigned> rt_lock_failures{0};
+static std::atomic<int> rt_lock_error{0};
+static std::atomic<bool> rt_all_locked{false};
+
+// bytes of stack brought in for the audio thread
+static constexpr size_t rt_stack_prefault_size = 64 * 1024;
+
+Rt_Memory_Lock rt_memory_lock_by_name(const char *name, Rt_Memory_Lock def)
+{
+    if (!strcmp(name, "none"))
+        return Rt_Memory_Lock::None;
+    if (!strcmp(name, "engine"))
+        return Rt_Memory_Lock::Engine;
+    if (!strcmp(name, "all"))
+        return Rt_Memory_Lock::All;
+    return def;
+}
+
+const char *rt_memory_lock_name(Rt_Memory_Lock lock)
+{
+    switch (lock) {
+    default:
+    case Rt_Memory_Lock::None: return "none";
+    case Rt_Memory_Lock::Engine: return "engine";
+    case Rt_Memory_Lock::All: return "all";
+    }
+}
+
+// parses a list such as "0,2-3"
+static std::vector<unsigned> parse_cpu_list(const std::string &text)
+{
+    std::vector<unsigned> cpus;
+    const char *pos = text.c_str();
+    while (*pos) {
+        char *end;
+        unsigned first = strtoul(pos, &end, 10);
+        if (end == pos)
+            break;
+        unsigned last = first;
+        pos = end;
+        if (*pos == '-') {
+            last = strtoul(pos + 1, &end, 10);
+            if (end == pos + 1)
+                break;
+            pos = end;
+        }
+        for (unsigned cpu = first; cpu <= last && cpu < 1024; ++cpu)
+            cpus.push_back(cpu);
+        while (*pos == ',' || *pos == ' ')
+            ++pos;
+    }
+    return cpus;
+}
+
+void rt_configure(const Rt_Settings &settings)
+{
+    ::rt_current_settings = settings;
+    ::rt_audio_cpus = parse_cpu_list(settings.audio_cpus);
+    ::rt_worker_cpus = parse_cpu_list(settings.worker_cpus);
+}
+
+const Rt_Settings &rt_settings()
+{
+    return ::rt_current_settings;
+}
+
+// returns 0 or the error number
+static int set_thread_affinity(const std::vector<unsigned> &cpus)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned cpu : cpus) {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpus;
+    return ENOSYS;
+#endif
+}
+
+void rt_setup_audio_thread()
+{
+    static thread_local bool done = false;
+    if (done)
+        return;
+    done = true;
+
+#if !defined(_WIN32)
+    int policy;
+    sched_param param;
+    if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+        // the audio system may have done it already, as Jack does
+        int priority = ::rt_current_settings.priority;
+        if (priority > 0 && policy != SCHED_FIFO && policy != SCHED_RR) {
+            int min = sched_get_priority_min(SCHED_FIFO);
+            int max = sched_get_priority_max(SCHED_FIFO);
+            param.sched_priority = std::max(min, std::min(max, priority));
+            int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+            ::rt_priority_error.store(err);
+            if (err == 0)
+                policy = SCHED_FIFO;
+            else
+                pthread_getschedparam(pthread_self(), &policy, &param);
+        }
+        ::rt_audio_policy.store(policy);
+        ::rt_audio_priority.store(param.sched_priority);
+    }
+#endif
+
+    if (!::rt_audio_cpus.empty())
+        ::rt_affinity_error.store(set_thread_affinity(::rt_audio_cpus));
+
+    if (::rt_current_settings.memory_lock == Rt_Memory_Lock::Engine) {
+        volatile uint8_t stack[rt_stack_prefault_size];
+        for (size_t i = 0; i < rt_stack_prefault_size; i += 1024)
+            stack[i] = 0;
+        rt_lock_memory((const void *)stack, rt_stack_prefault_size);
+    }
+
+    ::rt_audio_ready.store(true);
+}
+
+void rt_setup_worker_thread()
+{
+    // keep off the CPUs of the audio thread
+    if (!::rt_worker_cpus.empty())
+        ::rt_worker_affinity_error.store(set_thread_affinity(::rt_worker_cpus));
+}
+
+bool rt_lock_memory(const void *data, size_t size)
+{
+    if (!data || size == 0)
+        return true;
+
+#if defined(ADLJACK_HAVE_MLOCKALL)
+    static const size_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (uintptr_t)data & ~(uintptr_t)(page_size - 1);
+    uintptr_t end = ((uintptr_t)data + size + page_size - 1) & ~(uintptr_t)(page_size - 1);
+
+    // mlock faults the pages in as well
+    if (mlock((const void *)begin, end - begin) == -1) {
+        ::rt_lock_error.store(errno);
+        ::rt_lock_failures.fetch_add(1);
+        return false;
+    }
+    ::rt_locked_bytes.fetch_add(end - begin);
+    return true;
+#else
+    ::rt_lock_error.store(ENOSYS);
+    ::rt_lock_failures.fetch_add(1);
+    return false;
+#endif
+}
+
+bool rt_lock_all_memory()
+{
+#if defined(ADLJACK_HAVE_MLOCKALL)
+    if (mlockall(MCL_CURRENT|MCL_FUTURE) == -1) {
+        ::rt_lock_error.store(errno);
+        ::rt_lock_failures.fetch_add(1);
+        return false;
+    }
+    ::rt_all_locked.store(true);
+    return true;
+#else
+    ::rt_lock_error.store(ENOSYS);
+    ::rt_lock_failures.fetch_add(1);
+    return false;
+#endif
+}
+
+void rt_report(bool quiet)
+{
+    const Rt_Settings &settings = ::rt_current_settings;
+
+    for (unsigned i = 0; i < 100 && !::rt_audio_ready.load(); ++i)
+        std::this_thread::sleep_for(stc::milliseconds(10));
+
+    if (!::rt_audio_ready.load())
+        qfprintf(quiet, stderr, "%s\n", _("Realtime: the audio thread has not started."));
+    else {
+#if !defined(_WIN32)
+        int policy = ::rt_audio_policy.load();
+        int error = ::rt_priority_error.load();
+        if (policy == SCHED_FIFO || policy == SCHED_RR)
+            qfprintf(quiet, stderr, _("Realtime: audio thread %s priority %d\n"),
+                     (policy == SCHED_FIFO) ? "SCHED_FIFO" : "SCHED_RR",
+                     ::rt_audio_priority.load());
+        else if (error > 0)
+            qfprintf(quiet, stderr, _("Realtime: audio thread not realtime: %s\n"), strerror(error));
+        else
+            qfprintf(quiet, stderr, "%s\n", _("Realtime: audio thread not realtime"));
+#endif
+        if (!settings.audio_cpus.empty()) {
+            int error = ::rt_affinity_error.load();
+            if (error == 0)
+                qfprintf(quiet, stderr, _("Realtime: audio thread on CPUs %s\n"), settings.audio_cpus.c_str());
+            else
+                qfprintf(quiet, stderr, _("Realtime: audio thread affinity not set: %s\n"), strerror(error));
+        }
+    }
+
+    if (!settings.worker_cpus.empty()) {
+        int error = ::rt_worker_affinity_error.load();
+        if (error > 0)
+            qfprintf(quiet, stderr, _("Realtime: worker thread affinity not set: %s\n"), strerror(error));
+    }
+
+    unsigned failures = ::rt_lock_failures.load();
+    if (::rt_all_locked.load())
+        qfprintf(quiet, stderr, "%s\n", _("Realtime: all memory locked"));
+    else if (settings.memory_lock != Rt_Memory_Lock::None) {
+        qfprintf(quiet, stderr, _("Realtime: %.1f KiB of memory locked\n"),
+                 ::rt_locked_bytes.load() * (1.0 / 1024));
+        qfprintf(quiet, stderr, "%s\n", _("Realtime: the state of the synthesizers, the banks and the MIDI rings are not locked"));
+    }
+    if (failures > 0)
+        qfprintf(quiet, stderr, _("Realtime: memory locking failed %u times: %s\n"),
+                 failures, strerror(::rt_lock_error.load()));
+}
@@ -0,0 +1,47 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <string>
+#include <stddef.h>
+
+enum class Rt_Memory_Lock {
+    None,
+    // the buffers of the engine which the audio thread works with; the state
+    // of the synthesizers, the bank images and the rings are not among them
+    Engine,
+    // the whole process, current and future
+    All,
+};
+
+struct Rt_Settings {
+    // SCHED_FIFO priority of the audio thread, 0 to leave it as it is
+    int priority = 0;
+    // lists of CPUs such as "2,3" or "0-3", empty for any CPU
+    std::string audio_cpus;
+    std::string worker_cpus;
+    Rt_Memory_Lock memory_lock = Rt_Memory_Lock::All;
+};
+
+Rt_Memory_Lock rt_memory_lock_by_name(const char *name, Rt_Memory_Lock def);
+const char *rt_memory_lock_name(Rt_Memory_Lock lock);
+
+void rt_configure(const Rt_Settings &settings);
+const Rt_Settings &rt_settings();
+
+// sets up the calling thread for the audio processing; meant to be called
+// at the start of every cycle, it only does the work the first time
+void rt_setup_audio_thread();
+// sets up a helper thread, to be called when it starts
+void rt_setup_worker_thread();
+
+// locks a region of memory and brings it in, true if successful
+bool rt_lock_memory(const void *data, size_t size);
+// locks all the memory of the process
+bool rt_lock_all_memory();
+
+// prints which of the realtime guarantees were obtained; it waits a little
+// for the audio thread to run its first cycle
+void rt_report(bool quiet);
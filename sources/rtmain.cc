@@ -7,6 +7,7 @@
 #include "insnames.h"
 #include "i18n.h"
 #include "common.h"
+#include "rt_setup.h"
 #include "winmm_dialog.h"
 #include <stdio.h>
 #if defined(ADLJACK_GTK3)
@@ -19,6 +20,8 @@
 static std::string program_title = "ADLrt";
 
 static double arg_latency = 20e-3;  // audio latency, 20ms default
+static bool has_latency_arg = false;
+static bool arg_auto_latency = false;
 static RtAudio::Api arg_audio_api;
 static RtMidi::Api arg_midi_api;
 
@@ -28,19 +31,28 @@ static VM_MIDI_PORT_u vmidi_port_setup(Audio_Context &ctx, std::string &name);
 #endif
 
 struct Midi_Message_Header {
-    uint8_t size;
+    unsigned size;
     double timestamp;
+    // holds the message if large, otherwise the message follows the header
+    Sysex_Block *block;
 };
 
-static int process(void *outputbuffer, void *, unsigned nframes, double, RtAudioStreamStatus, void *user_data)
+static int process(void *outputbuffer, void *, unsigned nframes, double, RtAudioStreamStatus status, void *user_data)
 {
     Audio_Context &ctx = *(Audio_Context *)user_data;
     Ring_Buffer &midi_rb = *ctx.midi_rb;
+    stc::steady_clock::time_point time_start = stc::steady_clock::now();
+    rt_setup_audio_thread();
+    Audio_Cycle_Guard cycle;
+
+    if (status & RTAUDIO_OUTPUT_UNDERFLOW)
+        ctx.underflow_count.fetch_add(1, std::memory_order_relaxed);
 
     double fs = ctx.sample_rate;
     double ts = 1.0 / fs;
     double midi_delta = ctx.midi_delta;
     bool midi_stream_started = ctx.midi_stream_started;
+    size_t sample_size = sample_format_size(ctx.sample_format);
 
     // maximum interval between midi processing cycles
     constexpr unsigned midi_interval_max = 256;
@@ -54,8 +66,10 @@ static int process(void *outputbuffer, void *, unsigned nframes, double, RtAudio
             midi_delta = segment_nframes * ts;
 
         Midi_Message_Header hdr;
-        uint8_t evdata[midi_message_max_size];
-        while (midi_rb.peek(hdr) && sizeof(hdr) + hdr.size <= midi_rb.size_used()) {
+        Midi_Event events[midi_events_max];
+        uint8_t evdata[midi_events_max][midi_message_max_size];
+        unsigned nevents = 0;
+        while (midi_rb.peek(hdr) && sizeof(hdr) + (hdr.block ? 0 : hdr.size) <= midi_rb.size_used()) {
             double timestamp = hdr.timestamp;
             if (!midi_stream_started) {
                 timestamp = 0;
@@ -65,55 +79,83 @@ static int process(void *outputbuffer, void *, unsigned nframes, double, RtAudio
                 break;  // not yet
             midi_delta -= timestamp;
 
+            if (nevents == midi_events_max) {
+                play_midi_events_and_release(events, nevents);
+                nevents = 0;
+            }
             midi_rb.discard(sizeof(hdr));
-            midi_rb.get(evdata, hdr.size);
-            play_midi(evdata, hdr.size);
+            Midi_Event &ev = events[nevents];
+            ev.time = iframe;
+            ev.size = hdr.size;
+            ev.block = hdr.block;
+            if (hdr.block)
+                ev.data = hdr.block->data;
+            else {
+                midi_rb.get(evdata[nevents], hdr.size);
+                ev.data = evdata[nevents];
+            }
+            ++nevents;
         }
+        play_midi_events_and_release(events, nevents);
 
-        generate_outputs(
-            (float *)outputbuffer + 2 * iframe,
-            (float *)outputbuffer + 2 * iframe + 1,
-            segment_nframes, 2);
+        uint8_t *frame = (uint8_t *)outputbuffer + 2 * iframe * sample_size;
+        generate_outputs(ctx.sample_format, frame, frame + sample_size, segment_nframes, 2);
 
         iframe += segment_nframes;
     }
 
     ctx.midi_delta = midi_delta;
     ctx.midi_stream_started = midi_stream_started;
+
+    // a cycle which takes most of the buffer period is a near miss
+    stc::steady_clock::duration d_cycle = stc::steady_clock::now() - time_start;
+    if (stc::duration<double>(d_cycle).count() > 0.8 * nframes * ts)
+        ctx.overload_count.fetch_add(1, std::memory_order_relaxed);
+
     return 0;
 }
 
 static void generic_midi_event(const uint8_t *data, unsigned size, double timestamp, Audio_Context &ctx)
 {
+    // large messages are passed by reference to a block of the pool
+    Sysex_Block *block = nullptr;
     if (size > midi_message_max_size) {
-        // ctx.midi_timestamp_accum += timestamp;
-        return;
+        block = ::sysex_pool.store(data, size);
+        if (!block) {
+            ctx.midi_timestamp_accum += timestamp;
+            return;
+        }
     }
+    unsigned payload_size = block ? 0 : size;
+
     Ring_Buffer &midi_rb = *ctx.midi_rb;
     Midi_Message_Header hdr;
     hdr.size = size;
     hdr.timestamp = timestamp + ctx.midi_timestamp_accum;
+    hdr.block = block;
 
     bool wait_for_buffer_space =
         ctx.midi_client->getCurrentApi() != RtMidi::UNIX_JACK;
 
     if (wait_for_buffer_space) {
         // wait for buffer space (this is non-RT!)
-        while (midi_rb.size_free() < sizeof(hdr) + size) {
+        while (midi_rb.size_free() < sizeof(hdr) + payload_size) {
             // fprintf(stderr, "MIDI buffer full!\n");
             std::this_thread::sleep_for(stc::microseconds(100));
         }
     }
     else {
         // drop
-        if (midi_rb.size_free() < sizeof(hdr) + size) {
+        if (midi_rb.size_free() < sizeof(hdr) + payload_size) {
+            if (block)
+                Sysex_Pool::release(block);
             ctx.midi_timestamp_accum += timestamp;
             return;
         }
     }
 
     midi_rb.put(hdr);
-    midi_rb.put(data, size);
+    midi_rb.put(data, payload_size);
     ctx.midi_timestamp_accum = 0;
 }
 
@@ -152,6 +194,136 @@ void midi_error_callback(RtMidiError::Type type, const std::string &text, void *
     throw RtMidiError(text, type);
 }
 
+static bool open_stream(Audio_Context &ctx, unsigned buffer_size)
+{
+    RtAudio &audio_client = *ctx.audio_client;
+#if defined(RTAUDIO_VERSION_6)
+    RtAudioErrorType err = audio_client.openStream(&ctx.stream_param, nullptr, ctx.stream_format,
+                                                   ctx.sample_rate, &buffer_size, &process,
+                                                   &ctx, &ctx.stream_opts);
+
+    if(err != RTAUDIO_NO_ERROR && err != RTAUDIO_WARNING)
+        return false;
+#else
+    try {
+        audio_client.openStream(
+            &ctx.stream_param, nullptr, ctx.stream_format, ctx.sample_rate, &buffer_size,
+            &process, &ctx, &ctx.stream_opts, &audio_error_callback);
+    }
+    catch (RtAudioError &ex) {
+        debug_printf("%s\n", ex.what());
+        return false;
+    }
+#endif
+    ctx.buffer_size = buffer_size;
+    return true;
+}
+
+// restarts the stream with another buffer size; the players and the MIDI
+// queue are left as they are
+static bool reopen_stream(Audio_Context &ctx, unsigned buffer_size)
+{
+    RtAudio &audio_client = *ctx.audio_client;
+    unsigned old_buffer_size = ctx.buffer_size;
+    audio_client.stopStream();
+    audio_client.closeStream();
+    bool success = open_stream(ctx, buffer_size);
+    if (!success && !open_stream(ctx, old_buffer_size))
+        return false;
+    audio_client.startStream();
+    return success;
+}
+
+struct Auto_Latency {
+    bool enabled = false;
+    double min = 0;
+    double max = 0;
+    // the latency which is requested, the device may round it
+    double latency = 0;
+    std::string config_key;
+    unsigned underflow_count = 0;
+    unsigned overload_count = 0;
+    stc::steady_clock::time_point last_change;
+    stc::steady_clock::time_point last_problem;
+};
+
+static Auto_Latency auto_latency;
+
+// the time to wait after a change, before looking at the stream again
+static constexpr double auto_latency_settle_time = 2.0;
+// the time without problems after which a lower latency is tried
+static constexpr double auto_latency_clean_time = 120.0;
+static constexpr double auto_latency_step = 1.5;
+
+static std::string latency_config_key(RtAudio::Api api, const std::string &device)
+{
+    std::string key = "latency-";
+    const char *api_id = audio_api_id(api);
+    key.append(api_id ? api_id : "unknown");
+    key.push_back('-');
+    for (char c : device) {
+        bool alnum = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+        key.push_back(alnum ? c : '_');
+    }
+    return key;
+}
+
+static void auto_latency_idle(void *user_data)
+{
+    Audio_Context &ctx = *(Audio_Context *)user_data;
+    Auto_Latency &al = ::auto_latency;
+    if (!al.enabled)
+        return;
+
+    stc::steady_clock::time_point now = stc::steady_clock::now();
+
+    unsigned underflow_count = ctx.underflow_count.load();
+    unsigned overload_count = ctx.overload_count.load();
+    bool problem = underflow_count != al.underflow_count || overload_count != al.overload_count;
+    al.underflow_count = underflow_count;
+    al.overload_count = overload_count;
+
+    // the problems of the stream restart do not count
+    if (stc::duration<double>(now - al.last_change).count() < auto_latency_settle_time) {
+        al.last_problem = now;
+        return;
+    }
+
+    double latency = al.latency;
+    if (problem)
+        latency = std::min(latency * auto_latency_step, al.max);
+    else if (stc::duration<double>(now - al.last_problem).count() > auto_latency_clean_time)
+        latency = std::max(latency / auto_latency_step, al.min);
+
+    if (problem)
+        al.last_problem = now;
+
+    unsigned buffer_size = ceil(latency * ctx.sample_rate);
+    if (latency == al.latency || buffer_size == ctx.buffer_size) {
+        al.latency = latency;
+        return;
+    }
+
+    if (!reopen_stream(ctx, buffer_size)) {
+        debug_printf("Could not restart the stream with a buffer size of %u.\n", buffer_size);
+        al.enabled = false;
+        return;
+    }
+    al.latency = latency;
+    al.last_change = now;
+    al.last_problem = now;
+
+    configFile.beginGroup("synth");
+    configFile.setValue(al.config_key.c_str(), (unsigned)(latency * 1e6));
+    configFile.endGroup();
+    configFile.writeIniFile();
+
+    char text[128];
+    int len = snprintf(text, sizeof(text), _("Latency %.1f ms, buffer size %u"),
+                       ctx.buffer_size * 1e3 / ctx.sample_rate, ctx.buffer_size);
+    notify(Notify_Status, (const uint8_t *)text, std::min<unsigned>(len, sizeof(text) - 1));
+}
+
 int audio_main()
 {
     Audio_Context ctx;
@@ -178,36 +350,71 @@ int audio_main()
     unsigned sample_rate = device_info.preferredSampleRate;
     ctx.sample_rate = sample_rate;
 
-    RtAudio::StreamParameters stream_param;
+    // render directly into the device format, if it has no float support
+    configFile.beginGroup("synth");
+    std::string format_name = configFile.value("sample-format", "auto").toString();
+    configFile.endGroup();
+    RtAudioFormat native_formats = device_info.nativeFormats;
+    Sample_Format sample_format = Sample_Format::F32;
+    if (format_name != "auto")
+        sample_format = sample_format_by_name(format_name.c_str(), Sample_Format::F32);
+    else if (native_formats & RTAUDIO_FLOAT32)
+        sample_format = Sample_Format::F32;
+    else if (native_formats & RTAUDIO_SINT32)
+        sample_format = Sample_Format::S32;
+    else if (native_formats & RTAUDIO_SINT16)
+        sample_format = Sample_Format::S16;
+    ctx.sample_format = sample_format;
+
+    switch (sample_format) {
+    default:
+    case Sample_Format::F32: ctx.stream_format = RTAUDIO_FLOAT32; break;
+    case Sample_Format::S16: ctx.stream_format = RTAUDIO_SINT16; break;
+    case Sample_Format::S32: ctx.stream_format = RTAUDIO_SINT32; break;
+    }
+
+    RtAudio::StreamParameters &stream_param = ctx.stream_param;
     stream_param.deviceId = output_device_id;
     stream_param.nChannels = 2;
 
-    RtAudio::StreamOptions stream_opts;
+    RtAudio::StreamOptions &stream_opts = ctx.stream_opts;
     stream_opts.flags = RTAUDIO_ALSA_USE_DEFAULT;
     if (!arg_autoconnect)
         stream_opts.flags |= RTAUDIO_JACK_DONT_CONNECT;
     stream_opts.streamName = "ADLrt";
 
+    // the automatic latency starts low, or from the last one of the device
+    Auto_Latency &al = ::auto_latency;
+    configFile.beginGroup("synth");
+    al.enabled = ::has_latency_arg ? ::arg_auto_latency :
+        configFile.value("auto-latency", false).toBool();
+    // bounds in milliseconds, and the saved latency in microseconds
+    al.min = 1e-3 * configFile.value("auto-latency-min", 3u).toUInt();
+    al.max = 1e-3 * configFile.value("auto-latency-max", 100u).toUInt();
+    al.config_key = latency_config_key(audio_client.getCurrentApi(), device_info.name);
+    double saved_latency = 1e-6 * configFile.value(al.config_key.c_str(), 0u).toUInt();
+    configFile.endGroup();
+
     double latency = ::arg_latency;
+    if (al.enabled) {
+        latency = (saved_latency > 0) ? saved_latency : al.min;
+        latency = std::max(al.min, std::min(al.max, latency));
+        al.latency = latency;
+        al.last_change = stc::steady_clock::now();
+    }
+
     unsigned buffer_size = ceil(latency * sample_rate);
     fprintf(stderr, _("Desired latency %f ms = buffer size %u\n"),
             latency * 1e3, buffer_size);
 
-#if defined(RTAUDIO_VERSION_6)
-    RtAudioErrorType err = audio_client.openStream(&stream_param, nullptr, RTAUDIO_FLOAT32,
-                                                   sample_rate, &buffer_size, &process,
-                                                   &ctx, &stream_opts);
-
-    if(err != RTAUDIO_NO_ERROR && err != RTAUDIO_WARNING)
+    if (!open_stream(ctx, buffer_size))
         return 1;
-#else
-    audio_client.openStream(
-        &stream_param, nullptr, RTAUDIO_FLOAT32, sample_rate, &buffer_size,
-        &process, &ctx, &stream_opts, &audio_error_callback);
-#endif
+    buffer_size = ctx.buffer_size;
 
     midi_client.setCallback(&rtmidi_event, &ctx);
     midi_client.setErrorCallback(&midi_error_callback);
+    // receive system exclusive, ignore timing and active sensing
+    midi_client.ignoreTypes(false, true, true);
 
 #if defined(ADLJACK_ENABLE_VIRTUALMIDI)
     VM_MIDI_PORT_u vmidi_port;
@@ -247,8 +454,9 @@ int audio_main()
     ::program_title = std::string("ADLrt") + " [" + midi_port_name + "]";
 
     latency = buffer_size / (double)sample_rate;
-    fprintf(stderr, _("RtAudio client \"%s\" fs=%u bs=%u latency=%f\n"),
-            device_info.name.c_str(), sample_rate, buffer_size, latency);
+    fprintf(stderr, _("RtAudio client \"%s\" fs=%u bs=%u latency=%f format=%s\n"),
+            device_info.name.c_str(), sample_rate, buffer_size, latency,
+            sample_format_name(sample_format));
 
     if (!initialize_player(arg_player_type, sample_rate, arg_nchip, arg_bankfile, arg_emulator))
         return 1;
@@ -257,7 +465,7 @@ int audio_main()
     player_ready();
 
     //
-    interface_exec(nullptr, nullptr);
+    interface_exec(al.enabled ? &auto_latency_idle : nullptr, &ctx);
 
     //
     audio_client.stopStream();
@@ -297,7 +505,7 @@ static void usage()
     usage_extra += _("[-C <config file path>]");
 
     usage_extra += "\n          ";
-    usage_extra += _("[-L latency-ms]");
+    usage_extra += _("[-L latency-ms|auto]");
 
     usage_extra += "\n          ";
     usage_extra += _("[-A audio-system]");
@@ -320,7 +528,6 @@ std::string get_program_title()
 int main(int argc, char *argv[])
 {
     i18n_setup();
-    midi_db.init();
 
     char *home_dir = getenv("HOME");
     if (home_dir) {
@@ -334,6 +541,11 @@ int main(int argc, char *argv[])
             break;
         }
         case 'L': {
+            ::has_latency_arg = true;
+            if (!strcmp(optarg, "auto")) {
+                ::arg_auto_latency = true;
+                break;
+            }
             double latency = ::arg_latency = std::stod(optarg) * 1e-3;
             if (latency <= 0) {
                 fprintf(stderr, "%s\n", _("Invalid latency."));
@@ -4,6 +4,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
+#include "common.h"
 #include <RtAudio.h>
 #include <RtMidi.h>
 #include <ring_buffer/ring_buffer.h>
@@ -11,6 +12,7 @@
 #include <memory>
 #include <chrono>
 #include <thread>
+#include <atomic>
 #include <string.h>
 #if defined(ADLJACK_ENABLE_VIRTUALMIDI)
 #    include "te_virtual_midi.h"
@@ -34,6 +36,14 @@ struct Audio_Context
     RtAudio *audio_client = nullptr;
     RtMidiIn *midi_client = nullptr;
     unsigned sample_rate = 0;
+    unsigned buffer_size = 0;
+    Sample_Format sample_format = Sample_Format::F32;
+    RtAudioFormat stream_format = RTAUDIO_FLOAT32;
+    RtAudio::StreamParameters stream_param;
+    RtAudio::StreamOptions stream_opts;
+    // problems seen by the audio thread, for the automatic latency
+    std::atomic<unsigned> underflow_count{0};
+    std::atomic<unsigned> overload_count{0};
     double midi_delta = 0;
     bool midi_stream_started = false;
     double midi_timestamp_accum = 0;  // timestamp accumulation of skipped events
@@ -29,13 +29,12 @@ bool save_state(std::vector<uint8_t> &data)
     player_vector.reserve(player_type_count);
     for (unsigned i = 0; i < player_type_count; ++i) {
         Player_Type pt = (Player_Type)i;
-        Player &pl = *::player[i];
         auto player = CreatePlayer_State(
             builder,
             CreatePlayer_Id(
                 builder,
                 builder.CreateString(Player::name(pt)),
-                builder.CreateString(pl.emulator_name())),
+                builder.CreateString(player_emulator_name(pt))),
             builder.CreateString(::player_bank_file[i]));
         player_vector.push_back(player);
     }
@@ -102,7 +101,9 @@ bool load_state(const std::vector<uint8_t> &data)
         program.bank_lsb = bank & 0x7f;
         program.bank_msb = (bank >> 7) & 0x7f;
         for (unsigned pt = 0; pt < player_type_count; ++pt) {
-            Player &pl = *::player[(unsigned)pt];
+            if (!::player[pt])
+                continue;
+            Player &pl = *::player[pt];
             pl.rt_bank_change_msb(i, program.bank_msb);
             pl.rt_bank_change_lsb(i, program.bank_lsb);
             pl.rt_program_change(i, program.gm);
@@ -116,17 +117,30 @@ bool load_state(const std::vector<uint8_t> &data)
             success = false;
             continue;
         }
+        const auto *bank_file = player->bank_file();
+        unsigned emu = Player::emulator_by_name(pt, player->id()->emulator()->c_str());
+        if (emu == (unsigned)-1)
+            success = false;
+
+        if (!::player[(unsigned)pt]) {
+            // not created yet, it will be set up on first use
+            if (!(pt == Player_Type::OPL3 && ::player_opl_embedded_bank_id >= 0))
+                ::player_bank_file[(unsigned)pt] = bank_file ? bank_file->str() : std::string();
+            if (emu != (unsigned)-1)
+                set_player_emulator(pt, emu);
+            continue;
+        }
+
         Player &pl = *::player[(unsigned)pt];
         if (!pl.set_chip_count(chip_count))
             success = false;
-        const auto *bank_file = player->bank_file();
 
         if(pt == Player_Type::OPL3 && ::player_opl_embedded_bank_id >= 0) {
             if (!pl.set_embedded_bank(::player_opl_embedded_bank_id))
                 success = false;
         }
         else if (bank_file && bank_file->size() > 0) {
-            if (!pl.load_bank_file(bank_file->c_str()))
+            if (!pl.load_bank(bank_file->c_str()))
                 success = false;
             else
                 ::player_bank_file[(unsigned)pt] = bank_file->str();
@@ -137,11 +151,8 @@ bool load_state(const std::vector<uint8_t> &data)
             else
                 ::player_bank_file[(unsigned)pt] = std::string();
         }
-        unsigned emu = Player::emulator_by_name(pt, player->id()->emulator()->c_str());
-        if (emu == (unsigned)-1) {
-            success = false;
+        if (emu == (unsigned)-1)
             continue;
-        }
         if (!pl.set_emulator(emu))
             success = false;
     }
@@ -152,10 +163,13 @@ bool load_state(const std::vector<uint8_t> &data)
         active_id.emulator = Player::emulator_by_name(active_id.player, state->active_id()->emulator()->c_str());
 
     auto pos = std::find(::emulator_ids.begin(), ::emulator_ids.end(), active_id);
-    if (pos == ::emulator_ids.end())
+    Player *new_active = (pos != ::emulator_ids.end()) ? require_player(active_id.player) : nullptr;
+    if (!new_active)
         success = false;
-    else
+    else {
+        new_active->set_chip_count(chip_count);
         ::active_emulator_id = std::distance(::emulator_ids.begin(), pos);
+    }
 
     return success;
 }
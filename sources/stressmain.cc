@@ -0,0 +1,341 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Polyphony stress: for each emulator, raises the chip count and the count
+// of the notes held, while timing the render of each period against its
+// duration, and finds the capacity which stays within the margin. The
+// results make the capacity profile of the host.
+
+#include "capacity.h"
+#include "player.h"
+#include "i18n.h"
+#include "common.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+namespace stc = std::chrono;
+
+std::string get_program_title()
+{
+    return "ADLstress";
+}
+
+static void usage()
+{
+    fprintf(stderr, "Usage:\n    adlstress [-p player] [-e emulator] [-r sample-rate] [-P period] [-c max-chips]\n"
+                    "              [-m margin] [-d seconds] [-g programs|random] [-V velocity]\n"
+                    "              [-C controllers] [-o profile] [-q]\n");
+}
+
+struct Stress_Settings {
+    unsigned sample_rate = 48000;
+    unsigned period = 256;
+    unsigned max_chips = 50;
+    // the highest load of a period, 99th percentile, which is sustainable
+    double margin = 0.75;
+    double step_duration = 1.0;
+    // programs given to the channels in turn, or random if empty
+    std::vector<unsigned> programs;
+    unsigned velocity = 100;
+    // controller changes per period
+    unsigned controllers = 2;
+};
+
+struct Step_Result {
+    double p99_load = 0;
+    double max_load = 0;
+    // the mean count of the chip channels in use
+    double voices = 0;
+};
+
+static unsigned count_voices(Player &player, unsigned &channels)
+{
+    char buf[2 * (player_max_chips * player_max_channels + 1)];
+    char *text = buf;
+    char *attr = buf + player_max_chips * player_max_channels + 1;
+    player.describe_channels(text, attr, sizeof(buf) / 2);
+
+    unsigned voices = 0;
+    channels = std::char_traits<char>::length(text);
+    for (unsigned i = 0; i < channels; ++i)
+        voices += text[i] != '-';
+    return voices;
+}
+
+// holds chords of the given count of notes across the 16 channels, played
+// again regularly to keep the voices in attack, and renders while timing
+static Step_Result run_step(Player &player, unsigned notes, const Stress_Settings &ss, std::minstd_rand &rng)
+{
+    player.panic();
+
+    for (unsigned channel = 0; channel < 16; ++channel) {
+        unsigned program = ss.programs.empty() ? (rng() % 128) :
+            ss.programs[channel % ss.programs.size()];
+        player.rt_program_change(channel, program);
+    }
+
+    // the chords, in thirds from a root per channel
+    std::vector<std::pair<unsigned, unsigned>> chord;
+    for (unsigned i = 0; i < notes; ++i) {
+        unsigned channel = i % 16;
+        unsigned degree = i / 16;
+        unsigned note = 36 + (channel % 4) * 5 + degree * 4;
+        chord.emplace_back(channel, std::min(note, 120u));
+    }
+
+    static const unsigned controller_ids[] = {1, 7, 10, 11, 64, 71, 74};
+
+    Player::Audio_Format format;
+    format.type = ADLMIDI_SampleType_F32;
+    format.containerSize = sizeof(float);
+    format.sampleOffset = 2 * sizeof(float);
+    std::vector<float> buffer(2 * ss.period);
+
+    unsigned periods = std::max(1u, (unsigned)(ss.step_duration * ss.sample_rate / ss.period));
+    unsigned retrigger = std::max(1u, (unsigned)(0.25 * ss.sample_rate / ss.period));
+    // the first periods settle, and are not measured
+    unsigned warmup = std::max(1u, periods / 10);
+    double budget = (double)ss.period / ss.sample_rate;
+
+    std::vector<double> loads;
+    loads.reserve(periods);
+    double voices = 0;
+
+    for (unsigned p = 0; p < warmup + periods; ++p) {
+        if (p % retrigger == 0) {
+            for (const std::pair<unsigned, unsigned> &n : chord)
+                player.rt_note_off(n.first, n.second);
+            for (const std::pair<unsigned, unsigned> &n : chord)
+                player.rt_note_on(n.first, n.second, ss.velocity);
+        }
+        for (unsigned i = 0; i < ss.controllers; ++i) {
+            unsigned channel = rng() % 16;
+            unsigned ctl = controller_ids[rng() % (sizeof(controller_ids) / sizeof(*controller_ids))];
+            unsigned value = (ctl == 64) ? 127 : (rng() % 128);
+            player.rt_controller_change(channel, ctl, value);
+        }
+
+        stc::steady_clock::time_point t1 = stc::steady_clock::now();
+        player.generate(ss.period, &buffer[0], &buffer[1], format);
+        stc::steady_clock::time_point t2 = stc::steady_clock::now();
+
+        if (p >= warmup) {
+            loads.push_back(stc::duration<double>(t2 - t1).count() / budget);
+            unsigned channels;
+            voices += count_voices(player, channels);
+        }
+    }
+
+    Step_Result result;
+    result.voices = voices / periods;
+    result.max_load = *std::max_element(loads.begin(), loads.end());
+    size_t p99 = (loads.size() - 1) * 99 / 100;
+    std::nth_element(loads.begin(), loads.begin() + p99, loads.end());
+    result.p99_load = loads[p99];
+    return result;
+}
+
+// raises the chips while the full polyphony is sustainable
+static Capacity_Entry measure_emulator(Player_Type pt, const Player::Emulator &emu, const Stress_Settings &ss, bool quiet)
+{
+    Capacity_Entry entry;
+    entry.player = pt;
+    entry.emulator = emu.name;
+
+    std::minstd_rand rng(1);
+
+    for (unsigned chips = 1; chips <= ss.max_chips; ++chips) {
+        std::unique_ptr<Player> player(Player::create(pt, ss.sample_rate));
+        if (!player || !player->set_emulator(emu.id) || !player->set_chip_count(chips)) {
+            fprintf(stderr, "Cannot set up %s with %u chips.\n", emu.name, chips);
+            break;
+        }
+
+        unsigned channels;
+        count_voices(*player, channels);
+        unsigned step = std::max(1u, channels / 4);
+
+        // the notes go beyond the channels, for the cost of the allocation
+        bool sustained = true;
+        unsigned voices = 0;
+        double load = 0;
+        for (unsigned notes = step; notes <= channels + step; notes += step) {
+            Step_Result r = run_step(*player, notes, ss, rng);
+            qfprintf(quiet, stderr, "  %2u chips, %4u notes: %6.1f voices, load %5.1f%% (99th), %5.1f%% (max)\n",
+                     chips, notes, r.voices, 100 * r.p99_load, 100 * r.max_load);
+            if (r.p99_load > ss.margin) {
+                sustained = false;
+                break;
+            }
+            voices = std::max(voices, (unsigned)(r.voices + 0.5));
+            load = r.p99_load;
+        }
+
+        if (!sustained) {
+            // the polyphony which the smallest count still sustains
+            if (entry.chips == 0) {
+                entry.chips = 1;
+                entry.voices = voices;
+                entry.load = load;
+            }
+            break;
+        }
+
+        entry.chips = chips;
+        entry.voices = voices;
+        entry.load = load;
+    }
+
+    return entry;
+}
+
+static bool parse_programs(const char *text, std::vector<unsigned> &programs)
+{
+    programs.clear();
+    if (!strcmp(text, "random"))
+        return true;
+    for (const char *p = text; *p;) {
+        char *end;
+        unsigned long program = strtoul(p, &end, 10);
+        if (end == p || program > 127)
+            return false;
+        programs.push_back(program);
+        p = end;
+        if (*p == ',')
+            ++p;
+        else if (*p)
+            return false;
+    }
+    return !programs.empty();
+}
+
+int main(int argc, char *argv[])
+{
+    i18n_setup();
+
+    Stress_Settings ss;
+    Player_Type only_pt = Player_Type::INVALID;
+    int only_emulator = -1;
+    std::string profile_path;
+    bool quiet = false;
+
+    for (int c; (c = getopt(argc, argv, "hp:e:r:P:c:m:d:g:V:C:o:q")) != -1;) {
+        switch (c) {
+        case 'p':
+            only_pt = Player::type_by_name(optarg);
+            if (only_pt == Player_Type::INVALID) {
+                fprintf(stderr, "Invalid player name.\n");
+                return 1;
+            }
+            break;
+        case 'e':
+            only_emulator = std::atoi(optarg);
+            break;
+        case 'r':
+            ss.sample_rate = std::atoi(optarg);
+            break;
+        case 'P':
+            ss.period = std::atoi(optarg);
+            break;
+        case 'c':
+            ss.max_chips = std::max(1, std::min(std::atoi(optarg), (int)player_max_chips));
+            break;
+        case 'm':
+            ss.margin = std::atof(optarg) / 100;
+            break;
+        case 'd':
+            ss.step_duration = std::atof(optarg);
+            break;
+        case 'g':
+            if (!parse_programs(optarg, ss.programs)) {
+                fprintf(stderr, "Invalid list of programs.\n");
+                return 1;
+            }
+            break;
+        case 'V':
+            ss.velocity = std::max(1, std::min(std::atoi(optarg), 127));
+            break;
+        case 'C':
+            ss.controllers = std::atoi(optarg);
+            break;
+        case 'o':
+            profile_path = optarg;
+            break;
+        case 'q':
+            quiet = true;
+            break;
+        case 'h':
+            usage();
+            return 0;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    if (argc != optind || ss.sample_rate <= 0 || ss.period <= 0 || !(ss.margin > 0) || !(ss.step_duration > 0)) {
+        usage();
+        return 1;
+    }
+
+    if (profile_path.empty())
+        profile_path = cache_file_path("capacity.profile");
+    if (profile_path.empty()) {
+        fprintf(stderr, "Cannot find the path of the capacity profile.\n");
+        return 1;
+    }
+
+    // measures of other emulators are kept, if taken the same way
+    Capacity_Profile profile;
+    if (!profile.load(profile_path) || profile.sample_rate != ss.sample_rate ||
+        profile.period != ss.period || profile.margin != ss.margin)
+        profile = Capacity_Profile();
+    profile.sample_rate = ss.sample_rate;
+    profile.period = ss.period;
+    profile.margin = ss.margin;
+
+    fprintf(stderr, "Period of %u frames at %u Hz, %.2f ms, within %.0f%%\n",
+            ss.period, ss.sample_rate, 1e3 * ss.period / ss.sample_rate, 100 * ss.margin);
+
+    std::vector<Capacity_Entry> results;
+    for (Player_Type pt : all_player_types) {
+        if (only_pt != Player_Type::INVALID && pt != only_pt)
+            continue;
+        std::vector<Player::Emulator> emus = Player::enumerate_emulators(pt);
+        for (size_t i = 0; i < emus.size(); ++i) {
+            if (only_emulator != -1 && (unsigned)only_emulator != emus[i].id)
+                continue;
+            fprintf(stderr, "%s: %s\n", Player::name(pt), emus[i].name);
+            Capacity_Entry entry = measure_emulator(pt, emus[i], ss, quiet);
+            if (entry.chips > 0) {
+                profile.set(entry);
+                results.push_back(entry);
+            }
+        }
+    }
+
+    fprintf(stderr, "\n");
+    for (const Capacity_Entry &entry : results) {
+        printf("%s\t%s\t%u chips\t%u voices\t%.1f%%\n",
+               Player::name(entry.player), entry.emulator.c_str(),
+               entry.chips, entry.voices, 100 * entry.load);
+    }
+
+    // the measures replace those of the same emulators
+    if (!profile.save(profile_path)) {
+        fprintf(stderr, "Cannot write the capacity profile '%s'.\n", profile_path.c_str());
+        return 1;
+    }
+    fprintf(stderr, "Capacity profile written to '%s'\n", profile_path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "sysex_pool.h"
+#include <string.h>
+
+Sysex_Pool sysex_pool;
+
+// by increasing size: parameter changes, setup messages, bank dumps
+const Sysex_Pool::Size_Class Sysex_Pool::size_classes[] = {
+    {256, 64},
+    {4096, 16},
+    {65536, 4},
+};
+
+Sysex_Pool::Sysex_Pool()
+{
+    size_t total_size = 0;
+    unsigned total_count = 0;
+    for (const Size_Class &sc : size_classes) {
+        total_size += (size_t)sc.block_size * sc.block_count;
+        total_count += sc.block_count;
+    }
+
+    // zero-filled, so the pages are touched before the audio thread runs
+    memory_.reset(new uint8_t[total_size]());
+    memory_size_ = total_size;
+    blocks_.reset(new Sysex_Block[total_count]);
+    block_count_ = total_count;
+
+    uint8_t *data = memory_.get();
+    Sysex_Block *block = blocks_.get();
+    for (const Size_Class &sc : size_classes) {
+        for (unsigned i = 0; i < sc.block_count; ++i, ++block) {
+            block->data = data;
+            block->capacity = sc.block_size;
+            data += sc.block_size;
+        }
+    }
+}
+
+Sysex_Pool::~Sysex_Pool()
+{
+}
+
+size_t Sysex_Pool::max_size() const
+{
+    const Size_Class &last = size_classes[sizeof(size_classes) / sizeof(*size_classes) - 1];
+    return last.block_size;
+}
+
+Sysex_Block *Sysex_Pool::store(const uint8_t *data, size_t size)
+{
+    // the blocks are ordered by size, the first free one which fits is best
+    for (unsigned i = 0, n = block_count_; i < n; ++i) {
+        Sysex_Block &block = blocks_[i];
+        if (block.capacity < size)
+            continue;
+        unsigned expected = 0;
+        if (block.refs.load(std::memory_order_relaxed) == 0 &&
+            block.refs.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+            memcpy(block.data, data, size);
+            block.size = size;
+            return &block;
+        }
+    }
+
+    overflows_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void Sysex_Pool::retain(Sysex_Block *block)
+{
+    block->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Sysex_Pool::release(Sysex_Block *block)
+{
+    block->refs.fetch_sub(1, std::memory_order_release);
+}
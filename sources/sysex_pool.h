@@ -0,0 +1,60 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+
+class Sysex_Pool;
+
+// a buffer of the pool which holds one system exclusive message
+struct Sysex_Block {
+    uint8_t *data = nullptr;
+    unsigned size = 0;
+    unsigned capacity = 0;
+    std::atomic<unsigned> refs{0};
+};
+
+// Buffers for the system exclusive messages too large to be copied through
+// the MIDI queues, which then carry a reference to the block. Blocks come in
+// a few size classes, all allocated in advance; getting and releasing them
+// is lock-free, so it is safe from the audio thread.
+class Sysex_Pool {
+public:
+    Sysex_Pool();
+    ~Sysex_Pool();
+
+    // gets a block and copies the message, null if none is free
+    Sysex_Block *store(const uint8_t *data, size_t size);
+    size_t max_size() const;
+
+    static void retain(Sysex_Block *block);
+    static void release(Sysex_Block *block);
+
+    // the storage of all the blocks, for memory locking
+    const void *memory() const { return memory_.get(); }
+    size_t memory_size() const { return memory_size_; }
+
+    // count of messages which were dropped for lack of a free block
+    unsigned long overflow_count() const
+        { return overflows_.load(std::memory_order_relaxed); }
+
+private:
+    struct Size_Class {
+        unsigned block_size;
+        unsigned block_count;
+    };
+    static const Size_Class size_classes[];
+
+    std::unique_ptr<uint8_t[]> memory_;
+    size_t memory_size_ = 0;
+    std::unique_ptr<Sysex_Block[]> blocks_;
+    unsigned block_count_ = 0;
+    std::atomic<unsigned long> overflows_{0};
+};
+
+extern Sysex_Pool sysex_pool;
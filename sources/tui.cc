@@ -6,10 +6,17 @@
 #if defined(ADLJACK_USE_CURSES)
 #include "tui.h"
 #include "tui_channels.h"
+#include "tui_voices.h"
 #include "tui_fileselect.h"
+#include "tui_banksearch.h"
+#include "bank_library.h"
 #include "insnames.h"
 #include "i18n.h"
 #include "common.h"
+#include "recorder.h"
+#include "journal.h"
+#include "voice_stats.h"
+#include "calibration.h"
 #include <chrono>
 #include <cmath>
 #include <algorithm>
@@ -36,8 +43,10 @@ struct TUI_windows
     WINDOW_u emutitle;
     WINDOW_u chipcount;
     WINDOW_u cpuratio;
+    WINDOW_u coalesce;
     WINDOW_u banktitle;
     WINDOW_u chanalloc;
+    WINDOW_u record;
     WINDOW_u volumeratio;
     WINDOW_u volume[2];
     WINDOW_u instrument[16];
@@ -55,6 +64,9 @@ struct TUI_context
     bool status_display = false;
     unsigned status_timeout = 0;
     stc::steady_clock::time_point status_start;
+    // the display of a Roland SC, under the status messages
+    std::string text_insert;
+    bool text_insert_display = false;
     Player *player = nullptr;
     std::string bank_directory;
     time_t bank_mtime[player_type_count] = {};
@@ -68,6 +80,7 @@ struct TUI_context
         unsigned serial = 0;
     };
     Channel_State channel_state;
+    Voice_Statistics voice_stats;
     void (*idle_proc)(void *) = nullptr;
     void *idle_data = nullptr;
 };
@@ -83,6 +96,7 @@ static bool handle_anylevel_key(TUI_context &ctx, int key);
 static bool handle_toplevel_key(TUI_context &ctx, int key);
 static void handle_notifications(TUI_context &ctx);
 static bool update_bank_mtime(TUI_context &ctx);
+static void start_bank_library(TUI_context &ctx);
 
 bool handle_toplevel_key_p(TUI_contextP ctx, int key)
 {
@@ -157,6 +171,8 @@ void curses_interface_exec(void (*idle_proc)(void *), void *idle_data)
     ctx.bank_directory = configFile.value("bank_directory", ctx.bank_directory).toString();
     configFile.endGroup();
 
+    start_bank_library(ctx);
+
 #ifdef ADLJACK_GTK3
     adl_gtk_init_icon(&ctx);
 #endif
@@ -182,10 +198,12 @@ void curses_interface_exec(void (*idle_proc)(void *), void *idle_data)
         stc::steady_clock::time_point now = stc::steady_clock::now();
         if (now - bank_check_last > stc::seconds(bank_check_interval)) {
             if (update_bank_mtime(ctx)) {
-                if (ctx.player->dynamic_load_bank(active_bank_file().c_str()))
+                const std::string &path = active_bank_file();
+                if (ctx.player->dynamic_update_bank(path.c_str()))
                     show_status(ctx, _("Bank has changed on disk. Reload!"));
                 else
                     show_status(ctx, _("Bank has changed on disk. Reloading failed."));
+                journal_bank_control(Journal_Control::Update_Bank, 0, path, ctx.player->bank_image().get());
             }
             bank_check_last = now;
         }
@@ -300,8 +318,11 @@ static void setup_display(TUI_context &ctx)
     ctx.win.emutitle.reset(linewin(inner, row++, 0));
     ctx.win.chipcount.reset(linewin(inner, row++, 0));
     ctx.win.cpuratio.reset(linewin(inner, row++, 0));
+    if (::midi_coalesce_enabled)
+        ctx.win.coalesce.reset(linewin(inner, row++, 0));
     ctx.win.banktitle.reset(linewin(inner, row++, 0));
     ctx.win.chanalloc.reset(linewin(inner, row++, 0));
+    ctx.win.record.reset(linewin(inner, row++, 0));
     ctx.win.volumeratio.reset(linewin(inner, row++, 0));
 
     for (unsigned channel = 0; channel < 2; ++channel)
@@ -342,6 +363,20 @@ static int print_bar(
     return OK;
 }
 
+// the headroom predicted by the cost model, if the emulator was measured
+static void print_headroom(WINDOW *w, const char *label, const Emulator_Id &id, unsigned chips, unsigned sample_rate)
+{
+    double load = predicted_emulator_load(id.player, id.emulator, chips, sample_rate);
+    if (load < 0)
+        return;
+    double headroom = 1 - load;
+    wprintw(w, "  %s ", label);
+    int attr = (headroom > 0) ? COLOR_PAIR(Colors_Highlight) : A_BOLD;
+    wattron(w, attr);
+    wprintw(w, "%.0f%%", 100 * headroom);
+    wattroff(w, attr);
+}
+
 static void update_display(TUI_context &ctx)
 {
     Player *player = ctx.player;
@@ -385,6 +420,15 @@ static void update_display(TUI_context &ctx)
             wattron(w, COLOR_PAIR(Colors_Highlight));
             mvwaddstr(w, 0, 15, player->emulator_name());
             wattroff(w, COLOR_PAIR(Colors_Highlight));
+            // before and after the switch to the previous or next emulator
+            unsigned chips = player->chip_count();
+            unsigned rate = player->sample_rate();
+            unsigned index = ::active_emulator_id;
+            print_headroom(w, _("headroom"), emulator_ids[index], chips, rate);
+            if (index > 0)
+                print_headroom(w, "<", emulator_ids[index - 1], chips, rate);
+            if (index + 1 < emulator_ids.size())
+                print_headroom(w, ">", emulator_ids[index + 1], chips, rate);
         }
         wclrtoeol(w);
         wnoutrefresh(w);
@@ -399,6 +443,14 @@ static void update_display(TUI_context &ctx)
             wattron(w, COLOR_PAIR(Colors_Highlight));
             waddstr(w, player->chip_name());
             wattroff(w, COLOR_PAIR(Colors_Highlight));
+            // before and after the removal or the addition of a chip
+            unsigned chips = player->chip_count();
+            unsigned rate = player->sample_rate();
+            const Emulator_Id &id = emulator_ids[::active_emulator_id];
+            print_headroom(w, _("headroom"), id, chips, rate);
+            if (chips > 1)
+                print_headroom(w, "[", id, chips - 1, rate);
+            print_headroom(w, "]", id, chips + 1, rate);
         }
         wclrtoeol(w);
         wnoutrefresh(w);
@@ -409,6 +461,15 @@ static void update_display(TUI_context &ctx)
         wclrtoeol(w);
         wnoutrefresh(w);
     }
+    if (WINDOW *w = ctx.win.coalesce.get()) {
+        mvwaddstr(w, 0, 0, _("Merged"));
+        wattron(w, COLOR_PAIR(Colors_Highlight));
+        mvwprintw(w, 0, 15, "%lu", ::midi_coalescer.merged_count());
+        wattroff(w, COLOR_PAIR(Colors_Highlight));
+        wprintw(w, _(" of %lu events"), ::midi_coalescer.event_count());
+        wclrtoeol(w);
+        wnoutrefresh(w);
+    }
     if (WINDOW *w = ctx.win.banktitle.get()) {
         mvwaddstr(w, 0, 0, _("Bank"));
         if (player) {
@@ -442,6 +503,23 @@ static void update_display(TUI_context &ctx)
         wclrtoeol(w);
         wnoutrefresh(w);
     }
+    if (WINDOW *w = ctx.win.record.get()) {
+        mvwaddstr(w, 0, 0, _("Record"));
+        wattron(w, COLOR_PAIR(Colors_Highlight));
+        if (!::recorder.active())
+            mvwaddstr(w, 0, 15, _("off"));
+        else {
+            std::string path = ::recorder.current_file();
+            size_t pos = path.find_last_of('/');
+            std::string name = (pos != path.npos) ? path.substr(pos + 1) : path;
+            mvwprintw(w, 0, 15, "%s %.1f s", name.c_str(), ::recorder.seconds_written());
+            if (unsigned long overruns = ::recorder.overrun_count())
+                wprintw(w, _(" (%lu overruns)"), overruns);
+        }
+        wattroff(w, COLOR_PAIR(Colors_Highlight));
+        wclrtoeol(w);
+        wnoutrefresh(w);
+    }
 
     double channel_volumes[2] = {lvcurrent[0], lvcurrent[1]};
     const char *channel_names[2] = {_("Left"), _("Right")};
@@ -556,10 +634,17 @@ static void update_display(TUI_context &ctx)
             else if (stc::steady_clock::now() - ctx.status_start > stc::seconds(ctx.status_timeout)) {
                 ctx.status_text.clear();
                 ctx.status_display = false;
+                ctx.text_insert_display = false;
                 werase(w);
                 wnoutrefresh(w);
             }
         }
+        else if (!ctx.text_insert_display) {
+            mvwaddstr(w, 0, 0, ctx.text_insert.c_str());
+            ctx.text_insert_display = true;
+            wclrtoeol(w);
+            wnoutrefresh(w);
+        }
     }
 
     struct Key_Description {
@@ -620,6 +705,9 @@ static void update_display(TUI_context &ctx)
     if (WINDOW *w = ctx.win.keydesc3.get()) {
         static const Key_Description keydesc[] = {
             { "a", _("next chanalloc") },
+            { "s", _("search banks") },
+            { "r", _("record") },
+            { "v", _("voices") },
         };
         unsigned nkeydesc = sizeof(keydesc) / sizeof(*keydesc);
 
@@ -702,7 +790,8 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
     case '[': {
         unsigned nchips = player->chip_count();
         if (nchips > 1) {
-            player->dynamic_set_chip_count(nchips - 1);
+            player->dynamic_set_chip_count(nchips - 1, ::midi_tracking);
+            journal_control(Journal_Control::Chip_Count, player->chip_count());
             configFile.beginGroup("synth");
             configFile.setValue("nchip", player->chip_count());
             configFile.endGroup();
@@ -712,7 +801,8 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
     }
     case ']': {
         unsigned nchips = player->chip_count();
-        player->dynamic_set_chip_count(nchips + 1);
+        player->dynamic_set_chip_count(nchips + 1, ::midi_tracking);
+        journal_control(Journal_Control::Chip_Count, player->chip_count());
         configFile.beginGroup("synth");
         configFile.setValue("nchip", player->chip_count());
         configFile.endGroup();
@@ -745,6 +835,7 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
         File_Selection_Options fopts;
         fopts.title = _("Load bank");
         fopts.directory = ctx.bank_directory;
+        fopts.extensions = {"wopl", "wopn", "adlb"};
         File_Selector fs(fopts);
         WINDOW_u w(derwin(stdscr, LINES, COLS, 0, 0));
         fs.setup_display(w.get());
@@ -761,16 +852,17 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
 
             handle_notifications(ctx);
 
-            if (handle_anylevel_key(ctx, key)) {
+            // letters go to the filter, only handle resize and break
+            if ((key == KEY_RESIZE || key == 3) && handle_anylevel_key(ctx, key)) {
                 if (key == KEY_RESIZE) {
                     w.reset(derwin(stdscr, LINES, COLS, 0, 0));
                     fs.setup_display(w.get());
                 }
             }
-            else {
+            else if (key != ERR)
                 code = fs.key(key);
-                fs.update();
-            }
+            // the listing progresses in the background, update each cycle
+            fs.update();
             doupdate();
         }
 
@@ -778,6 +870,7 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
             if (player->dynamic_load_bank(fopts.filepath.c_str())) {
                 show_status(ctx, _("Bank loaded!"));
                 active_bank_file() = fopts.filepath;
+                journal_bank_control(Journal_Control::Load_Bank, 0, fopts.filepath, player->bank_image().get());
                 update_bank_mtime(ctx);
             }
             else
@@ -798,9 +891,74 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
 #endif
         return true;
     }
+    case 's':
+    case 'S': {
+        erase();
+
+        Bank_Search bs(player->type());
+        WINDOW_u w(derwin(stdscr, LINES, COLS, 0, 0));
+        bs.setup_display(w.get());
+        File_Selection_Code code = File_Selection_Code::Continue;
+        bs.update();
+
+        void (*idle_proc)(void *) = ctx.idle_proc;
+        void *idle_data = ctx.idle_data;
+
+        for (key = getch(); !ctx.quit && !interface_interrupted() &&
+                 code == File_Selection_Code::Continue; key = getch()) {
+            if (idle_proc)
+                idle_proc(idle_data);
+
+            handle_notifications(ctx);
+
+            // letters go to the search field, only handle resize and break
+            if ((key == KEY_RESIZE || key == 3) && handle_anylevel_key(ctx, key)) {
+                if (key == KEY_RESIZE) {
+                    w.reset(derwin(stdscr, LINES, COLS, 0, 0));
+                    bs.setup_display(w.get());
+                }
+            }
+            else if (key != ERR)
+                code = bs.key(key);
+            bs.update();
+            doupdate();
+        }
+
+        if (code == File_Selection_Code::Ok) {
+            const Bank_Library_Match &match = bs.selection();
+            if (player->dynamic_load_bank(match.path.c_str())) {
+                if (match.is_instrument) {
+                    char text[256];
+                    snprintf(text, sizeof(text), _("Bank loaded! %s is at %s bank %u:%u program %u."),
+                             match.instrument_name.c_str(), match.percussive ? _("percussion") : _("melodic"),
+                             match.msb, match.lsb, match.program);
+                    show_status(ctx, text);
+                }
+                else
+                    show_status(ctx, _("Bank loaded!"));
+                active_bank_file() = match.path;
+                journal_bank_control(Journal_Control::Load_Bank, 0, match.path, player->bank_image().get());
+                update_bank_mtime(ctx);
+            }
+            else
+                show_status(ctx, _("Error loading the bank file."));
+
+            configFile.beginGroup("tui");
+            for (unsigned i = 0; i < player_type_count; ++i) {
+                std::string bankname_field = "bankfile-" + std::to_string(i);
+                configFile.setValue(bankname_field.c_str(), player_bank_file[i]);
+            }
+            configFile.endGroup();
+            configFile.writeIniFile();
+        }
+
+        erase();
+        return true;
+    }
     case 'p':
     case 'P': {
         player->dynamic_panic();
+        journal_control(Journal_Control::Panic, 0);
         return true;
     }
 
@@ -844,6 +1002,43 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
         return true;
     }
 
+    case 'v':
+    case 'V': {
+        erase();
+
+        WINDOW_u w(derwin(stdscr, LINES, COLS, 0, 0));
+        Voice_Monitor vm;
+        vm.setup_display(w.get());
+        vm.setup_statistics(&ctx.voice_stats);
+        vm.update();
+
+        void (*idle_proc)(void *) = ctx.idle_proc;
+        void *idle_data = ctx.idle_data;
+
+        int code = 1;
+        for (key = getch(); !ctx.quit && !interface_interrupted() &&
+                 code > 0; key = getch()) {
+            if (idle_proc)
+                idle_proc(idle_data);
+
+            handle_notifications(ctx);
+
+            if (handle_anylevel_key(ctx, key)) {
+                if (key == KEY_RESIZE) {
+                    w.reset(derwin(stdscr, LINES, COLS, 0, 0));
+                    vm.setup_display(w.get());
+                }
+            }
+            else
+                code = vm.key(key);
+            vm.update();
+            doupdate();
+        }
+
+        erase();
+        return true;
+    }
+
     case 'a':
     case 'A': {
         int mode = player->get_channel_alloc_mode();
@@ -851,17 +1046,35 @@ static bool handle_toplevel_key(TUI_context &ctx, int key)
         if (mode >= ADLMIDI_ChanAlloc_Count)
             mode = -1;
         player->dynamic_set_channel_alloc(mode);
+        journal_control(Journal_Control::Channel_Alloc, mode);
         configFile.beginGroup("synth");
         configFile.setValue("chanalloc", mode);
         configFile.endGroup();
         configFile.writeIniFile();
         return true;
     }
+
+    case 'r':
+    case 'R': {
+        if (::recorder.active()) {
+            stop_recording();
+            show_status(ctx, _("Recording stopped."));
+        }
+        else if (start_recording())
+            show_status(ctx, _("Recording started."));
+        else
+            show_status(ctx, _("Error starting the recording."));
+        return true;
+    }
     }
 }
 
 static void handle_notifications(TUI_context &ctx)
 {
+    // this may post more notifications
+    handle_deferred_sysex();
+    handle_sample_rate_change();
+
     Ring_Buffer *fifo = ::fifo_notify.get();
     if (!fifo)
         return;
@@ -874,6 +1087,16 @@ static void handle_notifications(TUI_context &ctx)
             assert(false);
             break;
         case Notify_TextInsert: {
+            std::unique_ptr<char[]> buf(new char[hdr.size]);
+            fifo->get(buf.get(), hdr.size);
+            std::string text(buf.get(), hdr.size);
+            for (char &c : text)
+                c = ((unsigned char)c < 0x20 || c == 0x7f) ? ' ' : c;
+            ctx.text_insert = std::move(text);
+            ctx.text_insert_display = false;
+            break;
+        }
+        case Notify_Status: {
             std::unique_ptr<char[]> buf(new char[hdr.size]);
             fifo->get(buf.get(), hdr.size);
             show_status(ctx, std::string(buf.get(), hdr.size));
@@ -887,6 +1110,11 @@ static void handle_notifications(TUI_context &ctx)
             fifo->get(state.data.get(), hdr.size);
             state.size = hdr.size;
             ++state.serial;
+            if (Player *player = ctx.player) {
+                const char *data = state.data.get();
+                ctx.voice_stats.update(data, data + hdr.size / 2, hdr.size / 2,
+                                       player->chip_count(), ::midi_channel_note_count);
+            }
             break;
         }
         }
@@ -907,6 +1135,34 @@ static bool update_bank_mtime(TUI_context &ctx)
     return new_mtime && new_mtime != old_mtime;
 }
 
+static void start_bank_library(TUI_context &ctx)
+{
+    std::vector<Bank_Library_Directory> dirs;
+    for (const std::string &path : default_bank_library_directories())
+        dirs.push_back(Bank_Library_Directory{path, true});
+
+    // the directory of the file browser is often the home or the root, so
+    // only the files directly in it are indexed
+    if (!ctx.bank_directory.empty())
+        dirs.push_back(Bank_Library_Directory{ctx.bank_directory, false});
+
+    // additional directories, separated by ';'
+    configFile.beginGroup("tui");
+    std::string extra = configFile.value("bank_library", std::string()).toString();
+    configFile.endGroup();
+    for (size_t start = 0, end; start < extra.size(); start = end + 1) {
+        end = extra.find(';', start);
+        if (end == extra.npos)
+            end = extra.size();
+        if (end > start)
+            dirs.push_back(Bank_Library_Directory{extra.substr(start, end - start), true});
+    }
+
+    bank_library.set_directories(dirs);
+    bank_library.set_index_file(cache_file_path("bank-library.idx"));
+    bank_library.start();
+}
+
 //------------------------------------------------------------------------------
 int getrows(WINDOW *w)
 {
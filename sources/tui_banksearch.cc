@@ -0,0 +1,221 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if defined(ADLJACK_USE_CURSES)
+#include "tui_banksearch.h"
+#include "bank_library.h"
+#include "tui.h"
+#include "i18n.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// how many results are kept for display
+static constexpr unsigned bank_search_max_results = 500;
+
+struct Bank_Search::Impl
+{
+    Player_Type type_ = Player_Type::INVALID;
+    std::string query_;
+    std::vector<Bank_Library_Match> results_;
+    unsigned selection_ = 0;
+    unsigned serial_ = 0;
+    bool serial_valid_ = false;
+    //
+    struct Windows {
+        WINDOW *outer_ = nullptr;
+        WINDOW_u query_;
+        WINDOW_u inner_;
+        WINDOW_u status_;
+    };
+    Windows win;
+    //
+    void update_results();
+    void update_display();
+};
+
+Bank_Search::Bank_Search(Player_Type type)
+    : P(new Impl)
+{
+    P->type_ = type;
+    P->update_results();
+}
+
+Bank_Search::~Bank_Search()
+{
+}
+
+void Bank_Search::setup_display(WINDOW *outer)
+{
+    P->win = Impl::Windows();
+    P->win.outer_ = outer;
+
+    if (!outer)
+        return;
+
+    P->win.query_.reset(derwin_s(outer, 1, getcols(outer) - 2, 1, 1));
+    P->win.inner_.reset(derwin_s(outer, getrows(outer) - 5, getcols(outer) - 2, 3, 1));
+    P->win.status_.reset(derwin_s(outer, 1, getcols(outer) - 2, getrows(outer) - 2, 1));
+}
+
+void Bank_Search::update()
+{
+    // pick up the progress of the background scan
+    if (!P->serial_valid_ || P->serial_ != bank_library.serial())
+        P->update_results();
+    P->update_display();
+}
+
+File_Selection_Code Bank_Search::key(int key)
+{
+    unsigned count = P->results_.size();
+
+    switch (key) {
+    case KEY_DOWN:
+        if (P->selection_ + 1 < count)
+            ++P->selection_;
+        break;
+    case KEY_UP:
+        if (P->selection_ > 0)
+            --P->selection_;
+        break;
+    case KEY_NPAGE:
+        if (count > 0)
+            P->selection_ = std::min(P->selection_ + 10, count - 1);
+        break;
+    case KEY_PPAGE:
+        P->selection_ -= std::min(10u, P->selection_);
+        break;
+    case KEY_ENTER:
+    case '\r':
+    case '\n':
+        if (P->selection_ < count)
+            return File_Selection_Code::Ok;
+        break;
+    case KEY_BACKSPACE:
+    case '\b':
+    case 127:
+        if (!P->query_.empty()) {
+            P->query_.pop_back();
+            P->update_results();
+        }
+        break;
+    case 27:  // escape
+        return File_Selection_Code::Cancel;
+    default:
+        if (key >= 32 && key < 127) {
+            P->query_.push_back((char)key);
+            P->update_results();
+        }
+        break;
+    }
+
+    return File_Selection_Code::Continue;
+}
+
+const Bank_Library_Match &Bank_Search::selection() const
+{
+    return P->results_.at(P->selection_);
+}
+
+void Bank_Search::Impl::update_results()
+{
+    serial_ = bank_library.serial();
+    serial_valid_ = true;
+    bank_library.search(query_, type_, results_, bank_search_max_results);
+    if (selection_ >= results_.size())
+        selection_ = results_.empty() ? 0 : (results_.size() - 1);
+}
+
+void Bank_Search::Impl::update_display()
+{
+    if (WINDOW *w = win.outer_) {
+        std::string title = _("Search banks");
+        size_t titlesize = title.size();
+
+        wattron(w, A_BOLD|COLOR_PAIR(Colors_Frame));
+        wborder(w, ' ', ' ', '-', '-', '-', '-', '-', '-');
+        wattroff(w, A_BOLD|COLOR_PAIR(Colors_Frame));
+
+        unsigned cols = getcols(w);
+        if (cols >= titlesize + 2) {
+            unsigned x = (cols - (titlesize + 2)) / 2;
+            wattron(w, A_BOLD|COLOR_PAIR(Colors_Frame));
+            mvwaddch(w, 0, x, '(');
+            mvwaddch(w, 0, x + titlesize + 1, ')');
+            wattroff(w, A_BOLD|COLOR_PAIR(Colors_Frame));
+            mvwaddstr(w, 0, x + 1, title.c_str());
+        }
+        wnoutrefresh(w);
+    }
+
+    if (WINDOW *w = win.query_.get()) {
+        wattron(w, A_UNDERLINE);
+        mvwprintw(w, 0, 0, _("Search: %s"), query_.c_str());
+        wattroff(w, A_UNDERLINE);
+        wclrtoeol(w);
+        wnoutrefresh(w);
+    }
+
+    if (WINDOW *w = win.inner_.get()) {
+        unsigned selection = selection_;
+        unsigned count = results_.size();
+        unsigned display_max = getrows(w);
+        unsigned display_offset = selection;
+        display_offset -= std::min(display_offset, display_max / 2);
+
+        for (unsigned display_nth = 0; display_nth < display_max; ++display_nth) {
+            unsigned index = display_nth + display_offset;
+            if (index >= count)
+                break;
+
+            const Bank_Library_Match &match = results_[index];
+            bool selected = index == selection;
+
+#if !defined(_WIN32)
+            size_t pos = match.path.rfind('/');
+#else
+            size_t pos = match.path.find_last_of("/\\");
+#endif
+            std::string file = (pos != match.path.npos) ? match.path.substr(pos + 1) : match.path;
+
+            if (selected)
+                wattron(w, COLOR_PAIR(Colors_Select));
+            wmove(w, display_nth, 0);
+            if (match.is_instrument) {
+                wattron(w, COLOR_PAIR(Colors_ProgramNumber));
+                wprintw(w, "%c %3u:%3u:%3u ", match.percussive ? 'P' : 'M',
+                        match.msb, match.lsb, match.program);
+                wattroff(w, COLOR_PAIR(Colors_ProgramNumber));
+                waddstr(w, match.instrument_name.c_str());
+                waddstr(w, "  ");
+            }
+            if (!match.is_instrument || !match.bank_name.empty()) {
+                wattron(w, COLOR_PAIR(Colors_Highlight));
+                waddstr(w, match.bank_name.c_str());
+                wattroff(w, COLOR_PAIR(Colors_Highlight));
+                waddstr(w, "  ");
+            }
+            wprintw(w, "(%s)", file.c_str());
+            wclrtoeol(w);
+            if (selected)
+                wattroff(w, COLOR_PAIR(Colors_Select));
+        }
+
+        wclrtobot(w);
+        wnoutrefresh(w);
+    }
+
+    if (WINDOW *w = win.status_.get()) {
+        wmove(w, 0, 0);
+        wprintw(w, _("%u results, %u files indexed"),
+                (unsigned)results_.size(), (unsigned)bank_library.file_count());
+        if (bank_library.scanning())
+            waddstr(w, _(", scanning..."));
+        wclrtoeol(w);
+        wnoutrefresh(w);
+    }
+}
+#endif
@@ -0,0 +1,28 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#if defined(ADLJACK_USE_CURSES)
+#include "tui_fileselect.h"
+#include "player.h"
+#include <curses.h>
+#include <memory>
+
+struct Bank_Library_Match;
+
+class Bank_Search {
+public:
+    explicit Bank_Search(Player_Type type);
+    ~Bank_Search();
+    void setup_display(WINDOW *w);
+    void update();
+    File_Selection_Code key(int key);
+    const Bank_Library_Match &selection() const;
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+#endif
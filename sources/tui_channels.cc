@@ -7,6 +7,7 @@
 #include "common.h"
 #include "player.h"
 #include "tui.h"
+#include "journal.h"
 #include <string>
 
 struct Channel_Monitor::Impl
@@ -101,6 +102,7 @@ int Channel_Monitor::key(int key)
         if (mode >= ADLMIDI_ChanAlloc_Count)
             mode = -1;
         P->player->dynamic_set_channel_alloc(mode);
+        journal_control(Journal_Control::Channel_Alloc, mode);
         return 1;
     }
     }
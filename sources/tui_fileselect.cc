@@ -5,10 +5,15 @@
 
 #if defined(ADLJACK_USE_CURSES)
 #include "tui_fileselect.h"
+#include "bank_cache.h"
+#include "rt_setup.h"
 #include "tui.h"
 #include "i18n.h"
 #include <algorithm>
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <dirent.h>
@@ -52,6 +57,16 @@ static int ascii_case_cmp(const char *a, const char *b)
     }
 }
 
+static bool ascii_case_prefix(const std::string &text, const std::string &prefix)
+{
+    if (prefix.size() > text.size())
+        return false;
+    for (size_t i = 0, n = prefix.size(); i < n; ++i)
+        if (ascii_to_lower(text[i]) != ascii_to_lower(prefix[i]))
+            return false;
+    return true;
+}
+
 ///
 bool operator<(const File_Entry &a, const File_Entry &b)
 {
@@ -68,6 +83,40 @@ bool operator<(const File_Entry &a, const File_Entry &b)
     return ascii_case_cmp(a.name.c_str(), b.name.c_str()) < 0;
 }
 
+static bool has_extension(const std::string &name, const std::vector<std::string> &extensions)
+{
+    size_t pos = name.rfind('.');
+    if (pos == name.npos)
+        return false;
+    const char *ext = name.c_str() + pos + 1;
+    for (const std::string &x : extensions)
+        if (!ascii_case_cmp(ext, x.c_str()))
+            return true;
+    return false;
+}
+
+static bool is_bank_file_name(const std::string &name)
+{
+    static const std::vector<std::string> extensions {"wopl", "wopn", "adlb"};
+    return has_extension(name, extensions);
+}
+
+// number of bank files on each side of the selection to load in advance
+static constexpr unsigned bank_prefetch_radius = 2;
+
+// number of entries the listing thread collects before handing them over
+static constexpr unsigned listing_batch_size = 64;
+
+// directory contents, produced by a listing thread
+struct Directory_Listing {
+    std::mutex mutex;
+    std::vector<File_Entry> pending;
+    bool done = false;
+    std::atomic<bool> cancel{false};
+};
+
+typedef std::shared_ptr<Directory_Listing> Directory_Listing_Ptr;
+
 struct File_Selector::Impl
 {
     File_Selection_Options *opts_ = nullptr;
@@ -75,23 +124,39 @@ struct File_Selector::Impl
     struct Windows {
         WINDOW *outer_ = nullptr;
         WINDOW_u title_;
+        WINDOW_u filter_;
         WINDOW_u inner_;
     };
     Windows win;
     std::vector<File_Entry> file_list_;
+    // indices of the entries which pass the filters
+    std::vector<unsigned> view_;
     unsigned file_selection_ = 0;
+    Directory_Listing_Ptr listing_;
+    bool listing_done_ = true;
+    //
+    std::string filter_prefix_;
+    bool filter_extensions_ = false;
     //
     void update_file_list();
+    void receive_file_list();
+    void update_view();
+    bool is_visible(const File_Entry &fe) const;
+    const File_Entry *selected_entry() const;
     void update_display();
     std::string visit_file();
     std::string visit_file_if_directory();
+    void prefetch_neighbours();
 };
 
+static void list_directory(std::string directory, bool show_hidden, Directory_Listing_Ptr listing);
+
 File_Selector::File_Selector(File_Selection_Options &opts)
     : P(new Impl)
 {
     P->opts_ = &opts;
     P->file_list_.reserve(256);
+    P->filter_extensions_ = !opts.extensions.empty();
     if (opts.directory.empty())
         opts.directory = '/';
     P->update_file_list();
@@ -99,18 +164,24 @@ File_Selector::File_Selector(File_Selection_Options &opts)
 
 File_Selector::~File_Selector()
 {
+    if (Directory_Listing *listing = P->listing_.get())
+        listing->cancel = true;
 }
 
 void File_Selector::update()
 {
+    P->receive_file_list();
     P->update_display();
 }
 
 File_Selection_Code File_Selector::key(int key)
 {
+    unsigned old_selection = P->file_selection_;
+    unsigned count = P->view_.size();
+
     switch (key) {
     case KEY_DOWN:
-        if (P->file_selection_ + 1 < P->file_list_.size())
+        if (P->file_selection_ + 1 < count)
             ++P->file_selection_;
         break;
     case KEY_UP:
@@ -119,7 +190,7 @@ File_Selection_Code File_Selector::key(int key)
         break;
     case KEY_NPAGE: {
         unsigned count = std::min<unsigned>
-            (10, P->file_list_.size() - P->file_selection_ - 1);
+            (10, P->view_.size() - P->file_selection_ - 1);
         P->file_selection_ += count;
         break;
     }
@@ -138,19 +209,50 @@ File_Selection_Code File_Selector::key(int key)
         }
         break;
     }
-    case KEY_LEFT:
     case KEY_BACKSPACE:
     case '\b':
+    case 127:
+        if (!P->filter_prefix_.empty()) {
+            P->filter_prefix_.pop_back();
+            P->update_view();
+            break;
+        }
+        // fall through
+    case KEY_LEFT:
         P->file_selection_ = 0;  // the first entry ".."
         P->visit_file();
         break;
     case KEY_RIGHT:
         P->visit_file_if_directory();
         break;
+    case '\t':
+        if (!P->opts_->extensions.empty()) {
+            P->filter_extensions_ = !P->filter_extensions_;
+            P->update_view();
+        }
+        break;
     case 27:  // escape
+        if (!P->filter_prefix_.empty()) {
+            P->filter_prefix_.clear();
+            P->update_view();
+            break;
+        }
         return File_Selection_Code::Cancel;
+    default:
+        if (key >= 32 && key < 127) {
+            P->filter_prefix_.push_back((char)key);
+            P->file_selection_ = 0;
+            P->update_view();
+            // select the first match rather than ".."
+            if (P->view_.size() > 1)
+                P->file_selection_ = 1;
+        }
+        break;
     }
 
+    if (P->file_selection_ != old_selection)
+        P->prefetch_neighbours();
+
     return File_Selection_Code::Continue;
 }
 
@@ -163,6 +265,7 @@ void File_Selector::setup_display(WINDOW *outer)
         return;
 
     P->win.title_.reset(derwin_s(outer, 1, getcols(outer) - 2, 1, 1));
+    P->win.filter_.reset(derwin_s(outer, 1, getcols(outer) - 2, 2, 1));
     P->win.inner_.reset(derwin_s(outer, getrows(outer) - 4, getcols(outer) - 2, 3, 1));
 }
 
@@ -194,13 +297,31 @@ void File_Selector::Impl::update_display()
         wattron(w, A_UNDERLINE);
         mvwprintw(w, 0, 0, _("Directory: %s"), opts.directory.c_str());
         wattroff(w, A_UNDERLINE);
+        if (!listing_done_)
+            waddstr(w, _(" (listing...)"));
+        wclrtoeol(w);
+        wnoutrefresh(w);
+    }
+
+    if (WINDOW *w = win.filter_.get()) {
+        wmove(w, 0, 0);
+        if (!filter_prefix_.empty())
+            wprintw(w, _("Filter: %s"), filter_prefix_.c_str());
+        if (filter_extensions_) {
+            if (!filter_prefix_.empty())
+                waddstr(w, "  ");
+            wattron(w, COLOR_PAIR(Colors_Highlight));
+            waddstr(w, _("[bank files only]"));
+            wattroff(w, COLOR_PAIR(Colors_Highlight));
+        }
         wclrtoeol(w);
         wnoutrefresh(w);
     }
 
     if (WINDOW *w = win.inner_.get()) {
+        // only the rows in view are drawn, whatever the size of the listing
         unsigned file_selection = file_selection_;
-        unsigned file_count = file_list_.size();
+        unsigned file_count = view_.size();
         unsigned display_max = getrows(w);
         unsigned display_offset = file_selection;
         display_offset -= std::min(display_offset, display_max / 2);
@@ -210,7 +331,7 @@ void File_Selector::Impl::update_display()
             if (index >= file_count)
                 break;
 
-            const File_Entry &fe = file_list_[index];
+            const File_Entry &fe = file_list_[view_[index]];
             bool selected = index == file_selection;
 
             int sel_attr = 0;
@@ -261,7 +382,13 @@ void File_Selector::Impl::update_file_list()
         directory.push_back('/');
 #endif
 
+    if (Directory_Listing *listing = listing_.get())
+        listing->cancel = true;
+    listing_.reset();
+    listing_done_ = true;
+
     file_list_.clear();
+    filter_prefix_.clear();
 
     File_Entry fe;
     fe.name = "..";
@@ -280,34 +407,147 @@ void File_Selector::Impl::update_file_list()
             fe.type = File_Type::Directory;
             file_list_.push_back(fe);
         }
+        update_view();
         return;
     }
 #endif
 
-    DIR_u dir(opendir(directory.c_str()));
-    if (!dir)
+    update_view();
+
+    // the directory is read in the background, the entries arrive in
+    // batches at the next updates
+    Directory_Listing_Ptr listing(new Directory_Listing);
+    listing_ = listing;
+    listing_done_ = false;
+    std::thread(&list_directory, directory, opts.show_hidden_files, listing).detach();
+}
+
+void File_Selector::Impl::receive_file_list()
+{
+    Directory_Listing *listing = listing_.get();
+    if (!listing)
         return;
 
-    while (dirent *ent = readdir(dir.get())) {
+    std::vector<File_Entry> batch;
+    std::unique_lock<std::mutex> lock(listing->mutex);
+    batch.swap(listing->pending);
+    bool done = listing->done;
+    lock.unlock();
+
+    if (!batch.empty()) {
+        // keep the selected entry across the insertion
+        const File_Entry *selected = selected_entry();
+        std::string selected_name = selected ? selected->name : std::string();
+
+        size_t middle = file_list_.size();
+        std::sort(batch.begin(), batch.end());
+        file_list_.insert(file_list_.end(), batch.begin(), batch.end());
+        std::inplace_merge(file_list_.begin(), file_list_.begin() + middle, file_list_.end());
+
+        update_view();
+
+        for (unsigned i = 0, n = view_.size(); i < n; ++i) {
+            if (file_list_[view_[i]].name == selected_name) {
+                file_selection_ = i;
+                break;
+            }
+        }
+    }
+
+    if (done) {
+        listing_.reset();
+        listing_done_ = true;
+        prefetch_neighbours();
+    }
+}
+
+void File_Selector::Impl::update_view()
+{
+    view_.clear();
+    for (unsigned i = 0, n = file_list_.size(); i < n; ++i)
+        if (is_visible(file_list_[i]))
+            view_.push_back(i);
+    if (file_selection_ >= view_.size())
+        file_selection_ = view_.empty() ? 0 : (view_.size() - 1);
+}
+
+bool File_Selector::Impl::is_visible(const File_Entry &fe) const
+{
+    if (fe.name == "..")
+        return true;
+    if (!filter_prefix_.empty() && !ascii_case_prefix(fe.name, filter_prefix_))
+        return false;
+    if (filter_extensions_ && fe.type == File_Type::Regular &&
+        !has_extension(fe.name, opts_->extensions))
+        return false;
+    return true;
+}
+
+const File_Entry *File_Selector::Impl::selected_entry() const
+{
+    if (file_selection_ >= view_.size())
+        return nullptr;
+    return &file_list_[view_[file_selection_]];
+}
+
+static void list_directory(std::string directory, bool show_hidden, Directory_Listing_Ptr listing)
+{
+    rt_setup_worker_thread();
+    DIR_u dir(opendir(directory.c_str()));
+
+    std::vector<File_Entry> batch;
+    batch.reserve(listing_batch_size);
+
+    auto flush = [&listing, &batch]() {
+        std::lock_guard<std::mutex> lock(listing->mutex);
+        listing->pending.insert(listing->pending.end(), batch.begin(), batch.end());
+        batch.clear();
+    };
+
+    while (dir && !listing->cancel) {
+        dirent *ent = readdir(dir.get());
+        if (!ent)
+            break;
+
+        File_Entry fe;
         fe.name = ent->d_name;
 
         if (fe.name == "." || fe.name == "..")
             continue;
-        if (!opts.show_hidden_files && fe.name.front() == '.')
-            continue;
-
-        struct stat st;
-        if (stat((directory + '/' + fe.name).c_str(), &st) == -1)
+        if (!show_hidden && fe.name.front() == '.')
             continue;
 
-        if (S_ISDIR(st.st_mode))
+        bool known = false;
+#if defined(DT_UNKNOWN)
+        // the type is often known from the directory entry, without stat
+        switch (ent->d_type) {
+        case DT_DIR:
             fe.type = File_Type::Directory;
-        else
+            known = true;
+            break;
+        case DT_REG:
             fe.type = File_Type::Regular;
-        file_list_.push_back(fe);
+            known = true;
+            break;
+        }
+#endif
+
+        if (!known) {
+            // links, and file systems which do not report the type
+            struct stat st;
+            if (stat((directory + '/' + fe.name).c_str(), &st) == -1)
+                continue;
+            fe.type = S_ISDIR(st.st_mode) ? File_Type::Directory : File_Type::Regular;
+        }
+
+        batch.push_back(std::move(fe));
+        if (batch.size() >= listing_batch_size)
+            flush();
     }
 
-    std::sort(file_list_.begin(), file_list_.end());
+    flush();
+    std::lock_guard<std::mutex> lock(listing->mutex);
+    listing->done = true;
 }
 
 static std::string relative_path(std::string dir, const std::string &entry)
@@ -349,7 +589,11 @@ static std::string relative_path(std::string dir, const std::string &entry)
 
 std::string File_Selector::Impl::visit_file()
 {
-    File_Entry &fe = file_list_.at(file_selection_);
+    const File_Entry *selected = selected_entry();
+    if (!selected)
+        return std::string();
+
+    const File_Entry &fe = *selected;
     File_Selection_Options &opts = *opts_;
 
     std::string relative = relative_path(opts.directory, fe.name);
@@ -366,9 +610,35 @@ std::string File_Selector::Impl::visit_file()
 
 std::string File_Selector::Impl::visit_file_if_directory()
 {
-    File_Entry &fe = file_list_.at(file_selection_);
-    if (fe.type != File_Type::Directory)
+    const File_Entry *selected = selected_entry();
+    if (!selected || selected->type != File_Type::Directory)
         return std::string();
     return visit_file();
 }
+
+void File_Selector::Impl::prefetch_neighbours()
+{
+    const std::string &directory = opts_->directory;
+    unsigned file_count = view_.size();
+    unsigned selection = file_selection_;
+
+    std::vector<std::string> paths;
+    paths.reserve(2 * bank_prefetch_radius + 1);
+
+    // nearest first, so the likely next choices are ready the soonest
+    for (unsigned distance = 0; distance <= bank_prefetch_radius; ++distance) {
+        for (int side : {+1, -1}) {
+            if (distance == 0 && side < 0)
+                continue;
+            long index = (long)selection + side * (long)distance;
+            if (index < 0 || index >= (long)file_count)
+                continue;
+            const File_Entry &fe = file_list_[view_[index]];
+            if (fe.type == File_Type::Regular && is_bank_file_name(fe.name))
+                paths.push_back(relative_path(directory, fe.name));
+        }
+    }
+
+    bank_cache.prefetch(paths);
+}
 #endif
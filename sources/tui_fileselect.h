@@ -7,6 +7,7 @@
 #if defined(ADLJACK_USE_CURSES)
 #include <curses.h>
 #include <string>
+#include <vector>
 #include <memory>
 
 struct File_Selection_Options {
@@ -14,6 +15,8 @@ struct File_Selection_Options {
     std::string filepath;
     std::string title;
     bool show_hidden_files = false;
+    // extensions of the files to show, toggled with Tab; empty for all
+    std::vector<std::string> extensions;
 };
 
 enum class File_Selection_Code {
@@ -0,0 +1,166 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "tui_voices.h"
+#include "voice_stats.h"
+#include "common.h"
+#include "tui.h"
+#include "i18n.h"
+#include <algorithm>
+
+struct Voice_Monitor::Impl
+{
+    struct Windows {
+        WINDOW *outer_ = nullptr;
+        WINDOW_u inner;
+    };
+    Windows win;
+    Voice_Statistics *stats = nullptr;
+    unsigned long last_samples = (unsigned long)-1;
+    //
+    void update_display();
+};
+
+Voice_Monitor::Voice_Monitor()
+    : P(new Impl)
+{
+}
+
+Voice_Monitor::~Voice_Monitor()
+{
+}
+
+void Voice_Monitor::setup_display(WINDOW *outer)
+{
+    P->win = Impl::Windows();
+    P->win.outer_ = outer;
+    P->last_samples = (unsigned long)-1;
+
+    if (!outer)
+        return;
+
+    WINDOW *inner = derwin_s(outer, getrows(outer) - 2, getcols(outer) - 2, 2, 2);
+    if (inner)
+        P->win.inner.reset(inner);
+}
+
+void Voice_Monitor::setup_statistics(Voice_Statistics *stats)
+{
+    P->stats = stats;
+}
+
+void Voice_Monitor::update()
+{
+    // only on a new description
+    const Voice_Statistics *stats = P->stats;
+    if (!stats || stats->sample_count() == P->last_samples)
+        return;
+
+    P->last_samples = stats->sample_count();
+    P->update_display();
+}
+
+int Voice_Monitor::key(int key)
+{
+    switch (key) {
+    case 'v':
+    case 'V':
+    case 27:  // escape
+        return 0;
+    case 'r':
+    case 'R':
+        if (P->stats) {
+            P->stats->reset();
+            P->last_samples = (unsigned long)-1;
+        }
+        return 1;
+    }
+
+    return 1;
+}
+
+void Voice_Monitor::Impl::update_display()
+{
+    if (WINDOW *w = win.outer_) {
+        wattron(w, A_BOLD|COLOR_PAIR(Colors_Frame));
+        wborder(w, ' ', ' ', '-', '-', '-', '-', '-', '-');
+        wattroff(w, A_BOLD|COLOR_PAIR(Colors_Frame));
+    }
+
+    WINDOW *w = win.inner.get();
+    if (!w || !stats)
+        return;
+
+    // the last row for the keys
+    unsigned height = getrows(w);
+    if (height < 2)
+        return;
+    unsigned rows = height - 1;
+    unsigned cols = getcols(w);
+    unsigned row = 0;
+
+    wattron(w, A_BOLD);
+    mvwaddstr(w, row++, 0, _("Channel   Voices   Peak    Average   Steals   Releasing"));
+    wattroff(w, A_BOLD);
+    wclrtoeol(w);
+
+    for (unsigned channel = 0; channel < 16 && row < rows; ++channel, ++row) {
+        const Voice_Statistics::Midi_Channel &mc = stats->midi_channel(channel);
+        wmove(w, row, 0);
+        int attr = COLOR_PAIR(Colors_MidiCh1 + channel);
+        wattron(w, attr);
+        wprintw(w, "%7u", channel + 1);
+        wattroff(w, attr);
+        wprintw(w, "   %6u   %4u   %8.1f   %6lu   %8.0f%%",
+                mc.current, mc.peak, mc.average, mc.steals, 100 * mc.release_share);
+        wclrtoeol(w);
+    }
+
+    if (row < rows) {
+        wmove(w, row++, 0);
+        wclrtoeol(w);
+    }
+    if (row < rows) {
+        wattron(w, A_BOLD);
+        mvwaddstr(w, row++, 0, _("Chip usage, current / average"));
+        wattroff(w, A_BOLD);
+        wclrtoeol(w);
+    }
+
+    // the chips in columns, as many as fit
+    const unsigned column_width = 18;
+    unsigned columns = std::max(1u, cols / column_width);
+    unsigned chips = stats->chip_count();
+    for (unsigned i = 0; i < chips && row < rows; ++row) {
+        wmove(w, row, 0);
+        for (unsigned c = 0; c < columns && i < chips; ++c, ++i) {
+            const Voice_Statistics::Chip &chip = stats->chip(i);
+            wmove(w, row, c * column_width);
+            wprintw(w, "%3u:", i + 1);
+            wattron(w, COLOR_PAIR(Colors_Highlight));
+            wprintw(w, " %3.0f%%", 100 * chip.current);
+            wattroff(w, COLOR_PAIR(Colors_Highlight));
+            wprintw(w, " / %3.0f%%", 100 * chip.average);
+        }
+        wclrtoeol(w);
+    }
+
+    for (; row < rows; ++row) {
+        wmove(w, row, 0);
+        wclrtoeol(w);
+    }
+
+    {
+        wmove(w, rows, 0);
+        wattron(w, COLOR_PAIR(Colors_KeyDescription));
+        waddstr(w, "r");
+        wattroff(w, COLOR_PAIR(Colors_KeyDescription));
+        waddstr(w, " ");
+        waddstr(w, _("reset"));
+        wclrtoeol(w);
+    }
+
+    wnoutrefresh(w);
+}
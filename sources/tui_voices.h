@@ -0,0 +1,26 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#if defined(ADLJACK_USE_CURSES)
+#include <curses.h>
+#include <memory>
+
+class Voice_Statistics;
+
+class Voice_Monitor {
+public:
+    Voice_Monitor();
+    ~Voice_Monitor();
+    void setup_display(WINDOW *outer);
+    void setup_statistics(Voice_Statistics *stats);
+    void update();
+    int key(int key);
+private:
+    struct Impl;
+    std::unique_ptr<Impl> P;
+};
+
+#endif
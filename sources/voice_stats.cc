@@ -0,0 +1,70 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include "voice_stats.h"
+#include <algorithm>
+
+void Voice_Statistics::update(const char *text, const char *attr, unsigned size,
+                              unsigned chips, const unsigned note_count[16])
+{
+    if (chips == 0 || size < chips)
+        return;
+
+    // the statistics start again when the chips change
+    if (chips != chips_.size() || size != owner_.size()) {
+        reset();
+        chips_.resize(chips);
+        chip_sum_.resize(chips);
+        owner_.assign(size, -1);
+    }
+
+    unsigned voices[16] = {};
+    std::vector<unsigned> chip_voices(chips);
+    unsigned channels_per_chip = size / chips;
+
+    for (unsigned i = 0; i < size; ++i) {
+        if (text[i] == '-') {
+            owner_[i] = -1;
+            continue;
+        }
+        unsigned channel = (uint8_t)attr[i] & 0xf;
+        ++voices[channel];
+        ++chip_voices[std::min(i / channels_per_chip, chips - 1)];
+        if (owner_[i] != -1 && owner_[i] != (int8_t)channel)
+            ++midi_[channel].steals;
+        owner_[i] = channel;
+    }
+
+    ++samples_;
+    for (unsigned channel = 0; channel < 16; ++channel) {
+        Midi_Channel &mc = midi_[channel];
+        unsigned current = voices[channel];
+        unsigned releasing = (current > note_count[channel]) ? (current - note_count[channel]) : 0;
+        mc.current = current;
+        mc.peak = std::max(mc.peak, current);
+        voice_sum_[channel] += current;
+        release_sum_[channel] += releasing;
+        mc.average = voice_sum_[channel] / samples_;
+        mc.release_share = (voice_sum_[channel] > 0) ? (release_sum_[channel] / voice_sum_[channel]) : 0;
+    }
+
+    for (unsigned i = 0; i < chips; ++i) {
+        Chip &chip = chips_[i];
+        chip.current = (double)chip_voices[i] / channels_per_chip;
+        chip_sum_[i] += chip.current;
+        chip.average = chip_sum_[i] / samples_;
+    }
+}
+
+void Voice_Statistics::reset()
+{
+    std::fill_n(midi_, 16, Midi_Channel());
+    std::fill_n(voice_sum_, 16, 0.0);
+    std::fill_n(release_sum_, 16, 0.0);
+    std::fill(chips_.begin(), chips_.end(), Chip());
+    std::fill(chip_sum_.begin(), chip_sum_.end(), 0.0);
+    std::fill(owner_.begin(), owner_.end(), -1);
+    samples_ = 0;
+}
@@ -0,0 +1,61 @@
+//          Copyright Jean Pierre Cimalando 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#include <vector>
+#include <stdint.h>
+
+// Statistics of the occupancy of the chip channels, gathered from the
+// descriptions of the channels which the engine sends at regular times:
+// for each MIDI channel, the voices which it holds, and for each chip, the
+// share of its channels in use.
+//
+// A voice is a chip channel in use, owned by the MIDI channel of its first
+// note. A steal is counted when a channel changes owner from one
+// description to the next. The voices of a MIDI channel in excess of its
+// held notes are counted as releasing.
+
+class Voice_Statistics {
+public:
+    struct Midi_Channel {
+        unsigned current = 0;
+        unsigned peak = 0;
+        double average = 0;
+        unsigned long steals = 0;
+        // the share of the voices which sound after the note was released
+        double release_share = 0;
+    };
+    struct Chip {
+        double current = 0;
+        double average = 0;
+    };
+
+    // adds a description of the chip channels: the state characters, then
+    // the attributes, each of size bytes; note_count is of the notes held
+    void update(const char *text, const char *attr, unsigned size,
+                unsigned chips, const unsigned note_count[16]);
+    void reset();
+
+    const Midi_Channel &midi_channel(unsigned channel) const
+        { return midi_[channel]; }
+    unsigned chip_count() const
+        { return chips_.size(); }
+    const Chip &chip(unsigned index) const
+        { return chips_[index]; }
+    // the count of descriptions taken
+    unsigned long sample_count() const
+        { return samples_; }
+
+private:
+    Midi_Channel midi_[16];
+    std::vector<Chip> chips_;
+    unsigned long samples_ = 0;
+    // the sums, for the averages
+    double voice_sum_[16] = {};
+    double release_sum_[16] = {};
+    std::vector<double> chip_sum_;
+    // the owner of each chip channel at the last description, or -1 if free
+    std::vector<int8_t> owner_;
+};